@@ -44,8 +44,8 @@ namespace mongo {
 using namespace std;
 /* BSONObj ------------------------------------------------------------*/
 
-void BSONObj::_assertInvalid() {//const {
-    /*StringBuilder ss;
+void BSONObj::_assertInvalid() const {
+    StringBuilder ss;
     int os = objsize();
     ss << "BSONObj size: " << os << " (0x" << integerToHex(os) << ") is invalid. "
        << "Size must be between 0 and " << BSONObjMaxInternalSize << "("
@@ -54,12 +54,8 @@ void BSONObj::_assertInvalid() {//const {
         BSONElement e = firstElement();
         ss << " First element: " << e.toString();
     } catch (...) {
-    }*/
-    //massert(10334, "BSONObj size problem.", 0);
-    BSONObjBuilder b;
-    b << "_id" << "user0123456789" << "field0" << "abcd";
-    BSONObj p = b.obj();
-    *this = p;
+    }
+    massert(10334, ss.str(), 0);
 }
 
 BSONObj BSONObj::copy() const {
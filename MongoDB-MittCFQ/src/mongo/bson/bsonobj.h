@@ -597,16 +597,12 @@ public:
     }
 
 private:
-    void _assertInvalid(); //const;
+    void _assertInvalid() const;
 
     void init(const char* data) {
-	int size = ConstDataView(data).read<LittleEndian<int>>();
-        if(size>0 && size <= BSONObjMaxInternalSize){
-                _objdata = data;
-        }
-        else{
+        _objdata = data;
+        if (!isValid())
             _assertInvalid();
-        }
     }
 
     /**
@@ -124,6 +124,28 @@ ReadPreferenceSetting* _extractReadPref(const BSONObj& query, int queryOptions)
         : mongo::ReadPreference::PrimaryOnly;
     return new ReadPreferenceSetting(pref, TagSet());
 }
+
+/**
+ * Returns true if 'obj' is an error reply from a node whose I/O scheduler rejected the read
+ * because it could not be served before its deadline.
+ */
+bool isStorageBusyReply(const BSONObj& obj) {
+    BSONElement code = obj["code"];
+    return code.isNumber() && code.numberInt() == ErrorCodes::StorageBusy;
+}
+
+/**
+ * Same as above, but for a legacy OP_REPLY message.
+ */
+bool isStorageBusyReply(const Message& response) {
+    QueryResult::View res = response.singleData().view2ptr();
+    if (res.getNReturned() != 1) {
+        return false;
+    }
+
+    BSONObj x(res.data());
+    return hasErrField(x) && isStorageBusyReply(x);
+}
 }  // namespace
 
 // --------------------------------
@@ -525,6 +547,7 @@ unique_ptr<DBClientCursor> DBClientReplicaSet::query(const string& ns,
                << ")" << endl;
 
         string lastNodeErrMsg;
+        bool lastNodeBusy = false;
         for (size_t retry = 0; retry < MAX_RETRY; retry++) {
             try {
                 DBClientConnection* conn = selectNodeUsingTags(readPref);
@@ -542,9 +565,10 @@ unique_ptr<DBClientCursor> DBClientReplicaSet::query(const string& ns,
                 errMsgBuilder << "can't query replica set node " << _lastSlaveOkHost.toString()
                               << ": " << causedBy(redact(dbExcep));
                 lastNodeErrMsg = errMsgBuilder.str();
+                lastNodeBusy = dbExcep.getCode() == ErrorCodes::StorageBusy;
 
                 LOG(1) << lastNodeErrMsg << endl;
-                invalidateLastSlaveOkCache();
+                invalidateLastSlaveOkCache(dbExcep.toStatus());
             }
         }
 
@@ -554,7 +578,8 @@ unique_ptr<DBClientCursor> DBClientReplicaSet::query(const string& ns,
             assertMsg << ", last error: " << lastNodeErrMsg;
         }
 
-        uasserted(16370, assertMsg.str());
+        // Callers back off differently when every member was merely busy.
+        uasserted(lastNodeBusy ? ErrorCodes::StorageBusy : 16370, assertMsg.str());
     }
 
     LOG(3) << "dbclient_rs query to primary node in " << _getMonitor()->getName() << endl;
@@ -579,6 +604,7 @@ BSONObj DBClientReplicaSet::findOne(const string& ns,
                << ")" << endl;
 
         string lastNodeErrMsg;
+        bool lastNodeBusy = false;
 
         for (size_t retry = 0; retry < MAX_RETRY; retry++) {
             try {
@@ -594,9 +620,10 @@ BSONObj DBClientReplicaSet::findOne(const string& ns,
                 errMsgBuilder << "can't findone replica set node " << _lastSlaveOkHost.toString()
                               << ": " << causedBy(redact(dbExcep));
                 lastNodeErrMsg = errMsgBuilder.str();
+                lastNodeBusy = dbExcep.getCode() == ErrorCodes::StorageBusy;
 
                 LOG(1) << lastNodeErrMsg << endl;
-                invalidateLastSlaveOkCache();
+                invalidateLastSlaveOkCache(dbExcep.toStatus());
             }
         }
 
@@ -606,7 +633,7 @@ BSONObj DBClientReplicaSet::findOne(const string& ns,
             assertMsg << ", last error: " << lastNodeErrMsg;
         }
 
-        uasserted(16379, assertMsg.str());
+        uasserted(lastNodeBusy ? ErrorCodes::StorageBusy : 16379, assertMsg.str());
     }
 
     LOG(3) << "dbclient_rs findOne to primary node in " << _getMonitor()->getName() << endl;
@@ -641,7 +668,7 @@ unique_ptr<DBClientCursor> DBClientReplicaSet::checkSlaveQueryResult(
     if (!isError)
         return result;
 
-    // We only check for "not master or secondary" errors here
+    // We only check for "not master or secondary" and "storage busy" errors here
 
     // If the error code here ever changes, we need to change this code also
     BSONElement code = error["code"];
@@ -652,6 +679,13 @@ unique_ptr<DBClientCursor> DBClientReplicaSet::checkSlaveQueryResult(
                           14812);
     }
 
+    // The caller's retry loop marks the node busy and moves on to the next one.
+    if (isStorageBusyReply(error)) {
+        throw DBException(str::stream() << "node " << _lastSlaveOkHost.toString()
+                                        << " could not serve the read before its deadline",
+                          ErrorCodes::StorageBusy);
+    }
+
     return result;
 }
 
@@ -663,6 +697,14 @@ void DBClientReplicaSet::isntSecondary() {
     resetSlaveOkConn();
 }
 
+void DBClientReplicaSet::isBusy() {
+    LOG(1) << "replica set node " << _lastSlaveOkHost << " is too busy to serve reads in time";
+    // Fail over to the next node, but keep this one eligible since it is still healthy
+    _getMonitor()->busyHost(_lastSlaveOkHost);
+
+    resetSlaveOkConn();
+}
+
 DBClientConnection* DBClientReplicaSet::selectNodeUsingTags(
     shared_ptr<ReadPreferenceSetting> readPref) {
     if (checkLastHost(readPref.get())) {
@@ -782,7 +824,7 @@ void DBClientReplicaSet::say(Message& toSend, bool isRetry, string* actualServer
                     lastNodeErrMsg = errMsgBuilder.str();
 
                     LOG(1) << lastNodeErrMsg << endl;
-                    invalidateLastSlaveOkCache();
+                    invalidateLastSlaveOkCache(DBExcep.toStatus());
                     continue;
                 }
 
@@ -865,10 +907,16 @@ void DBClientReplicaSet::checkResponse(const char* data,
         // query could potentially go to a secondary, so see if this is an error (or empty) and
         // retry if we're not past our retry limit.
 
-        if (nReturned == -1 /* no result, maybe network problem */ ||
+        const bool isBusyReply = hasErrField(dataObj) && isStorageBusyReply(dataObj);
+
+        if (nReturned == -1 /* no result, maybe network problem */ || isBusyReply ||
             (hasErrField(dataObj) && !dataObj["code"].eoo() &&
              dataObj["code"].Int() == ErrorCodes::NotMasterOrSecondary)) {
-            if (_lazyState._lastClient == _lastSlaveOkConn.get()) {
+            if (isBusyReply) {
+                if (_lazyState._lastClient == _lastSlaveOkConn.get()) {
+                    isBusy();
+                }
+            } else if (_lazyState._lastClient == _lastSlaveOkConn.get()) {
                 isntSecondary();
             } else if (_lazyState._lastClient == _master.get()) {
                 isntMaster();
@@ -949,11 +997,18 @@ DBClientReplicaSet::runCommandWithMetadataAndTarget(StringData database,
             }
             // We can't move database and command in case this throws
             // and we retry.
-            return std::make_tuple(
-                conn->runCommandWithMetadata(database, command, metadata, commandArgs), conn);
+            auto reply = conn->runCommandWithMetadata(database, command, metadata, commandArgs);
+
+            // Hand the busy reply back as-is once there is no other node left to try.
+            if (retry + 1 < MAX_RETRY && isStorageBusyReply(reply->getCommandReply())) {
+                isBusy();
+                continue;
+            }
+
+            return std::make_tuple(std::move(reply), conn);
         } catch (const DBException& ex) {
             log() << exceptionToStatus();
-            invalidateLastSlaveOkCache();
+            invalidateLastSlaveOkCache(ex.toStatus());
         }
     }
     uasserted(ErrorCodes::NodeNotFound,
@@ -997,7 +1052,16 @@ bool DBClientReplicaSet::call(Message& toSend,
                         *actualServer = conn->getServerAddress();
                     }
 
-                    return conn->call(toSend, response, assertOk, nullptr);
+                    if (!conn->call(toSend, response, assertOk, nullptr)) {
+                        return false;
+                    }
+
+                    if (retry + 1 < MAX_RETRY && isStorageBusyReply(response)) {
+                        isBusy();
+                        continue;
+                    }
+
+                    return true;
                 } catch (const DBException& dbExcep) {
                     LOG(1) << "can't call replica set node " << _lastSlaveOkHost << ": "
                            << causedBy(redact(dbExcep));
@@ -1005,7 +1069,7 @@ bool DBClientReplicaSet::call(Message& toSend,
                     if (actualServer)
                         *actualServer = "";
 
-                    invalidateLastSlaveOkCache();
+                    invalidateLastSlaveOkCache(dbExcep.toStatus());
                 }
             }
 
@@ -1049,6 +1113,16 @@ void DBClientReplicaSet::invalidateLastSlaveOkCache() {
     resetSlaveOkConn();
 }
 
+void DBClientReplicaSet::invalidateLastSlaveOkCache(const Status& status) {
+    // A node that rejected the read as storage busy is healthy, just slow right now.
+    if (status.code() == ErrorCodes::StorageBusy) {
+        isBusy();
+        return;
+    }
+
+    invalidateLastSlaveOkCache();
+}
+
 void DBClientReplicaSet::reset() {
     resetSlaveOkConn();
     _lazyState._lastClient = NULL;
@@ -147,6 +147,10 @@ public:
      */
     void isntSecondary();
 
+    /* this is used to indicate we got a "storage busy" error from the node we last read from.
+     */
+    void isBusy();
+
     // ----- status ------
 
     virtual bool isFailed() const {
@@ -273,6 +277,12 @@ private:
      */
     void invalidateLastSlaveOkCache();
 
+    /**
+     * Same as above, but only marks the host busy instead of failed if the operation was
+     * rejected with StorageBusy.
+     */
+    void invalidateLastSlaveOkCache(const Status& status);
+
     void _authConnection(DBClientConnection* conn);
 
     /**
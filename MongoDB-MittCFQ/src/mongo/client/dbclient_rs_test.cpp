@@ -519,6 +519,93 @@ TEST_F(SecondaryDown, CommandNearest) {
     assertNodeSelected(getReplSet(), ReadPreference::Nearest, getReplSet()->getPrimary());
 }
 
+/**
+ * Setup for 3 member replica set with one secondary rejecting reads as storage busy.
+ */
+class SecondaryBusy : public unittest::Test {
+protected:
+    void setUp() {
+        ReplicaSetMonitor::cleanup();
+
+        _replSet.reset(new MockReplicaSet("test", 3));
+        ConnectionString::setConnectionHook(mongo::MockConnRegistry::get()->getConnStrHook());
+
+        _busyHost = _replSet->getSecondaries().front();
+        _idleHost = _replSet->getSecondaries().back();
+        _replSet->getNode(_busyHost)->setStorageBusy(true);
+    }
+
+    void tearDown() {
+        ReplicaSetMonitor::cleanup();
+        _replSet.reset();
+
+        mongo::ScopedDbConnection::clearPool();
+    }
+
+    MockReplicaSet* getReplSet() {
+        return _replSet.get();
+    }
+
+    /**
+     * Makes the busy secondary the first choice for secondary reads, by having the monitor avoid
+     * the idle one.
+     */
+    void pickBusyHostFirst() {
+        auto monitor = ReplicaSetMonitor::get(_replSet->getSetName());
+        monitor->startOrContinueRefresh().refreshAll();
+        monitor->busyHost(HostAndPort(_idleHost));
+    }
+
+    std::string _busyHost;
+    std::string _idleHost;
+
+private:
+    std::unique_ptr<MockReplicaSet> _replSet;
+};
+
+TEST_F(SecondaryBusy, QuerySecondaryOnly) {
+    MockReplicaSet* replSet = getReplSet();
+    DBClientReplicaSet replConn(replSet->getSetName(), replSet->getHosts(), StringData());
+    pickBusyHostFirst();
+
+    Query query;
+    query.readPref(mongo::ReadPreference::SecondaryOnly, BSONArray());
+
+    // Note: IdentityNS contains the name of the server.
+    unique_ptr<DBClientCursor> cursor = replConn.query(IdentityNS, query);
+    BSONObj doc = cursor->next();
+    ASSERT_EQUALS(_idleHost, doc[HostField.name()].str());
+    ASSERT_EQUALS(1U, replSet->getNode(_busyHost)->getQueryCount());
+}
+
+TEST_F(SecondaryBusy, FindOneSecondaryOnly) {
+    MockReplicaSet* replSet = getReplSet();
+    DBClientReplicaSet replConn(replSet->getSetName(), replSet->getHosts(), StringData());
+    pickBusyHostFirst();
+
+    Query query;
+    query.readPref(mongo::ReadPreference::SecondaryOnly, BSONArray());
+
+    BSONObj doc = replConn.findOne(IdentityNS, query);
+    ASSERT_EQUALS(_idleHost, doc[HostField.name()].str());
+    ASSERT_EQUALS(1U, replSet->getNode(_busyHost)->getQueryCount());
+}
+
+TEST_F(SecondaryBusy, AllSecondariesBusy) {
+    MockReplicaSet* replSet = getReplSet();
+    replSet->getNode(_idleHost)->setStorageBusy(true);
+    DBClientReplicaSet replConn(replSet->getSetName(), replSet->getHosts(), StringData());
+
+    Query query;
+    query.readPref(mongo::ReadPreference::SecondaryOnly, BSONArray());
+
+    // Callers see why the read failed once every member has been tried.
+    ASSERT_THROWS_CODE(
+        replConn.query(IdentityNS, query), AssertionException, ErrorCodes::StorageBusy);
+    ASSERT_THROWS_CODE(
+        replConn.findOne(IdentityNS, query), AssertionException, ErrorCodes::StorageBusy);
+}
+
 /**
  * Warning: Tests running this fixture cannot be run in parallel with other tests
  * that uses ConnectionString::setConnectionHook
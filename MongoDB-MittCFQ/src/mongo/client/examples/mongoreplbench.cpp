@@ -0,0 +1,779 @@
+/*
+ *    Copyright (C) 2017 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+/*
+   How to build and run:
+
+   scons mongoreplbench
+   ./mongoreplbench -h
+*/
+
+#include "mongo/platform/basic.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <boost/filesystem/operations.hpp>
+
+#include "mongo/base/initializer.h"
+#include "mongo/db/jsobj.h"
+#include "mongo/db/json.h"
+#include "mongo/executor/network_interface_factory.h"
+#include "mongo/executor/network_interface_thread_pool.h"
+#include "mongo/executor/remote_command_request.h"
+#include "mongo/executor/task_executor.h"
+#include "mongo/executor/thread_pool_task_executor.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/platform/random.h"
+#include "mongo/rpc/get_status_from_command_result.h"
+#include "mongo/stdx/memory.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/util/mongoutils/str.h"
+#include "mongo/util/net/hostandport.h"
+#include "mongo/util/time_support.h"
+
+using namespace std;
+using namespace mongo;
+using namespace mongoutils;
+
+using executor::RemoteCommandRequest;
+using executor::TaskExecutor;
+
+namespace {
+
+const char kDbName[] = "ycsb";
+const StringData kFieldName = "field0"_sd;
+const double kZipfianTheta = 0.99;
+
+// "p99.9" would not be a valid field name, so the summary uses "p99_9".
+std::string percentileName(double percentile) {
+    std::string name = str::stream() << "p" << percentile;
+    std::replace(name.begin(), name.end(), '.', '_');
+    return name;
+}
+
+/**
+ * Latency histogram with bounded relative error, in the manner of HdrHistogram: values below
+ * 128 have their own bucket and every larger power of two is split into 64 linear sub-buckets,
+ * so a recorded value is reported within 1/64 of its true value.
+ */
+class LatencyHistogram {
+public:
+    LatencyHistogram() : _counts(kSubBuckets + 57 * kHalfSubBuckets) {}
+
+    void record(long long micros) {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        _counts[indexOf(std::max(micros, 0LL))]++;
+        _total++;
+        _max = std::max(_max, micros);
+    }
+
+    long long count() const {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        return _total;
+    }
+
+    long long max() const {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        return _max;
+    }
+
+    /**
+     * Returns the smallest recorded value such that 'percentile' percent of all values are at
+     * or below it, rounded up to the top of its bucket.
+     */
+    long long valueAtPercentile(double percentile) const {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        if (_total == 0)
+            return 0;
+        long long wanted = std::max(1LL, (long long)std::ceil(_total * percentile / 100.0));
+        long long seen = 0;
+        for (size_t i = 0; i < _counts.size(); i++) {
+            seen += _counts[i];
+            if (seen >= wanted)
+                return std::min(highestEquivalentValue(i), _max);
+        }
+        return _max;
+    }
+
+private:
+    static const int kSubBucketBits = 7;
+    static const long long kSubBuckets = 1 << kSubBucketBits;
+    static const long long kHalfSubBuckets = kSubBuckets / 2;
+
+    static size_t indexOf(long long value) {
+        if (value < kSubBuckets)
+            return value;
+        int msb = 63 - __builtin_clzll(value);
+        int shift = msb - (kSubBucketBits - 1);
+        return kSubBuckets + (shift - 1) * kHalfSubBuckets + ((value >> shift) - kHalfSubBuckets);
+    }
+
+    static long long highestEquivalentValue(size_t index) {
+        if (index < static_cast<size_t>(kSubBuckets))
+            return index;
+        int shift = (index - kSubBuckets) / kHalfSubBuckets + 1;
+        long long sub = (index - kSubBuckets) % kHalfSubBuckets + kHalfSubBuckets;
+        return ((sub + 1) << shift) - 1;
+    }
+
+    mutable stdx::mutex _mutex;
+    std::vector<long long> _counts;
+    long long _total = 0;
+    long long _max = 0;
+};
+
+/**
+ * How a read picks the member that serves it.
+ *
+ *   none  - one random member, no deadline; a slow disk shows up in the tail.
+ *   hedge - one random member; if it has not answered within hedgeMillis, the read is sent to
+ *           the next member too and the first answer wins.
+ *   busy  - the read carries a maxTimeMS deadline that the storage layer turns into a MittCFQ
+ *           deadline read. A member that answers StorageBusy is skipped in favour of the next
+ *           one; the last member is asked without a deadline so the read always completes.
+ */
+enum class Strategy { kNone, kHedge, kBusy };
+
+StatusWith<Strategy> parseStrategy(StringData name) {
+    if (name == "none")
+        return Strategy::kNone;
+    if (name == "hedge")
+        return Strategy::kHedge;
+    if (name == "busy")
+        return Strategy::kBusy;
+    return {ErrorCodes::BadValue, str::stream() << "unknown strategy " << name};
+}
+
+struct PhaseStats {
+    LatencyHistogram reads;
+    LatencyHistogram updates;
+    AtomicInt64 readErrors;
+    AtomicInt64 updateErrors;
+    AtomicInt64 busyReplies;
+    AtomicInt64 hedgedReads;
+    AtomicInt64 lateArrivals;
+};
+
+/**
+ * One request of the workload. 'intendedMicros' is when the open-loop schedule wanted it sent;
+ * latency is measured from there rather than from the actual send, which corrects for
+ * coordinated omission when the generator or the executor falls behind.
+ */
+struct Operation {
+    bool isRead = true;
+    std::string key;
+    long long intendedMicros = 0;
+    size_t firstNode = 0;
+
+    stdx::mutex mutex;
+    bool done = false;
+    size_t attempts = 0;
+    size_t pendingWrites = 0;
+    bool writeFailed = false;
+    std::vector<TaskExecutor::CallbackHandle> handles;
+};
+
+/**
+ * Scrambled zipfian key chooser as in YCSB: popularity follows a zipfian law with constant
+ * 0.99, and hashing the rank spreads the popular keys over the whole key space.
+ */
+class ZipfianGenerator {
+public:
+    explicit ZipfianGenerator(long long items) : _items(items) {
+        for (long long i = 1; i <= items; i++)
+            _zetan += 1.0 / std::pow(static_cast<double>(i), kZipfianTheta);
+        double zeta2 = 1.0 + 1.0 / std::pow(2.0, kZipfianTheta);
+        _alpha = 1.0 / (1.0 - kZipfianTheta);
+        _eta = (1.0 - std::pow(2.0 / items, 1.0 - kZipfianTheta)) / (1.0 - zeta2 / _zetan);
+    }
+
+    long long next(PseudoRandom& random) const {
+        double u = random.nextCanonicalDouble();
+        double uz = u * _zetan;
+        long long rank;
+        if (uz < 1.0) {
+            rank = 0;
+        } else if (uz < 1.0 + std::pow(0.5, kZipfianTheta)) {
+            rank = 1;
+        } else {
+            rank = static_cast<long long>(_items * std::pow(_eta * u - _eta + 1, _alpha));
+        }
+        return fnvHash(rank) % _items;
+    }
+
+    static unsigned long long fnvHash(unsigned long long value) {
+        unsigned long long hash = 0xCBF29CE484222325ULL;
+        for (int i = 0; i < 8; i++) {
+            hash ^= value & 0xff;
+            hash *= 1099511628211ULL;
+            value >>= 8;
+        }
+        return hash;
+    }
+
+private:
+    long long _items;
+    double _zetan = 0;
+    double _alpha;
+    double _eta;
+};
+
+class ReplBench {
+public:
+    explicit ReplBench(const BSONObj& options);
+
+    int run();
+
+private:
+    void startNodes();
+    void stopNodes();
+    void waitForNode(const HostAndPort& host);
+    void load();
+    void runPhase(Strategy strategy);
+    void report(Strategy strategy, const PhaseStats& stats, double seconds);
+
+    std::string keyFor(long long record) const {
+        return str::stream() << "user" << ZipfianGenerator::fnvHash(record);
+    }
+
+    StatusWith<BSONObj> runCommand(const HostAndPort& host, const BSONObj& cmd);
+
+    void sendRead(std::shared_ptr<Operation> op, size_t node, bool withDeadline);
+    void onReadResponse(std::shared_ptr<Operation> op,
+                        size_t node,
+                        const TaskExecutor::RemoteCommandCallbackArgs& args);
+    void scheduleHedge(std::shared_ptr<Operation> op);
+    void sendUpdate(std::shared_ptr<Operation> op);
+    void finish(std::shared_ptr<Operation> op, bool ok);
+
+    BSONObj _options;
+    Strategy _strategy = Strategy::kNone;
+    std::unique_ptr<TaskExecutor> _executor;
+    std::vector<HostAndPort> _hosts;
+    std::vector<pid_t> _pids;
+    std::vector<std::string> _mounts;
+    std::string _table;
+    std::string _value;
+    long long _recordCount;
+    Milliseconds _hedgeDelay;
+    Milliseconds _busyDeadline;
+    std::unique_ptr<PhaseStats> _stats;
+    AtomicInt64 _outstanding;
+};
+
+ReplBench::ReplBench(const BSONObj& options)
+    : _options(options.getOwned()),
+      _table(options["table"].eoo() ? "usertable" : options["table"].String()),
+      _value(options["fieldLength"].eoo() ? 1000 : options["fieldLength"].numberInt(), 'x'),
+      _recordCount(options["recordCount"].eoo() ? 100000 : options["recordCount"].numberLong()),
+      _hedgeDelay(options["hedgeMillis"].eoo() ? 10 : options["hedgeMillis"].numberLong()),
+      _busyDeadline(options["busyDeadlineMillis"].eoo()
+                        ? 10
+                        : options["busyDeadlineMillis"].numberLong()) {}
+
+StatusWith<BSONObj> ReplBench::runCommand(const HostAndPort& host, const BSONObj& cmd) {
+    StatusWith<BSONObj> result(ErrorCodes::InternalError, "no response");
+    auto handle = _executor->scheduleRemoteCommand(
+        RemoteCommandRequest(host, kDbName, cmd, nullptr, Seconds(60)),
+        [&result](const TaskExecutor::RemoteCommandCallbackArgs& args) {
+            if (!args.response.isOK()) {
+                result = args.response.status;
+                return;
+            }
+            Status status = getStatusFromCommandResult(args.response.data);
+            if (status.isOK()) {
+                result = args.response.data.getOwned();
+            } else {
+                result = status;
+            }
+        });
+    if (!handle.isOK())
+        return handle.getStatus();
+    _executor->wait(handle.getValue());
+    return result;
+}
+
+void ReplBench::startNodes() {
+    if (!_options["hosts"].eoo()) {
+        for (auto&& host : _options["hosts"].Array())
+            _hosts.push_back(HostAndPort(host.String()));
+        return;
+    }
+
+    const std::string mongod = _options["mongod"].eoo() ? "./mongod" : _options["mongod"].String();
+    const std::string root =
+        _options["dbpathRoot"].eoo() ? "/tmp/mongoreplbench" : _options["dbpathRoot"].String();
+    const int nodes = _options["nodes"].eoo() ? 3 : _options["nodes"].numberInt();
+    const int basePort = _options["basePort"].eoo() ? 27100 : _options["basePort"].numberInt();
+    const long long loopSizeMB = _options["loopSizeMB"].numberLong();
+
+    for (int i = 0; i < nodes; i++) {
+        const std::string dbpath = str::stream() << root << "/node" << i;
+        boost::filesystem::create_directories(dbpath);
+
+        // Each node gets its own loop device so that noise injected on one node's image does
+        // not slow the others down. Needs root; without loopSizeMB the data dirs share a disk.
+        if (loopSizeMB > 0) {
+            const std::string image = str::stream() << root << "/node" << i << ".img";
+            const std::string setup = str::stream()
+                << "truncate -s " << loopSizeMB << "M " << image << " && mkfs.ext4 -q -F "
+                << image << " && mount -o loop " << image << " " << dbpath;
+            uassert(ErrorCodes::OperationFailed,
+                    str::stream() << "could not set up loop device: " << setup,
+                    system(setup.c_str()) == 0);
+            _mounts.push_back(dbpath);
+        }
+
+        const int port = basePort + i;
+        std::vector<std::string> args = {mongod,
+                                         "--port",
+                                         std::to_string(port),
+                                         "--bind_ip",
+                                         "127.0.0.1",
+                                         "--dbpath",
+                                         dbpath,
+                                         "--logpath",
+                                         dbpath + "/mongod.log"};
+        if (!_options["storageEngine"].eoo()) {
+            args.push_back("--storageEngine");
+            args.push_back(_options["storageEngine"].String());
+        }
+        if (!_options["mongodArgs"].eoo()) {
+            for (auto&& arg : _options["mongodArgs"].Array())
+                args.push_back(arg.String());
+        }
+
+        pid_t pid = fork();
+        uassert(ErrorCodes::OperationFailed, "fork failed", pid >= 0);
+        if (pid == 0) {
+            std::vector<char*> argv;
+            for (auto&& arg : args)
+                argv.push_back(const_cast<char*>(arg.c_str()));
+            argv.push_back(nullptr);
+            execvp(argv[0], argv.data());
+            _exit(127);
+        }
+        _pids.push_back(pid);
+        _hosts.push_back(HostAndPort("127.0.0.1", port));
+        cout << "started " << mongod << " pid " << pid << " on port " << port << " dbpath "
+             << dbpath << endl;
+    }
+}
+
+void ReplBench::stopNodes() {
+    for (pid_t pid : _pids) {
+        kill(pid, SIGTERM);
+        waitpid(pid, nullptr, 0);
+    }
+    _pids.clear();
+    for (auto&& mount : _mounts) {
+        const std::string cmd = str::stream() << "umount " << mount;
+        if (system(cmd.c_str()) != 0)
+            cout << "failed to unmount " << mount << endl;
+    }
+    _mounts.clear();
+}
+
+void ReplBench::waitForNode(const HostAndPort& host) {
+    Date_t giveUp = Date_t::now() + Seconds(60);
+    while (true) {
+        auto reply = runCommand(host, BSON("ping" << 1));
+        if (reply.isOK())
+            return;
+        uassert(ErrorCodes::HostUnreachable,
+                str::stream() << host.toString() << " did not come up: " << reply.getStatus().toString(),
+                Date_t::now() < giveUp);
+        sleepmillis(200);
+    }
+}
+
+void ReplBench::load() {
+    if (_options["skipLoad"].trueValue())
+        return;
+
+    // Every member gets the full key set, as a replica would.
+    const long long kBatch = 1000;
+    for (auto&& host : _hosts) {
+        Status dropped = runCommand(host, BSON("drop" << _table)).getStatus();
+        if (dropped != ErrorCodes::NamespaceNotFound)
+            uassertStatusOK(dropped);
+        for (long long first = 0; first < _recordCount; first += kBatch) {
+            BSONArrayBuilder docs;
+            for (long long i = first; i < std::min(first + kBatch, _recordCount); i++)
+                docs.append(BSON("_id" << keyFor(i) << kFieldName << _value));
+            uassertStatusOK(
+                runCommand(host, BSON("insert" << _table << "documents" << docs.arr())));
+        }
+        cout << "loaded " << _recordCount << " records into " << host.toString() << endl;
+    }
+}
+
+void ReplBench::finish(std::shared_ptr<Operation> op, bool ok) {
+    std::vector<TaskExecutor::CallbackHandle> handles;
+    {
+        stdx::lock_guard<stdx::mutex> lk(op->mutex);
+        if (op->done)
+            return;
+        op->done = true;
+        handles.swap(op->handles);
+    }
+
+    long long latency = curTimeMicros64() - op->intendedMicros;
+    if (op->isRead) {
+        if (ok) {
+            _stats->reads.record(latency);
+        } else {
+            _stats->readErrors.fetchAndAdd(1);
+        }
+    } else {
+        if (ok) {
+            _stats->updates.record(latency);
+        } else {
+            _stats->updateErrors.fetchAndAdd(1);
+        }
+    }
+
+    // Losing hedges and the hedge timer are no longer needed.
+    for (auto&& handle : handles)
+        _executor->cancel(handle);
+    _outstanding.fetchAndSubtract(1);
+}
+
+void ReplBench::sendRead(std::shared_ptr<Operation> op, size_t node, bool withDeadline) {
+    BSONObjBuilder cmd;
+    cmd.append("find", _table);
+    cmd.append("filter", BSON("_id" << op->key));
+    cmd.append("limit", 1);
+    cmd.append("singleBatch", true);
+    if (withDeadline)
+        cmd.append("maxTimeMS", durationCount<Milliseconds>(_busyDeadline));
+
+    {
+        stdx::lock_guard<stdx::mutex> lk(op->mutex);
+        op->attempts++;
+    }
+    auto handle = _executor->scheduleRemoteCommand(
+        RemoteCommandRequest(_hosts[node], kDbName, cmd.obj(), nullptr),
+        [this, op, node](const TaskExecutor::RemoteCommandCallbackArgs& args) {
+            onReadResponse(op, node, args);
+        });
+    if (!handle.isOK()) {
+        finish(op, false);
+        return;
+    }
+
+    stdx::lock_guard<stdx::mutex> lk(op->mutex);
+    op->handles.push_back(handle.getValue());
+}
+
+void ReplBench::onReadResponse(std::shared_ptr<Operation> op,
+                               size_t node,
+                               const TaskExecutor::RemoteCommandCallbackArgs& args) {
+    Status status =
+        args.response.isOK() ? getStatusFromCommandResult(args.response.data) : args.response.status;
+    if (status == ErrorCodes::CallbackCanceled)
+        return;
+
+    if (status == ErrorCodes::StorageBusy && _strategy == Strategy::kBusy) {
+        _stats->busyReplies.fetchAndAdd(1);
+        size_t attempts;
+        {
+            stdx::lock_guard<stdx::mutex> lk(op->mutex);
+            if (op->done)
+                return;
+            attempts = op->attempts;
+        }
+        if (attempts < _hosts.size()) {
+            size_t next = (op->firstNode + attempts) % _hosts.size();
+            sendRead(op, next, attempts + 1 < _hosts.size());
+            return;
+        }
+    }
+
+    if (!status.isOK() && _strategy == Strategy::kHedge) {
+        // A failed copy of a hedged read is only fatal once no other copy can still answer.
+        stdx::lock_guard<stdx::mutex> lk(op->mutex);
+        if (op->attempts < 2)
+            return;
+    }
+    finish(op, status.isOK());
+}
+
+void ReplBench::scheduleHedge(std::shared_ptr<Operation> op) {
+    auto handle = _executor->scheduleWorkAt(
+        _executor->now() + _hedgeDelay, [this, op](const TaskExecutor::CallbackArgs& args) {
+            if (!args.status.isOK())
+                return;
+            {
+                stdx::lock_guard<stdx::mutex> lk(op->mutex);
+                if (op->done)
+                    return;
+            }
+            _stats->hedgedReads.fetchAndAdd(1);
+            sendRead(op, (op->firstNode + 1) % _hosts.size(), false);
+        });
+    if (handle.isOK()) {
+        stdx::lock_guard<stdx::mutex> lk(op->mutex);
+        op->handles.push_back(handle.getValue());
+    }
+}
+
+void ReplBench::sendUpdate(std::shared_ptr<Operation> op) {
+    // Members are independent mongods, so an update is applied to each of them and completes
+    // when the slowest one has acknowledged it, like a w:"all" write.
+    const BSONObj cmd = BSON(
+        "update" << _table << "updates"
+                 << BSON_ARRAY(BSON("q" << BSON("_id" << op->key) << "u"
+                                        << BSON("$set" << BSON(kFieldName << _value)))));
+    op->pendingWrites = _hosts.size();
+    for (auto&& host : _hosts) {
+        auto handle = _executor->scheduleRemoteCommand(
+            RemoteCommandRequest(host, kDbName, cmd, nullptr),
+            [this, op](const TaskExecutor::RemoteCommandCallbackArgs& args) {
+                Status status = args.response.isOK()
+                    ? getStatusFromCommandResult(args.response.data)
+                    : args.response.status;
+                bool last;
+                bool failed;
+                {
+                    stdx::lock_guard<stdx::mutex> lk(op->mutex);
+                    op->writeFailed = op->writeFailed || !status.isOK();
+                    last = --op->pendingWrites == 0;
+                    failed = op->writeFailed;
+                }
+                if (last)
+                    finish(op, !failed);
+            });
+        if (!handle.isOK()) {
+            finish(op, false);
+            return;
+        }
+    }
+}
+
+void ReplBench::runPhase(Strategy strategy) {
+    _stats = stdx::make_unique<PhaseStats>();
+    PhaseStats& stats = *_stats;
+    _strategy = strategy;
+
+    const double opsPerSec = _options["opsPerSec"].eoo() ? 1000 : _options["opsPerSec"].number();
+    const long long durationMicros =
+        (_options["durationSecs"].eoo() ? 30 : _options["durationSecs"].numberLong()) * 1000 * 1000;
+    const double readProportion =
+        _options["readProportion"].eoo() ? 1.0 : _options["readProportion"].number();
+    const bool zipfian = _options["distribution"].str() == "zipfian";
+    const bool poisson = _options["arrivals"].str() == "poisson";
+
+    // Every phase replays the same sequence of keys, members and arrival gaps.
+    PseudoRandom random(
+        static_cast<int64_t>(_options["seed"].eoo() ? 1 : _options["seed"].numberLong()));
+    std::unique_ptr<ZipfianGenerator> zipf;
+    if (zipfian)
+        zipf = stdx::make_unique<ZipfianGenerator>(_recordCount);
+
+    const long long start = curTimeMicros64() + 10 * 1000;
+    double offset = 0;
+    while (offset < durationMicros) {
+        auto op = std::make_shared<Operation>();
+        op->intendedMicros = start + static_cast<long long>(offset);
+        op->isRead = random.nextCanonicalDouble() < readProportion;
+        op->key = keyFor(zipf ? zipf->next(random) : random.nextInt64(_recordCount));
+        op->firstNode = random.nextInt32(static_cast<int32_t>(_hosts.size()));
+
+        double gap = 1e6 / opsPerSec;
+        if (poisson)
+            gap = -std::log(1.0 - random.nextCanonicalDouble()) * gap;
+        offset += gap;
+
+        long long now = curTimeMicros64();
+        if (op->intendedMicros > now) {
+            sleepmicros(op->intendedMicros - now);
+        } else if (now - op->intendedMicros > 1000) {
+            stats.lateArrivals.fetchAndAdd(1);
+        }
+
+        _outstanding.fetchAndAdd(1);
+        if (!op->isRead) {
+            sendUpdate(op);
+        } else {
+            sendRead(op, op->firstNode, strategy == Strategy::kBusy && _hosts.size() > 1);
+            if (strategy == Strategy::kHedge && _hosts.size() > 1)
+                scheduleHedge(op);
+        }
+    }
+
+    Date_t giveUp = Date_t::now() + Seconds(60);
+    while (_outstanding.load() > 0 && Date_t::now() < giveUp)
+        sleepmillis(10);
+    if (_outstanding.load() > 0) {
+        cout << "giving up on " << _outstanding.load() << " outstanding operations" << endl;
+        uasserted(ErrorCodes::ExceededTimeLimit, "operations did not complete");
+    }
+
+    report(strategy, stats, durationMicros / 1e6);
+}
+
+void ReplBench::report(Strategy strategy, const PhaseStats& stats, double seconds) {
+    const char* name =
+        strategy == Strategy::kNone ? "none" : strategy == Strategy::kHedge ? "hedge" : "busy";
+    const std::vector<double> percentiles = {50, 90, 95, 99, 99.9, 99.99};
+
+    auto line = [&](const char* op, const LatencyHistogram& h, long long errors) {
+        cout << setw(6) << name << setw(8) << op << setw(9) << h.count() << setw(8) << errors
+             << setw(10) << fixed << setprecision(0) << h.count() / seconds;
+        for (double p : percentiles)
+            cout << setw(9) << h.valueAtPercentile(p);
+        cout << setw(9) << h.max() << endl;
+    };
+
+    cout << setw(6) << "strat" << setw(8) << "op" << setw(9) << "count" << setw(8) << "errors"
+         << setw(10) << "ops/s";
+    for (double p : percentiles)
+        cout << setw(9) << std::string(str::stream() << "p" << p);
+    cout << setw(9) << "max" << "   (latencies in micros)" << endl;
+    line("read", stats.reads, stats.readErrors.load());
+    if (stats.updates.count() > 0 || stats.updateErrors.load() > 0)
+        line("update", stats.updates, stats.updateErrors.load());
+    cout << "  busyReplies: " << stats.busyReplies.load()
+         << " hedgedReads: " << stats.hedgedReads.load()
+         << " lateArrivals: " << stats.lateArrivals.load() << endl;
+
+    // One machine-readable line per phase for plotting scripts.
+    BSONObjBuilder summary;
+    summary.append("strategy", name);
+    BSONObjBuilder reads(summary.subobjStart("readMicros"));
+    for (double p : percentiles)
+        reads.append(percentileName(p), stats.reads.valueAtPercentile(p));
+    reads.append("max", stats.reads.max());
+    reads.done();
+    summary.append("reads", stats.reads.count());
+    summary.append("readErrors", stats.readErrors.load());
+    summary.append("updates", stats.updates.count());
+    summary.append("updateErrors", stats.updateErrors.load());
+    summary.append("busyReplies", stats.busyReplies.load());
+    summary.append("hedgedReads", stats.hedgedReads.load());
+    cout << "summary: " << summary.obj().jsonString() << endl;
+}
+
+int ReplBench::run() {
+    std::vector<Strategy> strategies;
+    if (_options["strategies"].eoo()) {
+        strategies = {Strategy::kNone, Strategy::kHedge, Strategy::kBusy};
+    } else {
+        for (auto&& name : _options["strategies"].Array())
+            strategies.push_back(uassertStatusOK(parseStrategy(name.String())));
+    }
+
+    auto net = executor::makeNetworkInterface("ReplBench");
+    auto netPtr = net.get();
+    _executor = stdx::make_unique<executor::ThreadPoolTaskExecutor>(
+        stdx::make_unique<executor::NetworkInterfaceThreadPool>(netPtr), std::move(net));
+    _executor->startup();
+
+    int exitCode = EXIT_SUCCESS;
+    try {
+        startNodes();
+        for (auto&& host : _hosts)
+            waitForNode(host);
+        load();
+        for (auto strategy : strategies)
+            runPhase(strategy);
+    } catch (const DBException& e) {
+        cout << "caught DBException " << e.toString() << endl;
+        exitCode = EXIT_FAILURE;
+    }
+
+    _executor->shutdown();
+    _executor->join();
+    stopNodes();
+    return exitCode;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[], char** envp) {
+    if (argc > 1) {
+        cout << "\n"
+                "usage:\n"
+                "\n"
+                "  mongoreplbench < myjsonconfigfile\n"
+                "\n"
+                "  {\n"
+                "    hosts:[<host:port>...],  // use running mongods instead of starting them\n"
+                "    mongod:<path>,           // mongod binary to start (default ./mongod)\n"
+                "    nodes:<n>,               // mongods to start (default 3)\n"
+                "    basePort:<n>,            // port of the first one (default 27100)\n"
+                "    dbpathRoot:<path>,       // data dirs go below this "
+                "(default /tmp/mongoreplbench)\n"
+                "    loopSizeMB:<n>,          // back each data dir with its own loop device of "
+                "this size (needs root)\n"
+                "    storageEngine:<name>,    // passed to mongod\n"
+                "    mongodArgs:[<arg>...],   // more mongod arguments\n"
+                "    recordCount:<n>,         // keys to load (default 100000)\n"
+                "    fieldLength:<n>,         // bytes per record (default 1000)\n"
+                "    skipLoad:<bool>,         // reuse the data already loaded\n"
+                "    distribution:<name>,     // uniform (default) or zipfian\n"
+                "    readProportion:<x>,      // the rest are updates (default 1.0)\n"
+                "    opsPerSec:<n>,           // open-loop arrival rate (default 1000)\n"
+                "    arrivals:<name>,         // uniform (default) or poisson gaps\n"
+                "    durationSecs:<n>,        // length of each phase (default 30)\n"
+                "    strategies:[<name>...],  // none, hedge, busy (default all three)\n"
+                "    hedgeMillis:<n>,         // hedge after this long (default 10)\n"
+                "    busyDeadlineMillis:<n>,  // deadline of busy-strategy reads (default 10)\n"
+                "    seed:<n>                 // workload seed, shared by all phases\n"
+                "  }\n"
+                "\n"
+                "mongoreplbench replays a YCSB-style read/update mix against a set of mongods in\n"
+                "open loop: requests are sent on schedule whether or not earlier ones have\n"
+                "finished, and latencies are measured from the scheduled time. Each strategy\n"
+                "runs as its own phase over the same workload.\n"
+             << endl;
+        return EXIT_SUCCESS;
+    }
+
+    runGlobalInitializersOrDie(argc, argv, envp);
+
+    std::string input((std::istreambuf_iterator<char>(cin)), std::istreambuf_iterator<char>());
+    BSONObj options;
+    try {
+        options = fromjson(input.empty() ? "{}" : input);
+    } catch (const DBException&) {
+        cout << "couldn't parse json options. input was:\n|" << input << "|" << endl;
+        return EXIT_FAILURE;
+    }
+    cout << "parsed options:\n" << options.toString() << endl;
+
+    return ReplBench(options).run();
+}
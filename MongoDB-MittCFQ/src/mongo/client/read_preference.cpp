@@ -53,6 +53,7 @@ const char kPrimaryPreferred[] = "primaryPreferred";
 const char kSecondaryOnly[] = "secondary";
 const char kSecondaryPreferred[] = "secondaryPreferred";
 const char kNearest[] = "nearest";
+const char kLeastBusy[] = "leastBusy";
 
 StringData readPreferenceName(ReadPreference pref) {
     switch (pref) {
@@ -66,6 +67,8 @@ StringData readPreferenceName(ReadPreference pref) {
             return StringData(kSecondaryPreferred);
         case ReadPreference::Nearest:
             return StringData(kNearest);
+        case ReadPreference::LeastBusy:
+            return StringData(kLeastBusy);
         default:
             MONGO_UNREACHABLE;
     }
@@ -82,6 +85,8 @@ StatusWith<ReadPreference> parseReadPreferenceMode(StringData prefStr) {
         return ReadPreference::SecondaryPreferred;
     } else if (prefStr == kNearest) {
         return ReadPreference::Nearest;
+    } else if (prefStr == kLeastBusy) {
+        return ReadPreference::LeastBusy;
     }
     return Status(ErrorCodes::FailedToParse,
                   str::stream() << "Could not parse $readPreference mode '" << prefStr
@@ -93,8 +98,10 @@ StatusWith<ReadPreference> parseReadPreferenceMode(StringData prefStr) {
                                 << kSecondaryOnly
                                 << "', '"
                                 << kSecondaryPreferred
-                                << "', and '"
+                                << "', '"
                                 << kNearest
+                                << "', and '"
+                                << kLeastBusy
                                 << "' are supported.");
 }
 
@@ -65,6 +65,12 @@ enum class ReadPreference {
      * Read from any member.
      */
     Nearest,
+
+    /**
+     * Read from the member whose storage reads are predicted to queue the least, as reported by
+     * each member in its isMaster response. Tags are applied as for Nearest.
+     */
+    LeastBusy,
 };
 
 /**
@@ -146,7 +152,8 @@ struct ReadPreferenceSetting {
      * Parses a ReadPreferenceSetting from a BSON document of the form:
      * { mode: <mode>, tags: <array of tags>, maxStalenessMS: Number }. The 'mode' element must a
      * string equal to either
-     * "primary", "primaryPreferred", "secondary", "secondaryPreferred", or "nearest". Although
+     * "primary", "primaryPreferred", "secondary", "secondaryPreferred", "nearest", or
+     * "leastBusy". Although
      * the tags array is intended to be an array of unique BSON documents, no further validation
      * is performed on it other than checking that it is an array, and that it is empty if
      * 'mode' is 'primary'.
@@ -199,6 +199,8 @@ TEST(ReadPreferenceSetting, Roundtrip) {
                                                            << BSON("foo"
                                                                    << "bar"))),
                                          minMaxStaleness));
+
+    checkRoundtrip(ReadPreferenceSetting(ReadPreference::LeastBusy, TagSet()));
 }
 
 }  // namespace
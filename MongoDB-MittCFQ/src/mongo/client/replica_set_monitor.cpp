@@ -91,6 +91,10 @@ const int64_t unknownLatency = numeric_limits<int64_t>::max();
 const ReadPreferenceSetting kPrimaryOnlyReadPreference(ReadPreference::PrimaryOnly, TagSet());
 const Milliseconds kFindHostMaxBackOffTime(500);
 
+// How long reads avoid a host after it rejected one as too busy. Long enough to ride out a burst
+// of contention on its disk, short enough that the host is retried soon after it recovers.
+const Milliseconds kBusyHostAvoidancePeriod(500);
+
 // TODO: Move to ReplicaSetMonitorManager
 ReplicaSetMonitor::ConfigChangeHook asyncConfigChangeHook;
 ReplicaSetMonitor::ConfigChangeHook syncConfigChangeHook;
@@ -114,6 +118,12 @@ bool compareLatencies(const Node* lhs, const Node* rhs) {
     return lhs->latencyMicros < rhs->latencyMicros;
 }
 
+bool compareStorageDelays(const Node* lhs, const Node* rhs) {
+    if (lhs->storageDelayMicros != rhs->storageDelayMicros)
+        return lhs->storageDelayMicros < rhs->storageDelayMicros;
+    return compareLatencies(lhs, rhs);
+}
+
 bool hostsEqual(const Node& lhs, const HostAndPort& rhs) {
     return lhs.host == rhs;
 }
@@ -318,6 +328,14 @@ void ReplicaSetMonitor::failedHost(const HostAndPort& host) {
     DEV _state->checkInvariants();
 }
 
+void ReplicaSetMonitor::busyHost(const HostAndPort& host) {
+    stdx::lock_guard<stdx::mutex> lk(_state->mutex);
+    Node* node = _state->findNode(host);
+    if (node)
+        node->markBusy(Date_t::now());
+    DEV _state->checkInvariants();
+}
+
 bool ReplicaSetMonitor::isPrimary(const HostAndPort& host) const {
     stdx::lock_guard<stdx::mutex> lk(_state->mutex);
     Node* node = _state->findNode(host);
@@ -421,6 +439,8 @@ void ReplicaSetMonitor::appendInfo(BSONObjBuilder& bsonObjBuilder) const {
             pingTimeMillis = node.latencyMicros / 1000;
         }
         builder.append("pingTimeMillis", pingTimeMillis);
+        builder.append("busyReplies", node.busyReplies);
+        builder.append("storageDelayMicros", node.storageDelayMicros);
 
         if (!node.tags.isEmpty()) {
             builder.append("tags", node.tags);
@@ -864,6 +884,9 @@ void IsMasterReply::parse(const BSONObj& obj) {
 
             uassertStatusOK(bsonExtractOpTimeField(lastWriteField, "opTime", &opTime));
         }
+
+        storageDelayMicros =
+            raw.getObjectField("storageLoad")["predictedReadDelayMicros"].numberLong();
     } catch (const std::exception& e) {
         ok = false;
         log() << "exception while parsing isMaster reply: " << e.what() << " " << obj;
@@ -879,6 +902,14 @@ void Node::markFailed() {
     isMaster = false;
 }
 
+void Node::markBusy(Date_t now) {
+    LOG(1) << "Host " << host << " is too busy to serve reads in time, avoiding it for "
+           << kBusyHostAvoidancePeriod;
+
+    busyUntil = now + kBusyHostAvoidancePeriod;
+    busyReplies++;
+}
+
 bool Node::matches(const ReadPreference pref) const {
     if (!isUp)
         return false;
@@ -939,6 +970,8 @@ void Node::update(const IsMasterReply& reply) {
     LOG(3) << "Updating " << host << " opTime to " << reply.opTime;
     opTime = reply.opTime;
     lastWriteDateUpdateTime = Date_t::now();
+
+    storageDelayMicros = reply.storageDelayMicros;
 }
 
 SetState::SetState(StringData name, const std::set<HostAndPort>& seedNodes)
@@ -999,7 +1032,8 @@ HostAndPort SetState::getMatchingHost(const ReadPreferenceSetting& criteria) con
 
         // The difference between these is handled by Node::matches
         case ReadPreference::SecondaryOnly:
-        case ReadPreference::Nearest: {
+        case ReadPreference::Nearest:
+        case ReadPreference::LeastBusy: {
             stdx::function<bool(const Node&)> matchNode = [](const Node& node) -> bool {
                 return true;
             };
@@ -1056,6 +1090,26 @@ HostAndPort SetState::getMatchingHost(const ReadPreferenceSetting& criteria) con
                 if (matchingNodes.empty()) {
                     continue;
                 }
+
+                // Nodes that recently rejected a read as too busy are only used if every
+                // matching node is busy, and then the one that rejected a read longest ago.
+                const Date_t now = Date_t::now();
+                auto firstBusy = std::stable_partition(
+                    matchingNodes.begin(), matchingNodes.end(), [now](const Node* node) {
+                        return !node->isBusy(now);
+                    });
+                if (firstBusy != matchingNodes.begin()) {
+                    matchingNodes.erase(firstBusy, matchingNodes.end());
+                } else {
+                    const Node* leastBusy =
+                        *std::min_element(matchingNodes.begin(),
+                                          matchingNodes.end(),
+                                          [](const Node* a, const Node* b) {
+                                              return a->busyUntil < b->busyUntil;
+                                          });
+                    return leastBusy->host;
+                }
+
                 if (matchingNodes.size() == 1) {
                     return matchingNodes.front()->host;
                 }
@@ -1081,11 +1135,17 @@ HostAndPort SetState::getMatchingHost(const ReadPreferenceSetting& criteria) con
                 }
 
                 // If there are multiple nodes satisfying the minOpTime, next order by latency
-                // and don't consider hosts further than a threshold from the closest.
-                std::sort(matchingNodes.begin(), matchingNodes.end(), compareLatencies);
+                // and don't consider hosts further than a threshold from the closest. LeastBusy
+                // orders by predicted storage delay instead, with the same threshold.
+                const bool byStorageDelay = criteria.pref == ReadPreference::LeastBusy;
+                std::sort(matchingNodes.begin(),
+                          matchingNodes.end(),
+                          byStorageDelay ? compareStorageDelays : compareLatencies);
                 for (size_t i = 1; i < matchingNodes.size(); i++) {
-                    int64_t distance =
-                        matchingNodes[i]->latencyMicros - matchingNodes[0]->latencyMicros;
+                    int64_t distance = byStorageDelay
+                        ? matchingNodes[i]->storageDelayMicros -
+                            matchingNodes[0]->storageDelayMicros
+                        : matchingNodes[i]->latencyMicros - matchingNodes[0]->latencyMicros;
                     if (distance >= latencyThresholdMicros) {
                         // this node and all remaining ones are too far away
                         matchingNodes.erase(matchingNodes.begin() + i, matchingNodes.end());
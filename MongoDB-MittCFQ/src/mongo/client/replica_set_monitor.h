@@ -113,6 +113,13 @@ public:
      */
     void failedHost(const HostAndPort& host);
 
+    /**
+     * Notifies this Monitor that a host rejected a read because its storage could not serve it
+     * within its deadline (ErrorCodes::StorageBusy). The host stays up, but for a short while
+     * reads are sent to other matching hosts if there are any.
+     */
+    void busyHost(const HostAndPort& host);
+
     /**
      * Returns true if this node is the master based ONLY on local data. Be careful, return may
      * be stale.
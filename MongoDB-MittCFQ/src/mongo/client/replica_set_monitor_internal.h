@@ -75,6 +75,7 @@ struct ReplicaSetMonitor::IsMasterReply {
     BSONObj tags;
     int minWireVersion{};
     int maxWireVersion{};
+    int64_t storageDelayMicros{};  // "storageLoad.predictedReadDelayMicros", 0 if not reported
 
     // remaining fields aren't in isMaster reply, but are known to caller.
     HostAndPort host;
@@ -95,6 +96,16 @@ public:
 
         void markFailed();
 
+        /**
+         * Records that this node rejected a read as too busy. Reads avoid it until 'busyUntil'
+         * if another node can serve them.
+         */
+        void markBusy(Date_t now);
+
+        bool isBusy(Date_t now) const {
+            return now < busyUntil;
+        }
+
         bool matches(const ReadPreference pref) const;
 
         /**
@@ -133,6 +144,9 @@ public:
         Date_t lastWriteDateUpdateTime{};  // set to the local system's time at the time of updating
                                            // lastWriteDate
         repl::OpTime opTime{};             // from isMasterReply
+        Date_t busyUntil{};                // see markBusy()
+        int64_t busyReplies{};             // number of StorageBusy replies from this node
+        int64_t storageDelayMicros{};      // from isMasterReply, already smoothed by the node
     };
 
     typedef std::vector<Node> Nodes;
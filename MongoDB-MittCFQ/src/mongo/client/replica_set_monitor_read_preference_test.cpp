@@ -207,6 +207,50 @@ TEST(ReplSetMonitorReadPref, SecOnly) {
     ASSERT_EQUALS("a", host.host());
 }
 
+TEST(ReplSetMonitorReadPref, SecOnlyAvoidsBusyNode) {
+    vector<Node> nodes = getThreeMemberWithTags();
+    TagSet tags(getDefaultTagSet());
+
+    nodes[0].markBusy(Date_t::now());
+
+    bool isPrimarySelected = false;
+    HostAndPort host =
+        selectNode(nodes, mongo::ReadPreference::SecondaryOnly, tags, 1, &isPrimarySelected);
+
+    ASSERT(!isPrimarySelected);
+    ASSERT_EQUALS("c", host.host());
+}
+
+TEST(ReplSetMonitorReadPref, SecOnlyAllBusy) {
+    vector<Node> nodes = getThreeMemberWithTags();
+    TagSet tags(getDefaultTagSet());
+
+    nodes[0].markBusy(Date_t::now());
+    nodes[2].markBusy(Date_t::now());
+
+    bool isPrimarySelected = false;
+    HostAndPort host =
+        selectNode(nodes, mongo::ReadPreference::SecondaryOnly, tags, 1, &isPrimarySelected);
+
+    ASSERT(!isPrimarySelected);
+    ASSERT(!host.empty());
+}
+
+TEST(ReplSetMonitorReadPref, SecOnlyAllBusyPicksLeastRecentlyBusy) {
+    vector<Node> nodes = getThreeMemberWithTags();
+    TagSet tags(getDefaultTagSet());
+
+    nodes[0].markBusy(Date_t::now() - Milliseconds(100));
+    nodes[2].markBusy(Date_t::now());
+
+    bool isPrimarySelected = false;
+    HostAndPort host =
+        selectNode(nodes, mongo::ReadPreference::SecondaryOnly, tags, 1, &isPrimarySelected);
+
+    ASSERT(!isPrimarySelected);
+    ASSERT_EQUALS("a", host.host());
+}
+
 TEST(ReplSetMonitorReadPref, SecOnlyOnlyPriOk) {
     vector<Node> nodes = getThreeMemberWithTags();
     TagSet tags(getDefaultTagSet());
@@ -298,6 +342,27 @@ TEST(ReplSetMonitorReadPref, NearestOneLocal) {
     ASSERT(!isPrimarySelected);
 }
 
+TEST(ReplSetMonitorReadPref, LeastBusyPicksLowestStorageDelay) {
+    vector<Node> nodes = getThreeMemberWithTags();
+    TagSet tags(getDefaultTagSet());
+
+    // The closest node has the slowest disk.
+    nodes[0].latencyMicros = 1 * 1000;
+    nodes[1].latencyMicros = 2 * 1000;
+    nodes[2].latencyMicros = 3 * 1000;
+
+    nodes[0].storageDelayMicros = 30 * 1000;
+    nodes[1].storageDelayMicros = 20 * 1000;
+    nodes[2].storageDelayMicros = 10 * 1000;
+
+    bool isPrimarySelected = false;
+    HostAndPort host =
+        selectNode(nodes, mongo::ReadPreference::LeastBusy, tags, 3, &isPrimarySelected);
+
+    ASSERT_EQUALS("c", host.host());
+    ASSERT(!isPrimarySelected);
+}
+
 TEST(ReplSetMonitorReadPref, PriOnlyWithTagsNoMatch) {
     vector<Node> nodes = getThreeMemberWithTags();
     TagSet tags(getP2TagSet());
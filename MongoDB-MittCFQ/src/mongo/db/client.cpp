@@ -84,6 +84,18 @@ void Client::initThread(const char* desc, ServiceContext* service, transport::Se
     *currentClient.get() = service->makeClient(fullDesc, session);
 }
 
+void Client::setCurrent(ServiceContext::UniqueClient client) {
+    invariant(client);
+    invariant(currentClient.getMake()->get() == nullptr);
+    setThreadName(client->desc().c_str());
+    *currentClient.get() = std::move(client);
+}
+
+ServiceContext::UniqueClient Client::releaseCurrent() {
+    invariant(currentClient.get());
+    return std::move(*currentClient.get());
+}
+
 void Client::destroy() {
     invariant(currentClient.get());
     invariant(currentClient.get()->get());
@@ -83,6 +83,18 @@ public:
 
     static Client* getCurrent();
 
+    /**
+     * Moves "client" into TLS for the current thread, which must not have a Client already, and
+     * names the thread after it. Lets a pool thread run work on behalf of a client it does not
+     * own; releaseCurrent() takes the Client back.
+     */
+    static void setCurrent(ServiceContext::UniqueClient client);
+
+    /**
+     * Removes the Client from TLS for the current thread and returns it.
+     */
+    static ServiceContext::UniqueClient releaseCurrent();
+
     bool getIsLocalHostConnection() {
         if (!hasRemote()) {
             return false;
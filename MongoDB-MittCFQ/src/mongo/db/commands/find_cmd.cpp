@@ -30,6 +30,7 @@
 
 #include "mongo/platform/basic.h"
 
+#include <boost/optional.hpp>
 #include <memory>
 
 #include "mongo/base/disallow_copying.h"
@@ -39,6 +40,7 @@
 #include "mongo/db/client.h"
 #include "mongo/db/clientcursor.h"
 #include "mongo/db/commands.h"
+#include "mongo/db/commands/hedged_read.h"
 #include "mongo/db/db_raii.h"
 #include "mongo/db/exec/working_set_common.h"
 #include "mongo/db/matcher/extensions_callback_real.h"
@@ -290,12 +292,14 @@ public:
         std::unique_ptr<CanonicalQuery> cq = std::move(statusWithCQ.getValue());
 
         // Acquire locks. If the query is on a view, we release our locks and convert the query
-        // request into an aggregation command.
-        AutoGetCollectionOrViewForRead ctx(txn, nss);
-        Collection* collection = ctx.getCollection();
-        if (ctx.getView()) {
+        // request into an aggregation command. The locks are also released early if a busy read
+        // is forwarded to another member of the replica set.
+        boost::optional<AutoGetCollectionOrViewForRead> ctx;
+        ctx.emplace(txn, nss);
+        Collection* collection = ctx->getCollection();
+        if (ctx->getView()) {
             // Relinquish locks. The aggregation command will re-acquire them.
-            ctx.releaseLocksForView();
+            ctx->releaseLocksForView();
 
             // Convert the find command into an aggregation using $match (and other stages, as
             // necessary), if possible.
@@ -366,6 +370,30 @@ public:
         // Throw an assertion if query execution fails for any reason.
         if (PlanExecutor::FAILURE == state || PlanExecutor::DEAD == state) {
             firstBatch.abandon();
+            if (WorkingSetCommon::isStorageBusyStatusMemberObject(obj)) {
+                const Status busyStatus = WorkingSetCommon::getMemberObjectStatus(obj);
+                if (!HedgedReadForwarder::canForward(txn, cmdObj, *exec->getCanonicalQuery())) {
+                    // Retriable; the client is expected to retry on another member.
+                    return appendCommandStatus(result, busyStatus);
+                }
+
+                // Let another member answer instead. The executor must go before the locks it
+                // was registered under, and no locks may be held across the network call.
+                exec.reset();
+                ctx = boost::none;
+
+                auto swReply = HedgedReadForwarder::get(txn)->forwardFind(txn, dbname, cmdObj);
+                if (!swReply.isOK()) {
+                    // An operation that was killed or ran out of time while forwarding says so.
+                    const Status interruptStatus = txn->checkForInterruptNoAssert();
+                    return appendCommandStatus(result,
+                                               interruptStatus.isOK() ? busyStatus
+                                                                      : interruptStatus);
+                }
+                result.appendElements(swReply.getValue());
+                return true;
+            }
+
             error() << "Plan executor error during find command: " << PlanExecutor::statestr(state)
                     << ", stats: " << redact(Explain::getWinningPlanStats(exec.get()));
 
@@ -542,6 +542,10 @@ public:
         if (PlanExecutor::FAILURE == *state || PlanExecutor::DEAD == *state) {
             nextBatch->abandon();
 
+            if (WorkingSetCommon::isStorageBusyStatusMemberObject(obj)) {
+                return WorkingSetCommon::getMemberObjectStatus(obj);
+            }
+
             error() << "GetMore command executor error: " << PlanExecutor::statestr(*state)
                     << ", stats: " << redact(Explain::getWinningPlanStats(exec));
 
@@ -0,0 +1,276 @@
+/**
+ *    Copyright (C) 2016 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#define MONGO_LOG_DEFAULT_COMPONENT ::mongo::logger::LogComponent::kQuery
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/commands/hedged_read.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "mongo/base/counter.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/commands/server_status_metric.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/query/canonical_query.h"
+#include "mongo/db/repl/replication_coordinator.h"
+#include "mongo/db/server_parameters.h"
+#include "mongo/db/service_context.h"
+#include "mongo/executor/network_interface_factory.h"
+#include "mongo/executor/network_interface_thread_pool.h"
+#include "mongo/executor/remote_command_request.h"
+#include "mongo/executor/remote_command_response.h"
+#include "mongo/executor/thread_pool_task_executor.h"
+#include "mongo/rpc/get_status_from_command_result.h"
+#include "mongo/rpc/metadata/server_selection_metadata.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/memory.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/util/log.h"
+#include "mongo/util/net/hostandport.h"
+
+namespace mongo {
+
+using executor::NetworkInterfaceThreadPool;
+using executor::RemoteCommandRequest;
+using executor::RemoteCommandResponse;
+using executor::TaskExecutor;
+using executor::ThreadPoolTaskExecutor;
+
+namespace {
+
+const auto getHedgedReadForwarder = ServiceContext::declareDecoration<HedgedReadForwarder>();
+
+// Whether a secondary-ok find by _id that fails with StorageBusy is forwarded to another member.
+MONGO_EXPORT_SERVER_PARAMETER(hedgeBusyReads, bool, false);
+
+// Upper bound on the time spent waiting for each member a busy read is forwarded to. The
+// operation's own maxTimeMS applies as well.
+MONGO_EXPORT_SERVER_PARAMETER(hedgedReadTimeoutMS, int, 1000);
+
+Counter64 hedgedReadsForwarded;
+Counter64 hedgedReadsSucceeded;
+Counter64 hedgedReadsFailed;
+
+ServerStatusMetricField<Counter64> displayHedgedReadsForwarded("hedgedReads.forwarded",
+                                                               &hedgedReadsForwarded);
+ServerStatusMetricField<Counter64> displayHedgedReadsSucceeded("hedgedReads.succeeded",
+                                                               &hedgedReadsSucceeded);
+ServerStatusMetricField<Counter64> displayHedgedReadsFailed("hedgedReads.failed",
+                                                            &hedgedReadsFailed);
+
+}  // namespace
+
+const char HedgedReadForwarder::kHedgedReadFieldName[] = "$hedgedRead";
+
+HedgedReadForwarder::HedgedReadForwarder() = default;
+
+HedgedReadForwarder::HedgedReadForwarder(std::unique_ptr<TaskExecutor> executor)
+    : _executor(std::move(executor)) {
+    _executor->startup();
+}
+
+HedgedReadForwarder::~HedgedReadForwarder() {
+    shutdown();
+}
+
+HedgedReadForwarder* HedgedReadForwarder::get(ServiceContext* service) {
+    return &getHedgedReadForwarder(service);
+}
+
+HedgedReadForwarder* HedgedReadForwarder::get(OperationContext* txn) {
+    return get(txn->getServiceContext());
+}
+
+bool HedgedReadForwarder::canForward(OperationContext* txn,
+                                     const BSONObj& cmdObj,
+                                     const CanonicalQuery& cq) {
+    if (!hedgeBusyReads.load()) {
+        return false;
+    }
+
+    // Never forward a read that was itself forwarded to us.
+    if (cmdObj.hasField(kHedgedReadFieldName)) {
+        return false;
+    }
+
+    if (repl::ReplicationCoordinator::get(txn)->getReplicationMode() !=
+        repl::ReplicationCoordinator::modeReplSet) {
+        return false;
+    }
+
+    // The peer we pick may be a secondary.
+    if (!rpc::ServerSelectionMetadata::get(txn).canRunOnSecondary()) {
+        return false;
+    }
+
+    // A find by _id returns at most one document, so the peer answers in a single batch and
+    // does not leave behind a cursor that the client would try to getMore from us.
+    const QueryRequest& qr = cq.getQueryRequest();
+    if (!CanonicalQuery::isSimpleIdQuery(qr.getFilter()) || qr.isTailable()) {
+        return false;
+    }
+    if (qr.getBatchSize() && *qr.getBatchSize() == 0) {
+        return false;
+    }
+
+    return true;
+}
+
+StatusWith<BSONObj> HedgedReadForwarder::forwardFind(OperationContext* txn,
+                                                     const std::string& dbname,
+                                                     const BSONObj& cmdObj) {
+    const std::vector<HostAndPort> members =
+        repl::ReplicationCoordinator::get(txn)->getReadableMembersByPing();
+    if (members.empty()) {
+        return Status(ErrorCodes::StorageBusy,
+                      "storage is busy and no other readable member is available");
+    }
+
+    TaskExecutor* executor = _getExecutor();
+    if (!executor) {
+        return Status(ErrorCodes::ShutdownInProgress, "hedged read forwarding is shut down");
+    }
+
+    BSONObjBuilder cmdBob;
+    cmdBob.appendElements(cmdObj);
+    cmdBob.append(kHedgedReadFieldName, true);
+    const BSONObj forwardedCmd = cmdBob.obj();
+
+    BSONObjBuilder metadataBob;
+    Status metadataStatus =
+        rpc::ServerSelectionMetadata(true, boost::none).writeToMetadata(&metadataBob);
+    if (!metadataStatus.isOK()) {
+        return metadataStatus;
+    }
+    const BSONObj metadata = metadataBob.obj();
+
+    Status lastStatus(ErrorCodes::StorageBusy, "storage is busy on all readable members");
+    for (const HostAndPort& host : members) {
+        // Each member gets only what is left of the operation's time, and a killed or expired
+        // operation stops here rather than trying the next one.
+        const Status interruptStatus = txn->checkForInterruptNoAssert();
+        if (!interruptStatus.isOK()) {
+            hedgedReadsFailed.increment();
+            return interruptStatus;
+        }
+        const Milliseconds timeout = std::min(txn->getRemainingMaxTimeMillis(),
+                                              Milliseconds(hedgedReadTimeoutMS.load()));
+
+        hedgedReadsForwarded.increment();
+
+        // The callback may outlive this call if the wait below is interrupted.
+        struct Reply {
+            stdx::mutex mutex;
+            stdx::condition_variable cv;
+            bool done = false;
+            RemoteCommandResponse response{ErrorCodes::InternalError,
+                                           "Internal error running command"};
+        };
+        auto reply = std::make_shared<Reply>();
+
+        const RemoteCommandRequest request(host, dbname, forwardedCmd, metadata, txn, timeout);
+        auto callStatus = executor->scheduleRemoteCommand(
+            request, [reply](const TaskExecutor::RemoteCommandCallbackArgs& args) {
+                stdx::lock_guard<stdx::mutex> lk(reply->mutex);
+                reply->response = args.response;
+                reply->done = true;
+                reply->cv.notify_all();
+            });
+        if (!callStatus.isOK()) {
+            hedgedReadsFailed.increment();
+            return callStatus.getStatus();
+        }
+
+        RemoteCommandResponse response;
+        {
+            stdx::unique_lock<stdx::mutex> lk(reply->mutex);
+            while (!reply->done) {
+                const Status waitStatus = txn->waitForConditionOrInterruptNoAssert(reply->cv, lk);
+                if (!waitStatus.isOK()) {
+                    lk.unlock();
+                    executor->cancel(callStatus.getValue());
+                    hedgedReadsFailed.increment();
+                    return waitStatus;
+                }
+            }
+            response = reply->response;
+        }
+
+        const Status status =
+            response.isOK() ? getStatusFromCommandResult(response.data) : response.status;
+        if (status.isOK()) {
+            hedgedReadsSucceeded.increment();
+
+            BSONObjBuilder replyBob;
+            for (auto&& elem : response.data) {
+                if (elem.fieldNameStringData() != "ok") {
+                    replyBob.append(elem);
+                }
+            }
+            return replyBob.obj();
+        }
+
+        LOG(1) << "Busy read forwarded to " << host << " failed: " << redact(status);
+        lastStatus = status;
+    }
+
+    hedgedReadsFailed.increment();
+    return lastStatus;
+}
+
+void HedgedReadForwarder::shutdown() {
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    if (_executor && !_isShutdown) {
+        LOG(1) << "Shutting down task executor used for hedged reads";
+        _executor->shutdown();
+        _executor->join();
+    }
+    _isShutdown = true;
+}
+
+TaskExecutor* HedgedReadForwarder::_getExecutor() {
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    if (_isShutdown) {
+        return nullptr;
+    }
+
+    if (!_executor) {
+        auto net = executor::makeNetworkInterface("NetworkInterfaceASIO-HedgedReads");
+        auto netPtr = net.get();
+        _executor = stdx::make_unique<ThreadPoolTaskExecutor>(
+            stdx::make_unique<NetworkInterfaceThreadPool>(netPtr), std::move(net));
+        LOG(1) << "Starting up task executor for hedged reads";
+        _executor->startup();
+    }
+    return _executor.get();
+}
+
+}  // namespace mongo
@@ -0,0 +1,121 @@
+/**
+ *    Copyright (C) 2016 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "mongo/base/disallow_copying.h"
+#include "mongo/base/status_with.h"
+#include "mongo/stdx/mutex.h"
+
+namespace mongo {
+
+class BSONObj;
+class CanonicalQuery;
+class OperationContext;
+class ServiceContext;
+
+namespace executor {
+class TaskExecutor;
+}  // namespace executor
+
+/**
+ * Server-side failover for reads rejected with ErrorCodes::StorageBusy.
+ *
+ * When a secondary-ok find by _id cannot be served because this node's storage is busy, the
+ * find command hands it to the HedgedReadForwarder, which sends it to the readable replica set
+ * member with the lowest heartbeat round trip time and relays that member's reply. This saves
+ * the client the round trip it would otherwise spend learning about the busy node.
+ *
+ * Forwarding is off unless the 'hedgeBusyReads' server parameter is set.
+ */
+class HedgedReadForwarder {
+    MONGO_DISALLOW_COPYING(HedgedReadForwarder);
+
+public:
+    /**
+     * Name of the field added to forwarded find commands. A find carrying it is never forwarded
+     * again, so a read that is busy everywhere fails instead of bouncing around the set.
+     */
+    static const char kHedgedReadFieldName[];
+
+    HedgedReadForwarder();
+
+    /**
+     * Talks to other members through 'executor', which it starts, instead of creating its own
+     * network executor. For tests.
+     */
+    explicit HedgedReadForwarder(std::unique_ptr<executor::TaskExecutor> executor);
+
+    ~HedgedReadForwarder();
+
+    static HedgedReadForwarder* get(ServiceContext* service);
+    static HedgedReadForwarder* get(OperationContext* txn);
+
+    /**
+     * Returns true if the find command 'cmdObj', which failed with StorageBusy while running
+     * 'cq', may be forwarded to another member of the replica set.
+     */
+    static bool canForward(OperationContext* txn, const BSONObj& cmdObj, const CanonicalQuery& cq);
+
+    /**
+     * Sends the find command 'cmdObj' to the readable members of the set, closest first, until
+     * one of them answers with something other than StorageBusy. Returns that member's reply
+     * without its 'ok' field, ready to be appended to the command result.
+     *
+     * Each member is given no more than what is left of the operation's time. If the operation
+     * runs out of time or is killed, returns the status saying so without trying further members.
+     *
+     * Must not be called while holding locks.
+     */
+    StatusWith<BSONObj> forwardFind(OperationContext* txn,
+                                    const std::string& dbname,
+                                    const BSONObj& cmdObj);
+
+    /**
+     * Shuts down the network executor. Subsequent calls to forwardFind() fail.
+     */
+    void shutdown();
+
+private:
+    /**
+     * Returns the executor used to talk to other members, starting it on first use. Returns
+     * nullptr after shutdown().
+     */
+    executor::TaskExecutor* _getExecutor();
+
+    stdx::mutex _mutex;
+
+    // Created on the first forwarded read, so that nodes which never forward don't pay for it.
+    std::unique_ptr<executor::TaskExecutor> _executor;
+    bool _isShutdown{false};
+};
+
+}  // namespace mongo
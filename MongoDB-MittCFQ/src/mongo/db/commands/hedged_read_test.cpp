@@ -0,0 +1,241 @@
+/**
+ *    Copyright (C) 2016 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/commands/hedged_read.h"
+
+#include <vector>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/client.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/repl/replication_coordinator_mock.h"
+#include "mongo/db/service_context_noop.h"
+#include "mongo/executor/network_interface_mock.h"
+#include "mongo/executor/thread_pool_task_executor_test_fixture.h"
+#include "mongo/stdx/future.h"
+#include "mongo/stdx/memory.h"
+#include "mongo/unittest/unittest.h"
+#include "mongo/util/clock_source_mock.h"
+#include "mongo/util/net/hostandport.h"
+
+namespace mongo {
+namespace {
+
+using executor::NetworkInterfaceMock;
+using executor::RemoteCommandRequest;
+using executor::RemoteCommandResponse;
+
+const HostAndPort kPrimary("primary", 27017);
+const HostAndPort kSecondary("secondary", 27017);
+const HostAndPort kOtherSecondary("secondary2", 27017);
+
+const BSONObj kFindCmd = BSON("find"
+                              << "coll"
+                              << "filter"
+                              << BSON("_id" << 1));
+
+BSONObj busyReply() {
+    return BSON("ok" << 0 << "code" << ErrorCodes::StorageBusy << "errmsg"
+                     << "storage is busy");
+}
+
+BSONObj findReply() {
+    return BSON("cursor" << BSON("id" << 0LL << "ns"
+                                      << "test.coll"
+                                      << "firstBatch"
+                                      << BSON_ARRAY(BSON("_id" << 1)))
+                         << "ok"
+                         << 1);
+}
+
+class HedgedReadForwarderTest : public unittest::Test {
+public:
+    void setUp() override {
+        _service = stdx::make_unique<ServiceContextNoop>();
+        _service->setFastClockSource(stdx::make_unique<SharedClockSourceAdapter>(_clock));
+        _service->setPreciseClockSource(stdx::make_unique<SharedClockSourceAdapter>(_clock));
+
+        auto replCoord = stdx::make_unique<repl::ReplicationCoordinatorMock>(repl::ReplSettings());
+        _replCoord = replCoord.get();
+        repl::ReplicationCoordinator::set(_service.get(), std::move(replCoord));
+
+        auto net = stdx::make_unique<NetworkInterfaceMock>();
+        _net = net.get();
+        _forwarder = stdx::make_unique<HedgedReadForwarder>(
+            executor::makeThreadPoolTestExecutor(std::move(net)));
+
+        _client = _service->makeClient("HedgedReadForwarderTest");
+        _txn = _client->makeOperationContext();
+    }
+
+    void tearDown() override {
+        _txn.reset();
+        _client.reset();
+        _forwarder.reset();
+    }
+
+protected:
+    /**
+     * Runs forwardFind() on another thread, since it blocks until the network answers.
+     */
+    stdx::future<StatusWith<BSONObj>> launchForwardFind() {
+        return stdx::async(stdx::launch::async, [this] {
+            return _forwarder->forwardFind(_txn.get(), "test", kFindCmd);
+        });
+    }
+
+    /**
+     * Waits for the next request, which must be for 'host', lets 'elapsed' pass and answers it
+     * with 'reply'. Returns the request.
+     */
+    RemoteCommandRequest respond(const HostAndPort& host,
+                                 const BSONObj& reply,
+                                 Milliseconds elapsed = Milliseconds(0)) {
+        _net->enterNetwork();
+        auto noi = _net->getNextReadyRequest();
+        const RemoteCommandRequest request = noi->getRequest();
+        _clock->advance(elapsed);
+        _net->scheduleResponse(
+            noi, _net->now(), RemoteCommandResponse(reply, BSONObj(), Milliseconds(1)));
+        _net->runReadyNetworkOperations();
+        _net->exitNetwork();
+        ASSERT_EQUALS(host, request.target);
+        return request;
+    }
+
+    /**
+     * Waits for forwardFind() to return, delivering whatever the network has to deliver
+     * meanwhile.
+     */
+    StatusWith<BSONObj> finish(stdx::future<StatusWith<BSONObj>>& future) {
+        for (int i = 0; i < 1000; i++) {
+            if (future.wait_for(stdx::chrono::milliseconds(10)) == stdx::future_status::ready) {
+                return future.get();
+            }
+            _net->enterNetwork();
+            _net->runReadyNetworkOperations();
+            _net->exitNetwork();
+        }
+        FAIL("forwardFind did not return");
+        MONGO_UNREACHABLE;
+    }
+
+    bool hasReadyRequests() {
+        _net->enterNetwork();
+        const bool ready = _net->hasReadyRequests();
+        _net->exitNetwork();
+        return ready;
+    }
+
+    const std::shared_ptr<ClockSourceMock> _clock = std::make_shared<ClockSourceMock>();
+    std::unique_ptr<ServiceContext> _service;
+    repl::ReplicationCoordinatorMock* _replCoord = nullptr;
+    NetworkInterfaceMock* _net = nullptr;
+    std::unique_ptr<HedgedReadForwarder> _forwarder;
+    ServiceContext::UniqueClient _client;
+    ServiceContext::UniqueOperationContext _txn;
+};
+
+TEST_F(HedgedReadForwarderTest, NoReadableMembers) {
+    auto result = _forwarder->forwardFind(_txn.get(), "test", kFindCmd);
+    ASSERT_EQUALS(ErrorCodes::StorageBusy, result.getStatus());
+}
+
+TEST_F(HedgedReadForwarderTest, BusyPrimaryFallsThroughToSecondary) {
+    _replCoord->setReadableMembersByPing({kPrimary, kSecondary});
+    _txn->setDeadlineAfterNowBy(Milliseconds(600));
+    const Milliseconds remaining = _txn->getRemainingMaxTimeMillis();
+
+    auto future = launchForwardFind();
+    const RemoteCommandRequest first = respond(kPrimary, busyReply(), Milliseconds(200));
+    const RemoteCommandRequest second = respond(kSecondary, findReply());
+    auto result = finish(future);
+
+    ASSERT_OK(result.getStatus());
+    ASSERT_BSONOBJ_EQ(findReply().removeField("ok"), result.getValue());
+
+    ASSERT_TRUE(first.cmdObj.hasField(HedgedReadForwarder::kHedgedReadFieldName));
+    ASSERT_TRUE(second.cmdObj.hasField(HedgedReadForwarder::kHedgedReadFieldName));
+
+    // Each member only gets what is left of the operation's time.
+    ASSERT_EQUALS(remaining, first.timeout);
+    ASSERT_EQUALS(remaining - Milliseconds(200), second.timeout);
+}
+
+TEST_F(HedgedReadForwarderTest, BusyEverywhere) {
+    _replCoord->setReadableMembersByPing({kPrimary, kSecondary});
+
+    auto future = launchForwardFind();
+    respond(kPrimary, busyReply());
+    respond(kSecondary, busyReply());
+    auto result = finish(future);
+
+    ASSERT_EQUALS(ErrorCodes::StorageBusy, result.getStatus());
+}
+
+TEST_F(HedgedReadForwarderTest, ExpiredDeadlineStopsTrying) {
+    _replCoord->setReadableMembersByPing({kPrimary, kSecondary, kOtherSecondary});
+    _txn->setDeadlineAfterNowBy(Milliseconds(100));
+
+    auto future = launchForwardFind();
+    respond(kPrimary, busyReply(), Milliseconds(200));
+    auto result = finish(future);
+
+    ASSERT_EQUALS(ErrorCodes::ExceededTimeLimit, result.getStatus());
+    ASSERT_FALSE(hasReadyRequests());
+}
+
+TEST_F(HedgedReadForwarderTest, KillOpInterruptsWait) {
+    _replCoord->setReadableMembersByPing({kPrimary, kSecondary});
+
+    auto future = launchForwardFind();
+
+    // Wait for the request to reach the primary, but leave it unanswered.
+    _net->enterNetwork();
+    ASSERT_EQUALS(kPrimary, _net->getNextReadyRequest()->getRequest().target);
+    _net->exitNetwork();
+
+    {
+        stdx::lock_guard<Client> lk(*_client);
+        _txn->markKilled();
+    }
+    auto result = finish(future);
+
+    ASSERT_EQUALS(ErrorCodes::Interrupted, result.getStatus());
+    ASSERT_FALSE(hasReadyRequests());
+
+    // Deliver the cancelled request's callback.
+    _net->enterNetwork();
+    _net->runReadyNetworkOperations();
+    _net->exitNetwork();
+}
+
+}  // namespace
+}  // namespace mongo
@@ -209,6 +209,13 @@ public:
         return retval;
     }
 
+    /**
+     * Returns the OperationContext that owns the stack, or nullptr if nothing was pushed yet.
+     */
+    OperationContext* opCtx() const {
+        return _opCtx;
+    }
+
 private:
     OperationContext* _opCtx = nullptr;
 
@@ -269,7 +276,30 @@ void CurOp::setNS_inlock(StringData ns) {
 void CurOp::ensureStarted() {
     if (_start == 0) {
         _start = curTimeMicros64();
+        if (auto opCtx = _stack->opCtx()) {
+            _storageReadsAtStart = StorageReadStats::get(opCtx);
+        }
+    }
+}
+
+void CurOp::done() {
+    _end = curTimeMicros64();
+
+    auto opCtx = _stack->opCtx();
+    if (opCtx && opCtx->recoveryUnit()) {
+        opCtx->recoveryUnit()->reportStorageReads(opCtx);
     }
+    _debug.storageReads = storageReadsSinceStart();
+}
+
+StorageReadStats CurOp::storageReadsSinceStart() const {
+    auto opCtx = _stack->opCtx();
+    if (!opCtx || !isStarted()) {
+        return StorageReadStats();
+    }
+    StorageReadStats stats = StorageReadStats::get(opCtx);
+    stats -= _storageReadsAtStart;
+    return stats;
 }
 
 void CurOp::enter_inlock(const char* ns, int dbProfileLevel) {
@@ -390,6 +420,12 @@ void CurOp::reportState(BSONObjBuilder* builder) {
     }
 
     builder->append("numYields", _numYields);
+
+    StorageReadStats storageReads = storageReadsSinceStart();
+    if (!storageReads.empty()) {
+        BSONObjBuilder sub(builder->subobjStart("storage"));
+        storageReads.append(&sub);
+    }
 }
 
 namespace {
@@ -504,6 +540,10 @@ string OpDebug::report(Client* client,
         s << " writeConflicts:" << writeConflicts;
     }
 
+    if (!storageReads.empty()) {
+        s << " storage:" << storageReads.toString();
+    }
+
     if (!exceptionInfo.empty()) {
         s << " exception: " << exceptionInfo.msg;
         if (exceptionInfo.code)
@@ -608,6 +648,11 @@ void OpDebug::append(const CurOp& curop,
         b.appendNumber("writeConflicts", writeConflicts);
     }
 
+    if (!storageReads.empty()) {
+        BSONObjBuilder storage(b.subobjStart("storage"));
+        storageReads.append(&storage);
+    }
+
     b.appendNumber("numYield", curop.numYields());
 
     {
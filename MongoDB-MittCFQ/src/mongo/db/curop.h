@@ -35,6 +35,7 @@
 #include "mongo/db/commands.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/server_options.h"
+#include "mongo/db/storage/deadline_read.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/util/net/message.h"
 #include "mongo/util/progress_meter.h"
@@ -118,6 +119,9 @@ public:
     long long keysDeleted{0};   // Number of index keys removed.
     long long writeConflicts{0};
 
+    // Storage reads issued by the operation; set when the CurOp is marked done.
+    StorageReadStats storageReads;
+
     BSONObj execStats;  // Owned here.
 
     // error handling
@@ -282,9 +286,7 @@ public:
         ensureStarted();
         return _start;
     }
-    void done() {
-        _end = curTimeMicros64();
-    }
+    void done();
 
     long long totalTimeMicros() {
         massert(12601, "CurOp not marked done yet", _end);
@@ -412,6 +414,12 @@ public:
         _planSummary = std::move(summary);
     }
 
+    /**
+     * Returns the storage reads issued by the operation since it started, including those of any
+     * operations nested in it.
+     */
+    StorageReadStats storageReadsSinceStart() const;
+
 private:
     class CurOpStack;
 
@@ -424,6 +432,7 @@ private:
     Command* _command{nullptr};
     long long _start{0};
     long long _end{0};
+    StorageReadStats _storageReadsAtStart;
 
     // _networkOp represents the network-level op code: OP_QUERY, OP_GET_MORE, OP_COMMAND, etc.
     NetworkOp _networkOp{opInvalid};  // only set this through setNetworkOp_inlock() to keep synced
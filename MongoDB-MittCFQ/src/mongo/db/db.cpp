@@ -58,6 +58,7 @@
 #include "mongo/db/client.h"
 #include "mongo/db/clientcursor.h"
 #include "mongo/db/commands/feature_compatibility_version.h"
+#include "mongo/db/commands/hedged_read.h"
 #include "mongo/db/concurrency/d_concurrency.h"
 #include "mongo/db/concurrency/lock_state.h"
 #include "mongo/db/concurrency/write_conflict_exception.h"
@@ -119,6 +120,7 @@
 #include "mongo/stdx/future.h"
 #include "mongo/stdx/memory.h"
 #include "mongo/stdx/thread.h"
+#include "mongo/transport/transport_layer_asio.h"
 #include "mongo/transport/transport_layer_legacy.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/cmdline_utils/censor_cmdline.h"
@@ -554,19 +556,40 @@ ExitCode _initAndListen(int listenPort) {
 
     checked_cast<ServiceContextMongoD*>(getGlobalServiceContext())->createLockFile();
 
-    transport::TransportLayerLegacy::Options options;
-    options.port = listenPort;
-    options.ipList = serverGlobalParams.bind_ip;
+    const bool useASIO = mongodGlobalParams.transportLayer == "asio";
 
-    auto sep =
-        stdx::make_unique<ServiceEntryPointMongod>(getGlobalServiceContext()->getTransportLayer());
+    auto sep = useASIO
+        ? stdx::make_unique<ServiceEntryPointMongod>(
+              getGlobalServiceContext()->getTransportLayer(),
+              static_cast<size_t>(mongodGlobalParams.serviceWorkerThreads))
+        : stdx::make_unique<ServiceEntryPointMongod>(
+              getGlobalServiceContext()->getTransportLayer());
     auto sepPtr = sep.get();
 
     getGlobalServiceContext()->setServiceEntryPoint(std::move(sep));
 
     // Create, start, and attach the TL
-    auto transportLayer = stdx::make_unique<transport::TransportLayerLegacy>(options, sepPtr);
-    auto res = transportLayer->setup();
+    std::unique_ptr<transport::TransportLayer> transportLayer;
+    Status res = Status::OK();
+    if (useASIO) {
+        transport::TransportLayerASIO::Options options;
+        options.port = listenPort;
+        options.ipList = serverGlobalParams.bind_ip;
+        options.networkThreads = mongodGlobalParams.asioNetworkThreads;
+
+        auto asioTransportLayer = stdx::make_unique<transport::TransportLayerASIO>(options, sepPtr);
+        res = asioTransportLayer->setup();
+        transportLayer = std::move(asioTransportLayer);
+    } else {
+        transport::TransportLayerLegacy::Options options;
+        options.port = listenPort;
+        options.ipList = serverGlobalParams.bind_ip;
+
+        auto legacyTransportLayer =
+            stdx::make_unique<transport::TransportLayerLegacy>(options, sepPtr);
+        res = legacyTransportLayer->setup();
+        transportLayer = std::move(legacyTransportLayer);
+    }
     if (!res.isOK()) {
         error() << "Failed to set up listener: " << res;
         return EXIT_NET_ERROR;
@@ -1033,6 +1056,8 @@ static void shutdownTask() {
         serviceContext->setKillAllOperations();
 
     ReplicaSetMonitor::shutdown();
+    if (serviceContext)
+        HedgedReadForwarder::get(serviceContext)->shutdown();
     if (auto sr = grid.shardRegistry()) {  // TODO: race: sr is a naked pointer
         sr->shutdown();
     }
@@ -38,10 +38,13 @@
 #include "mongo/db/exec/scoped_timer.h"
 #include "mongo/db/exec/working_set.h"
 #include "mongo/db/exec/working_set_common.h"
+#include "mongo/db/query/query_knobs.h"
 #include "mongo/db/storage/record_fetcher.h"
+#include "mongo/db/storage/storage_busy_exception.h"
 #include "mongo/stdx/memory.h"
 #include "mongo/util/fail_point_service.h"
 #include "mongo/util/log.h"
+#include "mongo/util/scopeguard.h"
 
 #include "mongo/db/client.h"  // XXX-ERH
 
@@ -93,6 +96,18 @@ PlanStage::StageState CollectionScan::doWork(WorkingSetID* out) {
     try {
         if (needToMakeCursor) {
             const bool forward = _params.direction == CollectionScanParams::FORWARD;
+
+            // A scan of a large collection reads each document once; don't let it push the
+            // working set of other operations out of the storage engine's cache. Tailable scans
+            // keep rereading the end of a capped collection, so they are left alone.
+            const int readOnceMinBytes = internalQueryCollectionScanReadOnceMinBytes.load();
+            const bool readOnce = !_params.tailable && readOnceMinBytes >= 0 &&
+                _params.collection->dataSize(getOpCtx()) >=
+                    static_cast<uint64_t>(readOnceMinBytes);
+
+            RecoveryUnit* ru = getOpCtx()->recoveryUnit();
+            ru->setReadOnce(readOnce);
+            ON_BLOCK_EXIT([&] { ru->setReadOnce(false); });
             _cursor = _params.collection->getCursor(getOpCtx(), forward);
 
             if (!_lastSeenId.isNull()) {
@@ -139,6 +154,11 @@ PlanStage::StageState CollectionScan::doWork(WorkingSetID* out) {
             _cursor.reset();
         *out = WorkingSet::INVALID_ID;
         return PlanStage::NEED_YIELD;
+    } catch (const StorageBusyException& sbe) {
+        // The next batch of the collection could not be read within its deadline.
+        _commonStats.isEOF = true;
+        *out = WorkingSetCommon::allocateStatusMember(_workingSet, sbe.toStatus());
+        return PlanStage::FAILURE;
     }
 
     if (!record) {
@@ -35,7 +35,9 @@
 #include "mongo/db/exec/filter.h"
 #include "mongo/db/exec/scoped_timer.h"
 #include "mongo/db/exec/working_set_common.h"
+#include "mongo/db/storage/deadline_read.h"
 #include "mongo/db/storage/record_fetcher.h"
+#include "mongo/db/storage/storage_busy_exception.h"
 #include "mongo/stdx/memory.h"
 #include "mongo/util/fail_point_service.h"
 #include "mongo/util/mongoutils/str.h"
@@ -46,6 +48,16 @@ using std::unique_ptr;
 using std::vector;
 using stdx::make_unique;
 
+namespace {
+
+// Upper bound on the number of records fetched together.
+const size_t kMaxBatchSize = 64;
+
+}  // namespace
+
+// Fetches in batches even on kernels without deadline reads, so that tests can cover batching.
+MONGO_FP_DECLARE(fetchStageAlwaysBatch);
+
 // static
 const char* FetchStage::kStageType = "FETCH";
 
@@ -58,7 +70,10 @@ FetchStage::FetchStage(OperationContext* txn,
       _collection(collection),
       _ws(ws),
       _filter(filter),
-      _idRetrying(WorkingSet::INVALID_ID) {
+      _idRetrying(WorkingSet::INVALID_ID),
+      _batchReads(canUseDeadlineReads(txn) &&
+                  (kernelHasDeadlineReads() || MONGO_FAIL_POINT(fetchStageAlwaysBatch))),
+      _batchSize(1) {
     _children.emplace_back(child);
 }
 
@@ -71,6 +86,10 @@ bool FetchStage::isEOF() {
         return false;
     }
 
+    if (!_pending.empty() || !_ready.empty()) {
+        return false;
+    }
+
     return child()->isEOF();
 }
 
@@ -79,6 +98,10 @@ PlanStage::StageState FetchStage::doWork(WorkingSetID* out) {
         return PlanStage::IS_EOF;
     }
 
+    if (_batchReads) {
+        return doBatchWork(out);
+    }
+
     // Either retry the last WSM we worked on or get a new one from our child.
     WorkingSetID id;
     StageState status;
@@ -127,22 +150,18 @@ PlanStage::StageState FetchStage::doWork(WorkingSetID* out) {
                 _idRetrying = id;
                 *out = WorkingSet::INVALID_ID;
                 return NEED_YIELD;
+            } catch (const StorageBusyException& sbe) {
+                // The storage engine could not read the document within its deadline. Fail
+                // with a retriable status instead of silently dropping the document.
+                _ws->free(id);
+                *out = WorkingSetCommon::allocateStatusMember(_ws, sbe.toStatus());
+                return PlanStage::FAILURE;
             }
         }
 
         return returnIfMatches(member, id, out);
     } else if (PlanStage::FAILURE == status || PlanStage::DEAD == status) {
-        *out = id;
-        // If a stage fails, it may create a status WSM to indicate why it
-        // failed, in which case 'id' is valid.  If ID is invalid, we
-        // create our own error message.
-        if (WorkingSet::INVALID_ID == id) {
-            mongoutils::str::stream ss;
-            ss << "fetch stage failed to read in results from child";
-            Status status(ErrorCodes::InternalError, ss);
-            *out = WorkingSetCommon::allocateStatusMember(_ws, status);
-        }
-        return status;
+        return childFailed(status, id, out);
     } else if (PlanStage::NEED_YIELD == status) {
         *out = id;
     }
@@ -150,6 +169,124 @@ PlanStage::StageState FetchStage::doWork(WorkingSetID* out) {
     return status;
 }
 
+PlanStage::StageState FetchStage::doBatchWork(WorkingSetID* out) {
+    if (!_ready.empty()) {
+        WorkingSetID id = _ready.front();
+        _ready.pop_front();
+        return returnIfMatches(_ws->get(id), id, out);
+    }
+
+    if (_pending.size() < _batchSize && !child()->isEOF()) {
+        WorkingSetID id = WorkingSet::INVALID_ID;
+        StageState status = child()->work(&id);
+
+        if (PlanStage::ADVANCED == status) {
+            _pending.push_back(id);
+            if (_pending.size() < _batchSize && !child()->isEOF()) {
+                return PlanStage::NEED_TIME;
+            }
+        } else if (PlanStage::FAILURE == status || PlanStage::DEAD == status) {
+            return childFailed(status, id, out);
+        } else if (PlanStage::IS_EOF == status) {
+            if (_pending.empty()) {
+                return PlanStage::IS_EOF;
+            }
+        } else {
+            if (PlanStage::NEED_YIELD == status) {
+                *out = id;
+            }
+            return status;
+        }
+    }
+
+    return fetchPending(out);
+}
+
+PlanStage::StageState FetchStage::fetchPending(WorkingSetID* out) {
+    std::vector<RecordId> recordIds;
+    std::vector<WorkingSetID> toFetch;
+    for (WorkingSetID id : _pending) {
+        WorkingSetMember* member = _ws->get(id);
+
+        // If there's an obj there, there is no fetching to perform.
+        if (member->hasObj()) {
+            ++_specificStats.alreadyHasObj;
+            continue;
+        }
+
+        // We need a valid RecordId to fetch from and this is the only state that has one.
+        verify(WorkingSetMember::RID_AND_IDX == member->getState());
+        verify(member->hasRecordId());
+        recordIds.push_back(member->recordId);
+        toFetch.push_back(id);
+    }
+
+    if (!toFetch.empty()) {
+        std::vector<RecordData> records;
+        try {
+            _collection->getRecordStore()->findRecords(getOpCtx(), recordIds, &records, 1);
+        } catch (const WriteConflictException& wce) {
+            // Nothing has been fetched yet; try the whole batch again after yielding. Ensure
+            // that the BSONObjs underlying the WorkingSetMembers are owned because they may be
+            // freed when we yield.
+            for (WorkingSetID id : _pending) {
+                _ws->get(id)->makeObjOwnedIfNeeded();
+            }
+            *out = WorkingSet::INVALID_ID;
+            return NEED_YIELD;
+        } catch (const StorageBusyException& sbe) {
+            // The storage engine could not read the documents within their deadline. Fail
+            // with a retriable status instead of silently dropping them.
+            for (WorkingSetID id : _pending) {
+                _ws->free(id);
+            }
+            _pending.clear();
+            *out = WorkingSetCommon::allocateStatusMember(_ws, sbe.toStatus());
+            return PlanStage::FAILURE;
+        }
+
+        for (size_t i = 0; i < toFetch.size(); ++i) {
+            if (!records[i].data() ||
+                !WorkingSetCommon::fetchFromData(
+                    getOpCtx(), _ws, toFetch[i], std::move(records[i]))) {
+                _ws->free(toFetch[i]);
+            }
+        }
+    }
+
+    for (WorkingSetID id : _pending) {
+        if (!_ws->isFree(id)) {
+            _ready.push_back(id);
+        }
+    }
+    _pending.clear();
+    _batchSize = std::min(_batchSize * 2, kMaxBatchSize);
+
+    if (_ready.empty()) {
+        return PlanStage::NEED_TIME;
+    }
+
+    WorkingSetID id = _ready.front();
+    _ready.pop_front();
+    return returnIfMatches(_ws->get(id), id, out);
+}
+
+PlanStage::StageState FetchStage::childFailed(StageState status,
+                                              WorkingSetID id,
+                                              WorkingSetID* out) {
+    *out = id;
+    // If a stage fails, it may create a status WSM to indicate why it
+    // failed, in which case 'id' is valid.  If ID is invalid, we
+    // create our own error message.
+    if (WorkingSet::INVALID_ID == id) {
+        mongoutils::str::stream ss;
+        ss << "fetch stage failed to read in results from child";
+        Status status(ErrorCodes::InternalError, ss);
+        *out = WorkingSetCommon::allocateStatusMember(_ws, status);
+    }
+    return status;
+}
+
 void FetchStage::doSaveState() {
     if (_cursor)
         _cursor->saveUnpositioned();
@@ -180,6 +317,20 @@ void FetchStage::doInvalidate(OperationContext* txn, const RecordId& dl, Invalid
             WorkingSetCommon::fetchAndInvalidateRecordId(txn, member, _collection);
         }
     }
+
+    // The same goes for the members we are holding on to between batches.
+    for (WorkingSetID id : _pending) {
+        WorkingSetMember* member = _ws->get(id);
+        if (member->hasRecordId() && (member->recordId == dl)) {
+            WorkingSetCommon::fetchAndInvalidateRecordId(txn, member, _collection);
+        }
+    }
+    for (WorkingSetID id : _ready) {
+        WorkingSetMember* member = _ws->get(id);
+        if (member->hasRecordId() && (member->recordId == dl)) {
+            WorkingSetCommon::fetchAndInvalidateRecordId(txn, member, _collection);
+        }
+    }
 }
 
 PlanStage::StageState FetchStage::returnIfMatches(WorkingSetMember* member,
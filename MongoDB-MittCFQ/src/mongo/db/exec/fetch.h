@@ -28,7 +28,9 @@
 
 #pragma once
 
+#include <deque>
 #include <memory>
+#include <vector>
 
 #include "mongo/db/exec/plan_stage.h"
 #include "mongo/db/jsobj.h"
@@ -45,6 +47,10 @@ class SeekableRecordCursor;
  * In WorkingSetMember terms, it transitions from RID_AND_IDX to RID_AND_OBJ by reading
  * the record at the provided RecordId.  Returns verbatim any data that already has an object.
  *
+ * Operations that use deadline reads read the records of several members at once, through
+ * RecordStore::findRecords(), so that the storage engine can issue the reads in disk order. The
+ * members are still returned in the order the child produced them.
+ *
  * Preconditions: Valid RecordId.
  */
 class FetchStage : public PlanStage {
@@ -83,6 +89,22 @@ private:
      */
     StageState returnIfMatches(WorkingSetMember* member, WorkingSetID memberID, WorkingSetID* out);
 
+    /**
+     * doWork() for operations that read records in batches. Collects members from our child in
+     * _pending until there are _batchSize of them, then fetches them together.
+     */
+    StageState doBatchWork(WorkingSetID* out);
+
+    /**
+     * Fetches every member in _pending and moves the ones that still exist to _ready.
+     */
+    StageState fetchPending(WorkingSetID* out);
+
+    /**
+     * Passes a FAILURE or DEAD state from our child up to our parent.
+     */
+    StageState childFailed(StageState status, WorkingSetID id, WorkingSetID* out);
+
     // Collection which is used by this stage. Used to resolve record ids retrieved by child
     // stages. The lifetime of the collection must supersede that of the stage.
     const Collection* _collection;
@@ -98,6 +120,21 @@ private:
     // If not Null, we use this rather than asking our child what to do next.
     WorkingSetID _idRetrying;
 
+    // Whether records are fetched in batches. Operations that cannot use deadline reads, because
+    // they write or the kernel has none, keep fetching one record at a time and yielding for
+    // records that are not in memory.
+    const bool _batchReads;
+
+    // Members from our child that have not been fetched yet, in the order they were returned.
+    std::vector<WorkingSetID> _pending;
+
+    // Fetched members that have not been returned yet, in the same order.
+    std::deque<WorkingSetID> _ready;
+
+    // How many members to collect before fetching them. Starts at one and doubles with each
+    // batch, so that plans which stop after a few documents do not read ahead of them.
+    size_t _batchSize;
+
     // Stats
     FetchStats _specificStats;
 };
@@ -38,6 +38,7 @@
 #include "mongo/db/exec/working_set_computed_data.h"
 #include "mongo/db/index/btree_access_method.h"
 #include "mongo/db/storage/record_fetcher.h"
+#include "mongo/db/storage/storage_busy_exception.h"
 #include "mongo/stdx/memory.h"
 
 namespace mongo {
@@ -168,6 +169,15 @@ PlanStage::StageState IDHackStage::doWork(WorkingSetID* out) {
 
         *out = WorkingSet::INVALID_ID;
         return NEED_YIELD;
+    } catch (const StorageBusyException& sbe) {
+        // The index or the document could not be read within its deadline. Report a retriable
+        // error so that the client can go to another replica set member.
+        if (id != WorkingSet::INVALID_ID)
+            _workingSet->free(id);
+
+        _done = true;
+        *out = WorkingSetCommon::allocateStatusMember(_workingSet, sbe.toStatus());
+        return PlanStage::FAILURE;
     }
 }
 
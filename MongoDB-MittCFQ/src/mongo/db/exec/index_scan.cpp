@@ -35,10 +35,12 @@
 #include "mongo/db/concurrency/write_conflict_exception.h"
 #include "mongo/db/exec/filter.h"
 #include "mongo/db/exec/scoped_timer.h"
+#include "mongo/db/exec/working_set_common.h"
 #include "mongo/db/exec/working_set_computed_data.h"
 #include "mongo/db/index/index_access_method.h"
 #include "mongo/db/index/index_descriptor.h"
 #include "mongo/db/query/index_bounds_builder.h"
+#include "mongo/db/storage/storage_busy_exception.h"
 #include "mongo/stdx/memory.h"
 #include "mongo/util/log.h"
 
@@ -150,6 +152,11 @@ PlanStage::StageState IndexScan::doWork(WorkingSetID* out) {
     } catch (const WriteConflictException& wce) {
         *out = WorkingSet::INVALID_ID;
         return PlanStage::NEED_YIELD;
+    } catch (const StorageBusyException& sbe) {
+        // An index page could not be read within its deadline.
+        _scanState = HIT_END;
+        *out = WorkingSetCommon::allocateStatusMember(_workingSet, sbe.toStatus());
+        return PlanStage::FAILURE;
     }
 
     if (kv) {
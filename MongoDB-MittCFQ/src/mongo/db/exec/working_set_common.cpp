@@ -105,7 +105,19 @@ bool WorkingSetCommon::fetch(OperationContext* txn,
         return false;
     }
 
-    member->obj = {txn->recoveryUnit()->getSnapshotId(), record->data.releaseToBson()};
+    return fetchFromData(txn, workingSet, id, std::move(record->data));
+}
+
+// static
+bool WorkingSetCommon::fetchFromData(OperationContext* txn,
+                                     WorkingSet* workingSet,
+                                     WorkingSetID id,
+                                     RecordData data) {
+    WorkingSetMember* member = workingSet->get(id);
+    invariant(!member->hasFetcher());
+    invariant(member->hasRecordId());
+
+    member->obj = {txn->recoveryUnit()->getSnapshotId(), data.releaseToBson()};
 
     if (member->isSuspicious) {
         // Make sure that all of the keyData is still valid for this copy of the document.
@@ -161,6 +173,12 @@ bool WorkingSetCommon::isValidStatusMemberObject(const BSONObj& obj) {
         obj.hasField("errmsg");
 }
 
+// static
+bool WorkingSetCommon::isStorageBusyStatusMemberObject(const BSONObj& obj) {
+    return isValidStatusMemberObject(obj) &&
+        obj.getIntField("code") == static_cast<int>(ErrorCodes::StorageBusy);
+}
+
 // static
 void WorkingSetCommon::getStatusMemberObject(const WorkingSet& ws,
                                              WorkingSetID wsid,
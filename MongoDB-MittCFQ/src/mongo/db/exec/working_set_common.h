@@ -36,6 +36,7 @@ namespace mongo {
 class CanonicalQuery;
 class Collection;
 class OperationContext;
+class RecordData;
 class SeekableRecordCursor;
 
 class WorkingSetCommon {
@@ -75,6 +76,15 @@ public:
                       WorkingSetID id,
                       unowned_ptr<SeekableRecordCursor> cursor);
 
+    /**
+     * Like fetch(), but for a document that has already been read, e.g. as part of a batch:
+     * 'data' holds the document that the member's RecordId points to.
+     */
+    static bool fetchFromData(OperationContext* txn,
+                              WorkingSet* workingSet,
+                              WorkingSetID id,
+                              RecordData data);
+
     static bool fetchIfUnfetched(OperationContext* txn,
                                  WorkingSet* workingSet,
                                  WorkingSetID id,
@@ -107,6 +117,13 @@ public:
      */
     static bool isValidStatusMemberObject(const BSONObj& obj);
 
+    /**
+     * Returns true if 'obj' was created by allocateStatusMember() for a StorageBusy status, i.e.
+     * a read was rejected because the storage device could not serve it in time. Such errors
+     * are retriable and are returned to the client as-is.
+     */
+    static bool isStorageBusyStatusMemberObject(const BSONObj& obj);
+
     /**
      * Returns object in working set member created with allocateStatusMember().
      * Does not assume isValidStatusMemberObject.
@@ -38,6 +38,7 @@
 #include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/db/ftdc/collector.h"
 #include "mongo/db/ftdc/controller.h"
+#include "mongo/db/storage/deadline_read.h"
 #include "mongo/stdx/memory.h"
 #include "mongo/util/processinfo.h"
 #include "mongo/util/procparser.h"
@@ -108,6 +109,29 @@ public:
                                 &subObjBuilder);
             subObjBuilder.doneFast();
         }
+
+        // Sample both sides of deadline-read admission together: what the kernel predicted and
+        // rejected on each disk, and what this node saw come back from its own reads.
+        {
+            BSONObjBuilder subObjBuilder(builder.subobjStart("mittcfq"_sd));
+
+            const StorageLoad storageLoad = getStorageLoad();
+            subObjBuilder.appendNumber("deadlineReads", storageLoad.deadlineReads);
+            subObjBuilder.appendNumber("busyRejections", storageLoad.busyRejections);
+            subObjBuilder.append("busyRate", storageLoad.busyRate);
+            subObjBuilder.appendNumber(
+                "predictedReadDelayMicros",
+                durationCount<Microseconds>(storageLoad.predictedReadDelay));
+
+            if (!_disksStringData.empty()) {
+                BSONObjBuilder disksBuilder(subObjBuilder.subobjStart("disks"_sd));
+                processStatusErrors(procparser::parseMittCFQStatsDirectory(
+                                        "/sys/block"_sd, _disksStringData, &disksBuilder),
+                                    &disksBuilder);
+                disksBuilder.doneFast();
+            }
+            subObjBuilder.doneFast();
+        }
     }
 
 private:
@@ -51,6 +51,8 @@
 #include "mongo/db/auth/internal_user_auth.h"
 #include "mongo/db/auth/security_key.h"
 #include "mongo/db/server_options.h"
+#include "mongo/logger/async_file_appender.h"
+#include "mongo/logger/async_log_writer.h"
 #include "mongo/logger/console_appender.h"
 #include "mongo/logger/logger.h"
 #include "mongo/logger/message_event.h"
@@ -61,6 +63,7 @@
 #include "mongo/logger/rotatable_file_writer.h"
 #include "mongo/logger/syslog_appender.h"
 #include "mongo/platform/process_id.h"
+#include "mongo/util/exit.h"
 #include "mongo/util/log.h"
 #include "mongo/util/mongoutils/str.h"
 #include "mongo/util/net/listen.h"
@@ -280,13 +283,31 @@ MONGO_INITIALIZER_GENERAL(ServerLogRedirection,
 
         LogManager* manager = logger::globalLogManager();
         manager->getGlobalDomain()->clearAppenders();
-        manager->getGlobalDomain()->attachAppender(
-            MessageLogDomain::AppenderAutoPtr(new RotatableFileAppender<MessageEventEphemeral>(
-                new MessageEventDetailsEncoder, writer.getValue())));
-        manager->getNamedDomain("javascriptOutput")
-            ->attachAppender(
+        if (serverGlobalParams.logAsyncBufferSize > 0) {
+            using logger::AsyncFileAppender;
+
+            // Lives for the rest of the process, like the appenders that refer to it. The
+            // shutdown task runs after every other one, and later messages are written directly.
+            auto asyncWriter = new logger::AsyncLogWriter(
+                writer.getValue(), static_cast<size_t>(serverGlobalParams.logAsyncBufferSize));
+            registerShutdownTask([asyncWriter] { asyncWriter->shutdown(); });
+
+            manager->getGlobalDomain()->attachAppender(
+                MessageLogDomain::AppenderAutoPtr(new AsyncFileAppender<MessageEventEphemeral>(
+                    new MessageEventDetailsEncoder, asyncWriter)));
+            manager->getNamedDomain("javascriptOutput")
+                ->attachAppender(
+                    MessageLogDomain::AppenderAutoPtr(new AsyncFileAppender<MessageEventEphemeral>(
+                        new MessageEventDetailsEncoder, asyncWriter)));
+        } else {
+            manager->getGlobalDomain()->attachAppender(
                 MessageLogDomain::AppenderAutoPtr(new RotatableFileAppender<MessageEventEphemeral>(
                     new MessageEventDetailsEncoder, writer.getValue())));
+            manager->getNamedDomain("javascriptOutput")
+                ->attachAppender(MessageLogDomain::AppenderAutoPtr(
+                    new RotatableFileAppender<MessageEventEphemeral>(new MessageEventDetailsEncoder,
+                                                                     writer.getValue())));
+        }
 
         if (serverGlobalParams.logAppend && exists) {
             log() << "***** SERVER RESTARTED *****";
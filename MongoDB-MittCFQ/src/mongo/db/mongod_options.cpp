@@ -133,6 +133,27 @@ Status addMongodOptions(moe::OptionSection* options) {
     general_options.addOptionChaining(
         "net.http.RESTInterfaceEnabled", "rest", moe::Switch, "turn on simple rest api");
 
+    general_options
+        .addOptionChaining("net.transportLayer",
+                           "transportLayer",
+                           moe::String,
+                           "how client connections are served: legacy runs a thread per "
+                           "connection, asio multiplexes connections over a few network threads "
+                           "and runs requests on a pool of worker threads")
+        .format("(:?legacy)|(:?asio)", "(legacy/asio)");
+
+    general_options.addOptionChaining("net.asio.networkThreads",
+                                      "asioNetworkThreads",
+                                      moe::Int,
+                                      "number of network threads with --transportLayer asio");
+
+    general_options.addOptionChaining(
+        "net.asio.workerThreads",
+        "asioWorkerThreads",
+        moe::Int,
+        "number of pooled threads running requests with --transportLayer asio; as many "
+        "requests again run on threads of their own once they are busy, and the rest queue");
+
     // Diagnostic Options
 
     general_options
@@ -1104,6 +1125,24 @@ Status storeMongodOptions(const moe::Environment& params) {
     if (params.count("net.http.JSONPEnabled")) {
         serverGlobalParams.jsonp = params["net.http.JSONPEnabled"].as<bool>();
     }
+    if (params.count("net.transportLayer")) {
+        mongodGlobalParams.transportLayer = params["net.transportLayer"].as<std::string>();
+    }
+
+    if (params.count("net.asio.networkThreads")) {
+        mongodGlobalParams.asioNetworkThreads = params["net.asio.networkThreads"].as<int>();
+        if (mongodGlobalParams.asioNetworkThreads < 1) {
+            return Status(ErrorCodes::BadValue, "net.asio.networkThreads must be at least 1");
+        }
+    }
+
+    if (params.count("net.asio.workerThreads")) {
+        mongodGlobalParams.serviceWorkerThreads = params["net.asio.workerThreads"].as<int>();
+        if (mongodGlobalParams.serviceWorkerThreads < 1) {
+            return Status(ErrorCodes::BadValue, "net.asio.workerThreads must be at least 1");
+        }
+    }
+
     if (params.count("security.javascriptEnabled")) {
         mongodGlobalParams.scriptingEnabled = params["security.javascriptEnabled"].as<bool>();
     }
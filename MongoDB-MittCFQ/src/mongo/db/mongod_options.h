@@ -47,7 +47,15 @@ namespace moe = mongo::optionenvironment;
 struct MongodGlobalParams {
     bool scriptingEnabled;  // --noscripting
 
-    MongodGlobalParams() : scriptingEnabled(true) {}
+    std::string transportLayer;  // --transportLayer: "legacy" or "asio"
+    int asioNetworkThreads;      // threads multiplexing connections with --transportLayer asio
+    int serviceWorkerThreads;    // pooled threads running requests with --transportLayer asio
+
+    MongodGlobalParams()
+        : scriptingEnabled(true),
+          transportLayer("legacy"),
+          asioNetworkThreads(2),
+          serviceWorkerThreads(128) {}
 };
 
 extern MongodGlobalParams mongodGlobalParams;
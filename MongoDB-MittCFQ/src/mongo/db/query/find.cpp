@@ -213,6 +213,9 @@ void generateBatch(int ntoreturn,
 
     if (PlanExecutor::DEAD == *state || PlanExecutor::FAILURE == *state) {
         // Propagate this error to caller.
+        if (WorkingSetCommon::isStorageBusyStatusMemberObject(obj)) {
+            uassertStatusOK(WorkingSetCommon::getMemberObjectStatus(obj));
+        }
         error() << "getMore executor error, stats: " << redact(Explain::getWinningPlanStats(exec));
         uasserted(17406, "getMore executor error: " + WorkingSetCommon::toStatusString(obj));
     }
@@ -629,6 +632,9 @@ std::string runQuery(OperationContext* txn,
 
     // Caller expects exceptions thrown in certain cases.
     if (PlanExecutor::FAILURE == state || PlanExecutor::DEAD == state) {
+        if (WorkingSetCommon::isStorageBusyStatusMemberObject(obj)) {
+            uassertStatusOK(WorkingSetCommon::getMemberObjectStatus(obj));
+        }
         error() << "Plan executor error during find: " << PlanExecutor::statestr(state)
                 << ", stats: " << redact(Explain::getWinningPlanStats(exec.get()));
         uasserted(17144, "Executor error: " + WorkingSetCommon::toStatusString(obj));
@@ -108,6 +108,10 @@ extern std::atomic<int> internalQueryExecYieldPeriodMS;  // NOLINT
 // Limit the size that we write without yielding to 16MB / 64 (max expected number of indexes)
 const int64_t insertVectorMaxBytes = 256 * 1024;
 
+// Collection scans of collections holding at least this many bytes ask the storage engine not to
+// let the documents they read displace its cache. Negative values turn this off.
+extern std::atomic<int> internalQueryCollectionScanReadOnceMinBytes;  // NOLINT
+
 // The number of bytes to buffer at once during a $facet stage.
 extern std::atomic<int> internalQueryFacetBufferSizeBytes;  // NOLINT
 
@@ -651,6 +651,13 @@ public:
      */
     virtual std::vector<HostAndPort> getOtherNodesInReplSet() const = 0;
 
+    /**
+     * Returns the members other than ourself that were up and readable (PRIMARY or SECONDARY)
+     * at their last heartbeat, ordered by increasing heartbeat round trip time.  Returns an
+     * empty vector if we are not in replica set mode or do not have a valid config.
+     */
+    virtual std::vector<HostAndPort> getReadableMembersByPing() = 0;
+
     /**
      * Returns a BSONObj containing a representation of the current default write concern.
      */
@@ -3070,6 +3070,15 @@ std::vector<HostAndPort> ReplicationCoordinatorImpl::getOtherNodesInReplSet() co
     return nodes;
 }
 
+std::vector<HostAndPort> ReplicationCoordinatorImpl::getReadableMembersByPing() {
+    if (!_settings.usingReplSets()) {
+        return std::vector<HostAndPort>();
+    }
+
+    LockGuard topoLock(_topoMutex);
+    return _topCoord->getReadableHostAndPortsByPing();
+}
+
 Status ReplicationCoordinatorImpl::checkIfWriteConcernCanBeSatisfied(
     const WriteConcernOptions& writeConcern) const {
     stdx::lock_guard<stdx::mutex> lock(_mutex);
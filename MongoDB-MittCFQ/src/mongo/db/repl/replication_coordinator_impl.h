@@ -272,6 +272,8 @@ public:
 
     virtual std::vector<HostAndPort> getOtherNodesInReplSet() const override;
 
+    virtual std::vector<HostAndPort> getReadableMembersByPing() override;
+
     virtual WriteConcernOptions getGetLastErrorDefault() override;
 
     virtual Status checkReplEnabledForCommand(BSONObjBuilder* result) override;
@@ -241,6 +241,10 @@ void ReplicationCoordinatorMock::setGetConfigReturnValue(ReplicaSetConfig return
     _getConfigReturnValue = std::move(returnValue);
 }
 
+void ReplicationCoordinatorMock::setReadableMembersByPing(std::vector<HostAndPort> members) {
+    _readableMembersByPing = std::move(members);
+}
+
 void ReplicationCoordinatorMock::processReplSetGetConfig(BSONObjBuilder* result) {
     // TODO
 }
@@ -352,6 +356,10 @@ vector<HostAndPort> ReplicationCoordinatorMock::getOtherNodesInReplSet() const {
     return std::vector<HostAndPort>();
 }
 
+std::vector<HostAndPort> ReplicationCoordinatorMock::getReadableMembersByPing() {
+    return _readableMembersByPing;
+}
+
 Status ReplicationCoordinatorMock::checkIfWriteConcernCanBeSatisfied(
     const WriteConcernOptions& writeConcern) const {
     return Status::OK();
@@ -201,6 +201,8 @@ public:
 
     virtual std::vector<HostAndPort> getOtherNodesInReplSet() const;
 
+    virtual std::vector<HostAndPort> getReadableMembersByPing();
+
     virtual WriteConcernOptions getGetLastErrorDefault();
 
     virtual Status checkReplEnabledForCommand(BSONObjBuilder* result);
@@ -267,6 +269,11 @@ public:
      */
     void setGetConfigReturnValue(ReplicaSetConfig returnValue);
 
+    /**
+     * Sets the return value for calls to getReadableMembersByPing.
+     */
+    void setReadableMembersByPing(std::vector<HostAndPort> members);
+
 private:
     AtomicUInt64 _snapshotNameGenerator;
     const ReplSettings _settings;
@@ -274,6 +281,7 @@ private:
     OpTime _myLastDurableOpTime;
     OpTime _myLastAppliedOpTime;
     ReplicaSetConfig _getConfigReturnValue;
+    std::vector<HostAndPort> _readableMembersByPing;
 };
 
 }  // namespace repl
@@ -48,6 +48,7 @@
 #include "mongo/db/repl/replication_coordinator_global.h"
 #include "mongo/db/server_options.h"
 #include "mongo/db/server_parameters.h"
+#include "mongo/db/storage/deadline_read.h"
 #include "mongo/db/storage/storage_options.h"
 #include "mongo/db/wire_version.h"
 #include "mongo/executor/network_interface.h"
@@ -290,6 +291,15 @@ public:
         result.append("minWireVersion", WireSpec::instance().incoming.minWireVersion);
         result.append("readOnly", storageGlobalParams.readOnly);
 
+        // Lets drivers using the "leastBusy" read preference steer reads away from members
+        // whose disks are queueing.
+        const StorageLoad storageLoad = getStorageLoad();
+        BSONObjBuilder storageLoadBuilder(result.subobjStart("storageLoad"));
+        storageLoadBuilder.append("busyRate", storageLoad.busyRate);
+        storageLoadBuilder.append("predictedReadDelayMicros",
+                                  durationCount<Microseconds>(storageLoad.predictedReadDelay));
+        storageLoadBuilder.doneFast();
+
         const auto parameter = mapFindWithDefault(ServerParameterSet::getGlobal()->getMap(),
                                                   "automationServiceDescriptor",
                                                   static_cast<ServerParameter*>(nullptr));
@@ -96,6 +96,13 @@ public:
      */
     virtual std::vector<HostAndPort> getMaybeUpHostAndPorts() const = 0;
 
+    /**
+     * Retrieves a vector of HostAndPorts of all nodes other than ourself that were up and in
+     * PRIMARY or SECONDARY state at the last heartbeat, ordered by increasing heartbeat round
+     * trip time.  Nodes with no recorded round trip time come last.
+     */
+    virtual std::vector<HostAndPort> getReadableHostAndPortsByPing() const = 0;
+
     /**
      * Gets the earliest time the current node will stand for election.
      */
@@ -32,6 +32,7 @@
 
 #include "mongo/db/repl/topology_coordinator_impl.h"
 
+#include <algorithm>
 #include <limits>
 
 #include "mongo/db/audit.h"
@@ -2127,6 +2128,42 @@ std::vector<HostAndPort> TopologyCoordinatorImpl::getMaybeUpHostAndPorts() const
     return upHosts;
 }
 
+std::vector<HostAndPort> TopologyCoordinatorImpl::getReadableHostAndPortsByPing() const {
+    std::vector<std::pair<Milliseconds, HostAndPort>> readable;
+    for (std::vector<MemberHeartbeatData>::const_iterator it = _hbdata.begin(); it != _hbdata.end();
+         ++it) {
+        const int itIndex = indexOfIterator(_hbdata, it);
+        if (itIndex == _selfIndex) {
+            continue;  // skip ourselves
+        }
+        if (!it->up() || !it->getState().readable()) {
+            continue;
+        }
+
+        // Members we have no round trip times for sort last: PingStats reports 0ms for them,
+        // and they may well be unreachable.
+        const HostAndPort& host = _rsConfig.getMemberAt(itIndex).getHostAndPort();
+        PingMap::const_iterator ping = _pings.find(host);
+        readable.emplace_back(ping == _pings.end() || ping->second.getCount() == 0
+                                  ? Milliseconds::max()
+                                  : ping->second.getMillis(),
+                              host);
+    }
+
+    std::stable_sort(readable.begin(),
+                     readable.end(),
+                     [](const std::pair<Milliseconds, HostAndPort>& lhs,
+                        const std::pair<Milliseconds, HostAndPort>& rhs) {
+                         return lhs.first < rhs.first;
+                     });
+
+    std::vector<HostAndPort> hosts;
+    for (const auto& entry : readable) {
+        hosts.push_back(entry.second);
+    }
+    return hosts;
+}
+
 bool TopologyCoordinatorImpl::voteForMyself(Date_t now) {
     if (_role != Role::candidate) {
         return false;
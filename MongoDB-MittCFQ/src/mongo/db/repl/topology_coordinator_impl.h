@@ -146,6 +146,7 @@ public:
     virtual MemberState getMemberState() const;
     virtual HostAndPort getSyncSourceAddress() const;
     virtual std::vector<HostAndPort> getMaybeUpHostAndPorts() const;
+    virtual std::vector<HostAndPort> getReadableHostAndPortsByPing() const;
     virtual int getMaintenanceCount() const;
     virtual long long getTerm();
     virtual UpdateTermResult updateTerm(long long term, Date_t now);
@@ -781,6 +781,45 @@ TEST_F(TopoCoordTest, ChooseNoSyncSourceWhenPrimaryIsBlacklistedAndChainingIsDis
     ASSERT_EQUALS(HostAndPort("h2"), getTopoCoord().getSyncSourceAddress());
 }
 
+TEST_F(TopoCoordTest, ReadableHostsAreOrderedByPingAndExcludeDownAndUnreadableNodes) {
+    updateConfig(BSON("_id"
+                      << "rs0"
+                      << "version"
+                      << 1
+                      << "members"
+                      << BSON_ARRAY(BSON("_id" << 0 << "host"
+                                               << "hself")
+                                    << BSON("_id" << 1 << "host"
+                                                  << "h1")
+                                    << BSON("_id" << 2 << "host"
+                                                  << "h2")
+                                    << BSON("_id" << 3 << "host"
+                                                  << "h3"
+                                                  << "arbiterOnly"
+                                                  << true)
+                                    << BSON("_id" << 4 << "host"
+                                                  << "h4")
+                                    << BSON("_id" << 5 << "host"
+                                                  << "h5"))),
+                 0);
+    setSelfMemberState(MemberState::RS_SECONDARY);
+
+    heartbeatFromMember(
+        HostAndPort("h1"), "rs0", MemberState::RS_SECONDARY, OpTime(), Milliseconds(300));
+    heartbeatFromMember(
+        HostAndPort("h2"), "rs0", MemberState::RS_PRIMARY, OpTime(), Milliseconds(100));
+    heartbeatFromMember(
+        HostAndPort("h3"), "rs0", MemberState::RS_ARBITER, OpTime(), Milliseconds(50));
+    heartbeatFromMember(
+        HostAndPort("h4"), "rs0", MemberState::RS_RECOVERING, OpTime(), Milliseconds(50));
+    receiveDownHeartbeat(HostAndPort("h5"), "rs0", OpTime());
+
+    std::vector<HostAndPort> hosts = getTopoCoord().getReadableHostAndPortsByPing();
+    ASSERT_EQUALS(2U, hosts.size());
+    ASSERT_EQUALS(HostAndPort("h2"), hosts[0]);
+    ASSERT_EQUALS(HostAndPort("h1"), hosts[1]);
+}
+
 TEST_F(TopoCoordTest, NodeChangesToRecoveringWhenOnlyUnauthorizedNodesAreUp) {
     updateConfig(BSON("_id"
                       << "rs0"
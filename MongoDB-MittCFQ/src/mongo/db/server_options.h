@@ -81,6 +81,7 @@ struct ServerGlobalParams {
     std::string logpath;            // Path to log file, if logging to a file; otherwise, empty.
     bool logAppend = false;         // True if logging to a file in append mode.
     bool logRenameOnRotate = true;  // True if logging should rename log files on rotate
+    int logAsyncBufferSize = 0;     // Messages queued for the log writer thread; 0 is synchronous.
     bool logWithSyslog = false;     // True if logging to syslog; must not be set if logpath is set.
     int syslogFacility;             // Facility used when appending messages to the syslog.
 
@@ -248,6 +248,13 @@ Status addGeneralServerOptions(moe::OptionSection* options) {
                                moe::String,
                                "set the log rotation behavior (rename|reopen)");
 
+    options->addOptionChaining("systemLog.asyncBufferSize",
+                               "logAsyncBufferSize",
+                               moe::Int,
+                               "write the log file from a background thread, queueing up to this "
+                               "many messages; informational messages are dropped when the queue "
+                               "is full (0 writes synchronously)");
+
     options->addOptionChaining("systemLog.timeStampFormat",
                                "timeStampFormat",
                                moe::String,
@@ -980,6 +987,14 @@ Status storeServerOptions(const moe::Environment& params) {
         }
     }
 
+    if (params.count("systemLog.asyncBufferSize")) {
+        int bufferSize = params["systemLog.asyncBufferSize"].as<int>();
+        if (bufferSize < 0) {
+            return Status(ErrorCodes::BadValue, "systemLog.asyncBufferSize must not be negative");
+        }
+        serverGlobalParams.logAsyncBufferSize = bufferSize;
+    }
+
     if (!serverGlobalParams.logpath.empty() && serverGlobalParams.logWithSyslog) {
         return Status(ErrorCodes::BadValue, "Cant use both a logpath and syslog ");
     }
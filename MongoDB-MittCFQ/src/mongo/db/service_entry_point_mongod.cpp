@@ -32,18 +32,23 @@
 
 #include "mongo/db/service_entry_point_mongod.h"
 
+#include <system_error>
 #include <vector>
 
 #include "mongo/db/client.h"
 #include "mongo/db/dbmessage.h"
 #include "mongo/db/instance.h"
+#include "mongo/db/server_options.h"
+#include "mongo/stdx/memory.h"
 #include "mongo/stdx/thread.h"
 #include "mongo/transport/service_entry_point_utils.h"
 #include "mongo/transport/session.h"
 #include "mongo/transport/ticket.h"
 #include "mongo/transport/transport_layer.h"
+#include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/exit.h"
 #include "mongo/util/log.h"
+#include "mongo/util/mongoutils/str.h"
 #include "mongo/util/net/message.h"
 #include "mongo/util/net/socket_exception.h"
 #include "mongo/util/net/thread_idle_callback.h"
@@ -92,7 +97,25 @@ using transport::TransportLayer;
 
 ServiceEntryPointMongod::ServiceEntryPointMongod(TransportLayer* tl) : _tl(tl) {}
 
+ServiceEntryPointMongod::ServiceEntryPointMongod(TransportLayer* tl, size_t workerThreads)
+    : _tl(tl), _maxPooledRequests(workerThreads), _maxOverflowThreads(workerThreads) {
+    ThreadPool::Options options;
+    options.poolName = "ServiceWorkers";
+    options.threadNamePrefix = "worker";
+    options.minThreads = 0;
+    options.maxThreads = workerThreads;
+    _workers = stdx::make_unique<ThreadPool>(options);
+    _workers->startup();
+}
+
+ServiceEntryPointMongod::~ServiceEntryPointMongod() = default;
+
 void ServiceEntryPointMongod::startSession(Session&& session) {
+    if (_workers) {
+        _startPooledSession(std::move(session));
+        return;
+    }
+
     launchWrappedServiceEntryWorkerThread(std::move(session), [this](Session* session) {
         _nWorkers.fetchAndAdd(1);
         auto guard = MakeGuard([&] { _nWorkers.fetchAndSubtract(1); });
@@ -125,39 +148,154 @@ void ServiceEntryPointMongod::_sessionLoop(Session* session) {
             uassertStatusOK(status);
         }
 
-        // 2. Pass sourced Message up to mongod
-        DbResponse dbresponse;
-        {
-            auto opCtx = cc().makeOperationContext();
-            assembleResponse(opCtx.get(), inMessage, dbresponse, session->remote());
+        // 2. - 4. Run the Message and sink the response
+        inExhaust = _processMessage(session, &inMessage);
 
-            // opCtx must go out of scope here so that the operation cannot show
-            // up in currentOp results after the response reaches the client
+        if ((counter++ & 0xf) == 0) {
+            markThreadIdle();
         }
+    }
+}
+
+bool ServiceEntryPointMongod::_processMessage(Session* session, Message* inMessage) {
+    // 2. Pass sourced Message up to mongod
+    DbResponse dbresponse;
+    {
+        auto opCtx = cc().makeOperationContext();
+        assembleResponse(opCtx.get(), *inMessage, dbresponse, session->remote());
+
+        // opCtx must go out of scope here so that the operation cannot show
+        // up in currentOp results after the response reaches the client
+    }
 
-        // 3. Format our response, if we have one
-        Message& toSink = dbresponse.response;
-        if (!toSink.empty()) {
-            toSink.header().setId(nextMessageId());
-            toSink.header().setResponseToMsgId(inMessage.header().getId());
-
-            // If this is an exhaust cursor, don't source more Messages
-            if (dbresponse.exhaustNS.size() > 0 && setExhaustMessage(&inMessage, dbresponse)) {
-                inExhaust = true;
-            } else {
-                inExhaust = false;
+    // 3. Format our response, if we have one
+    Message& toSink = dbresponse.response;
+    if (toSink.empty()) {
+        return false;
+    }
+
+    toSink.header().setId(nextMessageId());
+    toSink.header().setResponseToMsgId(inMessage->header().getId());
+
+    // If this is an exhaust cursor, don't source more Messages
+    const bool inExhaust =
+        dbresponse.exhaustNS.size() > 0 && setExhaustMessage(inMessage, dbresponse);
+
+    // 4. Sink our response to the client
+    uassertStatusOK(session->sinkMessage(toSink).wait());
+    return inExhaust;
+}
+
+/**
+ * A session served by the worker pool. Between requests it is only referenced by the pending
+ * source callback, so an idle connection costs no thread.
+ */
+struct ServiceEntryPointMongod::PooledSession {
+    explicit PooledSession(Session&& session) : session(std::move(session)) {}
+
+    Session session;
+    ServiceContext::UniqueClient client;
+    Message inMessage;
+};
+
+void ServiceEntryPointMongod::_startPooledSession(Session&& session) {
+    auto pooled = std::make_shared<PooledSession>(std::move(session));
+    pooled->client = getGlobalServiceContext()->makeClient(
+        str::stream() << "conn" << pooled->session.id(), &pooled->session);
+    _sourcePooled(std::move(pooled));
+}
+
+void ServiceEntryPointMongod::_sourcePooled(std::shared_ptr<PooledSession> pooled) {
+    pooled->inMessage.reset();
+    auto ticket = pooled->session.sourceMessage(&pooled->inMessage);
+    _tl->asyncWait(std::move(ticket), [this, pooled](Status status) {
+        if (!status.isOK()) {
+            _endPooledSession(pooled);
+            return;
+        }
+
+        // Requests may block on locks, replication or other requests, so a full pool must not
+        // hold back the rest: past the bound a request gets a thread of its own instead. Those
+        // threads are capped as well, so that a stalled disk can't grow them without limit; past
+        // both bounds the request waits in the pool's queue.
+        if (_pooledRequests.addAndFetch(1) > _maxPooledRequests) {
+            _pooledRequests.subtractAndFetch(1);
+            if (_overflowThreads.addAndFetch(1) <= _maxOverflowThreads) {
+                try {
+                    stdx::thread([this, pooled] { _runPooled(pooled, false); }).detach();
+                } catch (const std::system_error& e) {
+                    _overflowThreads.subtractAndFetch(1);
+                    log() << "failed to create service entry worker thread for "
+                          << pooled->session.remote() << ": " << e.what();
+                    _endPooledSession(pooled);
+                }
+                return;
             }
+            _overflowThreads.subtractAndFetch(1);
+            _pooledRequests.addAndFetch(1);
+        }
 
-            // 4. Sink our response to the client
-            uassertStatusOK(session->sinkMessage(toSink).wait());
-        } else {
-            inExhaust = false;
+        status = _workers->schedule([this, pooled] { _runPooled(pooled, true); });
+        if (!status.isOK()) {
+            _pooledRequests.subtractAndFetch(1);
+            _endPooledSession(pooled);
         }
+    });
+}
 
-        if ((counter++ & 0xf) == 0) {
-            markThreadIdle();
+void ServiceEntryPointMongod::_runPooled(std::shared_ptr<PooledSession> pooled, bool onPool) {
+    _nWorkers.fetchAndAdd(1);
+    auto guard = MakeGuard([&] { _nWorkers.fetchAndSubtract(1); });
+
+    Client::setCurrent(std::move(pooled->client));
+
+    bool ok = true;
+    try {
+        while (_processMessage(&pooled->session, &pooled->inMessage)) {
+            // Keep answering the exhaust cursor's getMores.
         }
+    } catch (const AssertionException& e) {
+        log() << "AssertionException handling request, closing client connection: " << e;
+        ok = false;
+    } catch (const SocketException& e) {
+        log() << "SocketException handling request, closing client connection: " << e;
+        ok = false;
+    } catch (const DBException& e) {
+        // must be right above std::exception to avoid catching subclasses
+        log() << "DBException handling request, closing client connection: " << e;
+        ok = false;
+    } catch (const std::exception& e) {
+        error() << "Uncaught std::exception: " << e.what() << ", terminating";
+        quickExit(EXIT_UNCAUGHT);
+    }
+
+    pooled->client = Client::releaseCurrent();
+
+    if (onPool) {
+        _pooledRequests.subtractAndFetch(1);
+    } else {
+        _overflowThreads.subtractAndFetch(1);
+    }
+
+    if (ok) {
+        _sourcePooled(std::move(pooled));
+    } else {
+        _endPooledSession(pooled);
     }
 }
 
+void ServiceEntryPointMongod::_endPooledSession(const std::shared_ptr<PooledSession>& pooled) {
+    _tl->end(pooled->session);
+
+    if (!serverGlobalParams.quiet) {
+        auto conns = _tl->sessionStats().numOpenSessions;
+        const char* word = (conns == 1 ? " connection" : " connections");
+        log() << "end connection " << pooled->session.remote() << " (" << conns << word
+              << " now open)";
+    }
+
+    // The Client refers to the session, so it must go first.
+    pooled->client.reset();
+}
+
 }  // namespace mongo
@@ -28,6 +28,7 @@
 
 #pragma once
 
+#include <memory>
 #include <vector>
 
 #include "mongo/base/disallow_copying.h"
@@ -36,22 +37,33 @@
 
 namespace mongo {
 
+class Message;
+class ThreadPool;
+
 namespace transport {
 class Session;
 class TransportLayer;
 }  // namespace transport
 
 /**
- * The entry point from the TransportLayer into Mongod. startSession() spawns and
+ * The entry point from the TransportLayer into Mongod. By default startSession() spawns and
  * detaches a new thread for each incoming connection (transport::Session).
+ *
+ * When constructed with a number of worker threads, sessions are instead read with
+ * TransportLayer::asyncWait() and each request is run on a bounded pool of worker threads, so
+ * the number of threads no longer grows with the number of connections. Requests can block on
+ * each other, so once every worker is busy further requests run on threads of their own rather
+ * than waiting for one, up to as many again as there are workers. Requests past that wait in
+ * the pool's queue.
  */
 class ServiceEntryPointMongod final : public ServiceEntryPoint {
     MONGO_DISALLOW_COPYING(ServiceEntryPointMongod);
 
 public:
     explicit ServiceEntryPointMongod(transport::TransportLayer* tl);
+    ServiceEntryPointMongod(transport::TransportLayer* tl, size_t workerThreads);
 
-    virtual ~ServiceEntryPointMongod() = default;
+    virtual ~ServiceEntryPointMongod();
 
     void startSession(transport::Session&& session) override;
 
@@ -60,10 +72,32 @@ public:
     }
 
 private:
+    struct PooledSession;
+
     void _sessionLoop(transport::Session* session);
 
+    /**
+     * Runs one request and sinks its response. Returns true if the request was an exhaust query,
+     * in which case "inMessage" now holds the next getMore to run without sourcing.
+     */
+    bool _processMessage(transport::Session* session, Message* inMessage);
+
+    void _startPooledSession(transport::Session&& session);
+    void _sourcePooled(std::shared_ptr<PooledSession> pooled);
+    void _runPooled(std::shared_ptr<PooledSession> pooled, bool onPool);
+    void _endPooledSession(const std::shared_ptr<PooledSession>& pooled);
+
     transport::TransportLayer* _tl;
     AtomicWord<std::size_t> _nWorkers;
+    std::unique_ptr<ThreadPool> _workers;
+
+    // Requests scheduled on _workers, which runs at most _maxPooledRequests of them at once.
+    const std::size_t _maxPooledRequests = 0;
+    AtomicWord<std::size_t> _pooledRequests;
+
+    // Requests running on threads of their own because the pool was busy.
+    const std::size_t _maxOverflowThreads = 0;
+    AtomicWord<std::size_t> _overflowThreads;
 };
 
 }  // namespace mongo
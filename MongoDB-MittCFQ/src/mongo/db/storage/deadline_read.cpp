@@ -0,0 +1,244 @@
+/**
+ *    Copyright (C) 2016 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/storage/deadline_read.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/concurrency/locker.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/util/timer.h"
+
+namespace mongo {
+
+namespace {
+
+// Syscall number of mzpread64 in the MittCFQ kernel patch (see syscall_64.tbl).
+const long kMzPread64Syscall = 548;
+
+// The kernel's latency threshold (global_history in read_write.c), which it applies to reads
+// without a deadline of their own.
+const Microseconds kKernelDefaultDeadline(13000);
+
+// Each new read moves the averages 1/16th of the way towards its own outcome.
+const double kLoadSampleWeight = 1.0 / 16;
+
+// Time for the averages to halve while no deadline reads are issued.
+const double kLoadHalfLifeMicros = 1000 * 1000;
+
+class StorageLoadTracker {
+public:
+    void note(Microseconds elapsed, Microseconds deadline, bool rejected) {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        _decay_inlock();
+
+        // A rejected read would have taken at least as long as the deadline it was refused for.
+        const Microseconds effectiveDeadline =
+            deadline == Microseconds(0) ? kKernelDefaultDeadline : deadline;
+        const double delay = rejected
+            ? durationCount<Microseconds>(std::max(elapsed, effectiveDeadline))
+            : durationCount<Microseconds>(elapsed);
+        _busyRate += ((rejected ? 1.0 : 0.0) - _busyRate) * kLoadSampleWeight;
+        _readDelayMicros += (delay - _readDelayMicros) * kLoadSampleWeight;
+        _deadlineReads++;
+        _busyRejections += rejected ? 1 : 0;
+    }
+
+    StorageLoad get() {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        _decay_inlock();
+
+        StorageLoad load;
+        load.busyRate = _busyRate;
+        load.predictedReadDelay = Microseconds(static_cast<long long>(_readDelayMicros));
+        load.deadlineReads = _deadlineReads;
+        load.busyRejections = _busyRejections;
+        return load;
+    }
+
+private:
+    void _decay_inlock() {
+        const long long now = static_cast<long long>(curTimeMicros64());
+        if (now > _lastUpdateMicros) {
+            const double factor = std::pow(0.5, (now - _lastUpdateMicros) / kLoadHalfLifeMicros);
+            _busyRate *= factor;
+            _readDelayMicros *= factor;
+        }
+        _lastUpdateMicros = now;
+    }
+
+    stdx::mutex _mutex;
+    double _busyRate = 0;
+    double _readDelayMicros = 0;
+    long long _lastUpdateMicros = 0;
+    long long _deadlineReads = 0;
+    long long _busyRejections = 0;
+};
+
+StorageLoadTracker storageLoadTracker;
+
+// StorageReadStats of an operation, atomic since currentOp reads them from another thread.
+struct StorageReadCounters {
+    AtomicInt64 reads;
+    AtomicInt64 bytesRead;
+    AtomicInt64 timeReadingMicros;
+    AtomicInt64 busyRejections;
+};
+
+const auto getStorageReadCounters = OperationContext::declareDecoration<StorageReadCounters>();
+
+}  // namespace
+
+Microseconds storageReadDeadline(OperationContext* txn) {
+    if (!txn || !txn->hasDeadline()) {
+        return Microseconds(0);
+    }
+
+    // An operation that is already out of time gets the tightest deadline rather than the
+    // kernel default; it is about to be interrupted anyway.
+    return std::max(Microseconds(txn->getRemainingMaxTimeMillis()), Microseconds(1));
+}
+
+bool canUseDeadlineReads(OperationContext* txn) {
+    return txn && !txn->lockState()->isWriteLocked();
+}
+
+bool kernelHasDeadlineReads() {
+#if defined(__linux__)
+    // Kernels with the syscall fail a read of a bad descriptor with EBADF rather than ENOSYS.
+    static const bool hasDeadlineReads =
+        syscall(kMzPread64Syscall, -1, nullptr, 0, 0, 0L) >= 0 || errno != ENOSYS;
+    return hasDeadlineReads;
+#else
+    return false;
+#endif
+}
+
+ssize_t deadlinePread(OperationContext* txn, int fd, void* buf, size_t count, off_t offset) {
+#if defined(__linux__)
+    const Microseconds deadline = storageReadDeadline(txn);
+    Timer timer;
+    const ssize_t ret = syscall(kMzPread64Syscall,
+                                fd,
+                                buf,
+                                count,
+                                offset,
+                                static_cast<long>(durationCount<Microseconds>(deadline)));
+    // The kernel fails a rejected read with EBUSY, or returns a short count if part of it was
+    // read first. Other failures are not the scheduler's doing and are not counted.
+    const bool rejected =
+        (ret < 0 && errno == EBUSY) || (ret >= 0 && static_cast<size_t>(ret) < count);
+    if (ret >= 0 || rejected) {
+        const int savedErrno = errno;
+        const Microseconds elapsed = timer.elapsed();
+        noteDeadlineRead(elapsed, deadline, rejected);
+        if (txn) {
+            StorageReadStats stats;
+            stats.reads = 1;
+            stats.bytesRead = std::max(ret, static_cast<ssize_t>(0));
+            stats.timeReading = elapsed;
+            stats.busyRejections = rejected ? 1 : 0;
+            StorageReadStats::add(txn, stats);
+        }
+        errno = savedErrno;
+    }
+    return ret;
+#else
+    errno = ENOSYS;
+    return -1;
+#endif
+}
+
+void noteDeadlineRead(Microseconds elapsed, Microseconds deadline, bool rejected) {
+    storageLoadTracker.note(elapsed, deadline, rejected);
+}
+
+StorageLoad getStorageLoad() {
+    return storageLoadTracker.get();
+}
+
+StorageReadStats StorageReadStats::get(OperationContext* txn) {
+    const StorageReadCounters& counters = getStorageReadCounters(txn);
+    StorageReadStats stats;
+    stats.reads = counters.reads.load();
+    stats.bytesRead = counters.bytesRead.load();
+    stats.timeReading = Microseconds(counters.timeReadingMicros.load());
+    stats.busyRejections = counters.busyRejections.load();
+    return stats;
+}
+
+void StorageReadStats::add(OperationContext* txn, const StorageReadStats& stats) {
+    StorageReadCounters& counters = getStorageReadCounters(txn);
+    counters.reads.fetchAndAdd(stats.reads);
+    counters.bytesRead.fetchAndAdd(stats.bytesRead);
+    counters.timeReadingMicros.fetchAndAdd(durationCount<Microseconds>(stats.timeReading));
+    counters.busyRejections.fetchAndAdd(stats.busyRejections);
+}
+
+StorageReadStats& StorageReadStats::operator+=(const StorageReadStats& other) {
+    reads += other.reads;
+    bytesRead += other.bytesRead;
+    timeReading += other.timeReading;
+    busyRejections += other.busyRejections;
+    return *this;
+}
+
+StorageReadStats& StorageReadStats::operator-=(const StorageReadStats& other) {
+    reads -= other.reads;
+    bytesRead -= other.bytesRead;
+    timeReading -= other.timeReading;
+    busyRejections -= other.busyRejections;
+    return *this;
+}
+
+void StorageReadStats::append(BSONObjBuilder* builder) const {
+    builder->appendNumber("reads", reads);
+    builder->appendNumber("bytesRead", bytesRead);
+    builder->appendNumber("timeReadingMicros", durationCount<Microseconds>(timeReading));
+    builder->appendNumber("busyRejections", busyRejections);
+}
+
+std::string StorageReadStats::toString() const {
+    BSONObjBuilder builder;
+    append(&builder);
+    return builder.obj().toString();
+}
+
+}  // namespace mongo
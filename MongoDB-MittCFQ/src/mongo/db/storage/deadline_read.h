@@ -0,0 +1,130 @@
+/**
+ *    Copyright (C) 2016 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <string>
+#include <sys/types.h>
+
+#include "mongo/util/time_support.h"
+
+namespace mongo {
+
+class BSONObjBuilder;
+class OperationContext;
+
+/**
+ * Returns the deadline to attach to a storage read issued on behalf of 'txn', which is the time
+ * left before the operation exceeds its maxTimeMS. Returns zero, meaning "use the kernel's
+ * default threshold", if 'txn' is null or has no time limit.
+ */
+Microseconds storageReadDeadline(OperationContext* txn);
+
+/**
+ * Returns true if storage reads issued on behalf of 'txn' may be bounded by a deadline and so
+ * rejected by the I/O scheduler. Operations that hold a write lock never qualify, so that a
+ * rejected read cannot leave a write half done.
+ */
+bool canUseDeadlineReads(OperationContext* txn);
+
+/**
+ * Returns true if the running kernel implements deadline reads (mzpread64). Without them,
+ * deadlinePread() fails with ENOSYS and storage engines read as usual.
+ */
+bool kernelHasDeadlineReads();
+
+/**
+ * Reads 'count' bytes at 'offset' of 'fd' with the MittCFQ deadline-aware pread (mzpread64),
+ * bounded by storageReadDeadline(txn). The kernel rejects the read instead of queueing it when it
+ * predicts that the read cannot complete within the deadline. The read is counted in the
+ * StorageReadStats of 'txn'.
+ *
+ * Returns the number of bytes read, or -1 with errno set. A rejected read fails with EBUSY, or
+ * returns a short count if part of it was read before the rejection; callers read within the
+ * file, so any short count means the rest was rejected. ENOSYS means the kernel has no deadline
+ * reads.
+ */
+ssize_t deadlinePread(OperationContext* txn, int fd, void* buf, size_t count, off_t offset);
+
+/**
+ * Records the outcome of one deadline read: how long it took and whether the I/O scheduler
+ * rejected it. A rejected read is counted as taking at least 'deadline', or the kernel's default
+ * threshold if 'deadline' is 0. Only reads that went to the I/O scheduler belong here. Called by
+ * deadlinePread() itself and by storage engines that issue deadline reads on their own.
+ */
+void noteDeadlineRead(Microseconds elapsed, Microseconds deadline, bool rejected);
+
+/**
+ * A smoothed summary of recent deadline reads on this node. The busy rate and read delay decay
+ * towards zero while the node serves no reads, so a member that clients stopped using because it
+ * was busy gets tried again. The counts are cumulative, for FTDC.
+ */
+struct StorageLoad {
+    double busyRate = 0;                  // fraction of deadline reads that were rejected
+    Microseconds predictedReadDelay{0};  // expected time a read waits for the disk
+    long long deadlineReads = 0;          // deadline reads issued since startup
+    long long busyRejections = 0;         // of those, how many the kernel rejected
+};
+
+StorageLoad getStorageLoad();
+
+/**
+ * Storage reads issued on behalf of one operation, whether or not they carried a deadline. Storage
+ * engines add to the stats of the operation they read for; CurOp reports them in currentOp, the
+ * profiler and the slow operation log line.
+ */
+struct StorageReadStats {
+    long long reads = 0;
+    long long bytesRead = 0;
+    Microseconds timeReading{0};   // time the operation was blocked in those reads
+    long long busyRejections = 0;  // deadline reads rejected by the I/O scheduler
+
+    /**
+     * Returns the reads counted for 'txn' so far. Other threads, such as currentOp, may call this
+     * while 'txn' is reading; each counter is then current, though not necessarily in step with
+     * the others.
+     */
+    static StorageReadStats get(OperationContext* txn);
+
+    /**
+     * Adds 'stats' to the reads counted for 'txn'.
+     */
+    static void add(OperationContext* txn, const StorageReadStats& stats);
+
+    StorageReadStats& operator+=(const StorageReadStats& other);
+    StorageReadStats& operator-=(const StorageReadStats& other);
+
+    bool empty() const {
+        return reads == 0 && busyRejections == 0;
+    }
+
+    void append(BSONObjBuilder* builder) const;
+    std::string toString() const;
+};
+
+}  // namespace mongo
@@ -2391,7 +2391,9 @@ typename BtreeLogic<BtreeLayout>::BucketType* BtreeLogic<BtreeLayout>::getBucket
         return NULL;
     }
 
-    RecordData recordData = _recordStore->dataFor(txn, id,0);
+    // Bring cold buckets in with a deadline read so that a busy disk fails the lookup instead of
+    // stalling it on a page fault.
+    RecordData recordData = _recordStore->dataFor(txn, id, 2);
 
     // we need to be working on the raw bytes, not a transient copy
     invariant(!recordData.isOwned());
@@ -37,6 +37,7 @@
 #include "mongo/db/instance.h"
 #include "mongo/db/operation_context_noop.h"
 #include "mongo/db/storage/mmap_v1/btree/btree_test_help.h"
+#include "mongo/db/storage/storage_busy_exception.h"
 #include "mongo/unittest/unittest.h"
 #include "mongo/util/log.h"
 
@@ -2213,6 +2214,29 @@ public:
     }
 };
 
+template <class OnDiskFormat>
+class LocateStorageBusy : public BtreeLogicTestBase<OnDiskFormat> {
+public:
+    void run() {
+        OperationContextNoop txn;
+        this->_helper.btree.initAsEmpty(&txn);
+
+        BSONObj key = simpleKey('a');
+        this->insert(key, this->_helper.dummyDiskLoc);
+
+        // Buckets are read with deadline reads, so a busy disk fails the lookup.
+        this->_helper.recordStore.setReadsBusy(true);
+        int pos;
+        DiskLoc loc;
+        ASSERT_THROWS(
+            this->_helper.btree.locate(&txn, key, this->_helper.dummyDiskLoc, 1, &pos, &loc),
+            StorageBusyException);
+
+        this->_helper.recordStore.setReadsBusy(false);
+        this->locate(key, 0, true, this->_helper.headManager.getHead(&txn), 1);
+    }
+};
+
 template <class OnDiskFormat>
 class DuplicateKeys : public BtreeLogicTestBase<OnDiskFormat> {
 public:
@@ -2486,6 +2510,7 @@ public:
 
         add<LocateEmptyForward<OnDiskFormat>>();
         add<LocateEmptyReverse<OnDiskFormat>>();
+        add<LocateStorageBusy<OnDiskFormat>>();
 
         add<DuplicateKeys<OnDiskFormat>>();
     }
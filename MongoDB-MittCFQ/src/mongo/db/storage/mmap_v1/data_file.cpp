@@ -40,6 +40,7 @@
 
 #include "mongo/base/static_assert.h"
 #include "mongo/db/operation_context.h"
+#include "mongo/db/service_context.h"
 #include "mongo/db/storage/mmap_v1/dur.h"
 #include "mongo/db/storage/mmap_v1/durable_mapped_file.h"
 #include "mongo/db/storage/mmap_v1/file_allocator.h"
@@ -118,6 +119,7 @@ Status DataFile::openExisting(const char* filename) {
     // The mapped view of the file should never be NULL if the open call above succeeded.
     _mb = mmf.getView();
     invariant(_mb);
+    _residency.init(getGlobalServiceContext()->getFastClockSource(), _mb, mmf.length());
 
     const uint64_t sz = mmf.length();
     invariant(sz <= 0x7fffffff);
@@ -179,6 +181,7 @@ void DataFile::open(OperationContext* txn,
     }
 
     data_file_check(_mb);
+    _residency.init(getGlobalServiceContext()->getFastClockSource(), _mb, size);
     header()->init(txn, _fileNo, size, filename);
 }
 
@@ -33,6 +33,7 @@
 #include "mongo/bson/util/builder.h"
 #include "mongo/db/storage/mmap_v1/diskloc.h"
 #include "mongo/db/storage/mmap_v1/durable_mapped_file.h"
+#include "mongo/db/storage/mmap_v1/page_residency_map.h"
 #include "mongo/platform/bits.h"
 
 namespace mongo {
@@ -252,5 +253,8 @@ private:
 
     DurableMappedFile mmf;
     void* _mb;  // the memory mapped view
+
+    // Which pages of the view are in the page cache; mutable since reads update it.
+    mutable PageResidencyMap _residency;
 };
 }
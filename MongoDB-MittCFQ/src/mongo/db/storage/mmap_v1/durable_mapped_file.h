@@ -102,7 +102,7 @@ public:
     int fileSuffixNo() const {
         return _fileSuffixNo;
     }
-    HANDLE getFd() {
+    HANDLE getFd() const {
         return MemoryMappedFile::getFd();
     }
 
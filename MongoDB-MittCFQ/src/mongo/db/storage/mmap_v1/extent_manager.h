@@ -32,6 +32,7 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "mongo/base/status.h"
@@ -118,9 +119,43 @@ public:
      * A MmapV1RecordHeader DiskLoc has an offset from a file, while a RecordStore really wants an
      * offset from an extent.  This intrinsically links an original record store to the original
      * extent manager.
+     *
+     * If 'fromDisk' is 1 this is readRecordForV1() without an operation, which reads through the
+     * mapping.
      */
     virtual MmapV1RecordHeader* recordForV1(const DiskLoc& loc, int fromDisk) const = 0;
 
+    /**
+     * Like recordForV1(), but first brings the record into the page cache with a deadline-bounded
+     * read if it is likely cold. The deadline is the time 'txn' has left before it exceeds its
+     * maxTimeMS, or the kernel's default threshold if it has no time limit. Operations that
+     * can't use deadline reads (see canUseDeadlineReads()) read through the mapping.
+     *
+     * Throws StorageBusyException if the I/O scheduler rejects the read.
+     */
+    virtual MmapV1RecordHeader* readRecordForV1(OperationContext* txn,
+                                                const DiskLoc& loc) const = 0;
+
+    /**
+     * Brings the 'length' bytes at 'loc' into memory with one deadline-bounded read, so that
+     * dereferencing them through the mapping does not block on disk. Does nothing if they are
+     * already in memory, if 'txn' cannot use deadline reads (see canUseDeadlineReads()), or if
+     * the kernel has no deadline reads.
+     *
+     * Throws StorageBusyException if the I/O scheduler rejects the read.
+     */
+    virtual void touchForRead(OperationContext* txn, const DiskLoc& loc, int length) const = 0;
+
+    /**
+     * Like touchForRead() for each (loc, length) pair in 'ranges', which should be sorted by
+     * DiskLoc. Cold ranges that lie close together in the same file are brought in with a
+     * single deadline-bounded read.
+     *
+     * Throws StorageBusyException if the I/O scheduler rejects a read.
+     */
+    virtual void touchManyForRead(OperationContext* txn,
+                                  const std::vector<std::pair<DiskLoc, int>>& ranges) const = 0;
+
     /**
      * The extent manager tracks accesses to DiskLocs. This returns non-NULL if the DiskLoc has
      * been recently accessed, and therefore has likely been paged into physical memory.
@@ -37,12 +37,17 @@
 
 #include "mongo/base/checked_cast.h"
 #include "mongo/db/operation_context.h"
+#include "mongo/db/storage/storage_busy_exception.h"
 #include "mongo/util/log.h"
 #include "mongo/util/mongoutils/str.h"
 
 namespace mongo {
 
 RecordData HeapRecordStoreBtree::dataFor(OperationContext* txn, const RecordId& loc, int fromDisk) const {
+    if (fromDisk == 2 && _readsBusy) {
+        throw StorageBusyException("deadline read rejected");
+    }
+
     Records::const_iterator it = _records.find(loc);
     invariant(it != _records.end());
     const MmapV1RecordHeader& rec = it->second;
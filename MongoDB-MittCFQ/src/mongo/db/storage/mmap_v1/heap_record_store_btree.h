@@ -161,6 +161,14 @@ public:
     }
     // more things that we actually care about below
 
+    /**
+     * Makes reads of records in place from disk (fromDisk == 2), as BtreeLogic does for its
+     * buckets, throw StorageBusyException as if the I/O scheduler had rejected them.
+     */
+    void setReadsBusy(bool busy) {
+        _readsBusy = busy;
+    }
+
 private:
     struct MmapV1RecordHeader {
         MmapV1RecordHeader() : dataSize(-1), data() {}
@@ -175,6 +183,7 @@ private:
     typedef std::map<RecordId, HeapRecordStoreBtree::MmapV1RecordHeader> Records;
     Records _records;
     int64_t _nextId;
+    bool _readsBusy = false;
 };
 
 /**
@@ -39,6 +39,7 @@
 #include "mongo/db/client.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/service_context.h"
+#include "mongo/db/storage/deadline_read.h"
 #include "mongo/db/storage/mmap_v1/data_file.h"
 #include "mongo/db/storage/mmap_v1/dur.h"
 #include "mongo/db/storage/mmap_v1/extent.h"
@@ -48,10 +49,13 @@
 #include "mongo/db/storage/mmap_v1/mmap_v1_options.h"
 #include "mongo/db/storage/mmap_v1/record.h"
 #include "mongo/db/storage/record_fetcher.h"
+#include "mongo/db/storage/storage_busy_exception.h"
 #include "mongo/stdx/memory.h"
 #include "mongo/util/fail_point_service.h"
 #include "mongo/util/file.h"
 #include "mongo/util/log.h"
+#include "mongo/util/mongoutils/str.h"
+#include "mongo/util/processinfo.h"
 
 namespace mongo {
 
@@ -61,8 +65,6 @@ using std::max;
 using std::string;
 using std::stringstream;
 
-static int new_fds[10] = {-1,-1,-1,-1,-1,-1,-1,-1,-1,-1};
-
 // Turn on this failpoint to force the system to yield for a fetch. Setting to "alwaysOn"
 // will cause yields for fetching to occur on every 'kNeedsFetchFailFreq'th call to
 // recordNeedsFetch().
@@ -70,10 +72,19 @@ static const int kNeedsFetchFailFreq = 2;
 static Counter64 needsFetchFailCounter;
 MONGO_FP_DECLARE(recordNeedsFetchFail);
 
+// Turn on this failpoint to make touchForRead() and touchManyForRead() fail with StorageBusy, as
+// if the I/O scheduler had rejected their reads, even when the pages are resident.
+MONGO_FP_DECLARE(mmapv1ReadBusy);
+
 // Used to make sure the compiler doesn't get too smart on us when we're
 // trying to touch records.
 volatile int __record_touch_dummy = 1;
 
+// touchManyForRead() reads the pages between two cold ranges along with them if the gap is at
+// most this large, as long as the combined read stays within kMaxTouchBatchBytes.
+static const unsigned long long kMaxTouchGapBytes = 64 * 1024;
+static const unsigned long long kMaxTouchBatchBytes = 1024 * 1024;
+
 class MmapV1RecordFetcher : public RecordFetcher {
     MONGO_DISALLOW_COPYING(MmapV1RecordFetcher);
 
@@ -281,7 +292,7 @@ long long MmapV1ExtentManager::fileSize() const {
     return size;
 }
 
-MmapV1RecordHeader* MmapV1ExtentManager::_recordForV1(const DiskLoc& loc, int fromDisk) const {
+MmapV1RecordHeader* MmapV1ExtentManager::_recordForV1(const DiskLoc& loc) const {
     loc.assertOk();
     const DataFile* df = _getOpenFile(loc.a());
 
@@ -289,65 +300,163 @@ MmapV1RecordHeader* MmapV1ExtentManager::_recordForV1(const DiskLoc& loc, int fr
     if (ofs < DataFileHeader::HeaderSize) {
         df->badOfs(ofs);  // will msgassert - external call to keep out of the normal code path
     }
-     MmapV1RecordHeader* real_header = reinterpret_cast<MmapV1RecordHeader*>(df->p() + ofs);
-    if(fromDisk==1){
-	int length = real_header->lengthWithHeaders();
-        DataFile* c_df = const_cast<DataFile*>(df);
-        std::string indexStr = c_df->mmf.filename().substr(strlen(c_df->mmf.filename().c_str())-1,1);
-        int index = atoi(indexStr.c_str());
-        int new_fd = new_fds[index];
-        if(new_fd==-1){
-                std::string prefix = c_df->mmf.filename().substr(0,16);
-                std::string post = c_df->mmf.filename().substr(21,strlen(c_df->mmf.filename().c_str())-21);
-                std::string mid = "backup/";
-                prefix.append(mid);
-                prefix.append(post);
-                new_fd = open(prefix.c_str(), O_RDONLY);
-                new_fds[index] = new_fd;
-        }
-        void *buff;
-        int sz = length;
-        int mem_result;
-        mem_result = posix_memalign(&buff, sz, sz);
-        int read_result;
-	MmapV1RecordHeader* fake_header;
-        read_result = syscall(548,new_fd,buff,sz,ofs);
-	
-	if(read_result!=sz){
-		int lengthWithHeaders = real_header->lengthWithHeaders();
-        	int extentOfs = real_header->extentOfs();
-        	int nextOfs = real_header->nextOfs();
-        	int prevOfs = real_header->prevOfs();
-       		fake_header = new MmapV1RecordHeader(lengthWithHeaders,extentOfs,nextOfs,prevOfs);
-	}else{
-        	fake_header = reinterpret_cast<MmapV1RecordHeader*>((char*)buff);
-	}
-        return fake_header;
-    }else if(fromDisk==2){
-        int lengthWithHeaders = real_header->lengthWithHeaders();//real_header->lengthWithHeaders();
-        int extentOfs = real_header->extentOfs();
-        int nextOfs = real_header->nextOfs();
-        int prevOfs = real_header->prevOfs();
-        MmapV1RecordHeader* empty_header = new MmapV1RecordHeader(lengthWithHeaders,extentOfs,nextOfs,prevOfs);
-        return empty_header;
-    }else if(fromDisk==3){
-        return NULL;
-    }
-    //printf("using real header...\n");
-    return real_header;
 
+    return reinterpret_cast<MmapV1RecordHeader*>(df->p() + ofs);
 }
 
 MmapV1RecordHeader* MmapV1ExtentManager::recordForV1(const DiskLoc& loc, int fromDisk) const {
-    MmapV1RecordHeader* record = _recordForV1(loc,fromDisk);
+    if (fromDisk == 1) {
+        return readRecordForV1(nullptr, loc);
+    }
+
+    MmapV1RecordHeader* record = _recordForV1(loc);
     _recordAccessTracker->markAccessed(record);
     return record;
 }
 
+MmapV1RecordHeader* MmapV1ExtentManager::readRecordForV1(OperationContext* txn,
+                                                         const DiskLoc& loc) const {
+    // Operations that can't take a rejection, and records already in the page cache, are served
+    // straight from the mapping. Only likely-cold ones pay for the syscall.
+    MmapV1RecordHeader* record = _recordForV1(loc);
+    _recordAccessTracker->markAccessed(record);
+    if (!canUseDeadlineReads(txn)) {
+        return record;
+    }
+
+    const DataFile* df = _getOpenFile(loc.a());
+    const unsigned long long pageSize = ProcessInfo::getPageSize();
+    const unsigned long long begin = loc.getOfs() & ~(pageSize - 1);
+    if (!df->_residency.isResident(begin, loc.getOfs() + MmapV1RecordHeader::HeaderSize - begin)) {
+        // The record's length is in its header, so the header has to be read first.
+        const unsigned long long end =
+            std::min(df->length(), static_cast<unsigned long long>(loc.getOfs()) + pageSize);
+        if (!_readPagesForRead(txn, df, loc, begin, end)) {
+            return record;
+        }
+    }
+
+    // Marking the pages resident spares the next read of this record, or of its neighbours,
+    // the syscall.
+    const unsigned long long end = std::min(
+        df->length(), static_cast<unsigned long long>(loc.getOfs()) + record->lengthWithHeaders());
+    if (end > begin && !df->_residency.isResident(begin, end - begin)) {
+        _readPagesForRead(txn, df, loc, begin, end);
+    }
+    return record;
+}
+
+void MmapV1ExtentManager::touchForRead(OperationContext* txn,
+                                       const DiskLoc& loc,
+                                       int length) const {
+    touchManyForRead(txn, {{loc, length}});
+}
+
+void MmapV1ExtentManager::touchManyForRead(
+    OperationContext* txn, const std::vector<std::pair<DiskLoc, int>>& ranges) const {
+    if (!canUseDeadlineReads(txn)) {
+        return;
+    }
+
+    if (MONGO_FAIL_POINT(mmapv1ReadBusy) && !ranges.empty()) {
+        throw StorageBusyException(str::stream() << "deadline read at "
+                                                 << ranges.front().first.toString()
+                                                 << " rejected by the mmapv1ReadBusy failpoint");
+    }
+
+    const unsigned long long pageSize = ProcessInfo::getPageSize();
+
+    // The pending read, [batchBegin, batchEnd) of batchFile, grows to cover the cold ranges
+    // that follow it closely and is issued once the next cold range is too far away.
+    const DataFile* batchFile = nullptr;
+    DiskLoc batchLoc;
+    unsigned long long batchBegin = 0;
+    unsigned long long batchEnd = 0;
+
+    for (const auto& range : ranges) {
+        const DiskLoc& loc = range.first;
+        loc.assertOk();
+        const DataFile* df = _getOpenFile(loc.a());
+        const unsigned long long begin = loc.getOfs() & ~(pageSize - 1);
+        const unsigned long long end =
+            std::min(df->length(), static_cast<unsigned long long>(loc.getOfs()) + range.second);
+        if (end <= begin) {
+            continue;
+        }
+
+        _recordAccessTracker->markAccessed(df->p() + loc.getOfs());
+        if (df->_residency.isResident(begin, end - begin)) {
+            continue;
+        }
+
+        if (df == batchFile && begin >= batchBegin && begin <= batchEnd + kMaxTouchGapBytes &&
+            end - batchBegin <= kMaxTouchBatchBytes) {
+            batchEnd = std::max(batchEnd, end);
+            continue;
+        }
+
+        if (batchFile && !_readPagesForRead(txn, batchFile, batchLoc, batchBegin, batchEnd)) {
+            return;
+        }
+        batchFile = df;
+        batchLoc = loc;
+        batchBegin = begin;
+        batchEnd = end;
+    }
+
+    if (batchFile) {
+        _readPagesForRead(txn, batchFile, batchLoc, batchBegin, batchEnd);
+    }
+}
+
+bool MmapV1ExtentManager::_readPagesForRead(OperationContext* txn,
+                                            const DataFile* df,
+                                            const DiskLoc& loc,
+                                            unsigned long long begin,
+                                            unsigned long long end) const {
+    if (!_deadlineReadPages(txn, df, loc, begin, end)) {
+        return false;
+    }
+    df->_residency.markResident(begin, end - begin);
+    return true;
+}
+
+bool MmapV1ExtentManager::_deadlineReadPages(OperationContext* txn,
+                                             const DataFile* df,
+                                             const DiskLoc& loc,
+                                             unsigned long long begin,
+                                             unsigned long long end) const {
+    // Reading the file through the page cache is enough: the mapping then finds the pages there
+    // instead of going to disk. The bytes read are not used.
+    const size_t size = end - begin;
+    std::unique_ptr<char[]> scratch(new char[size]);
+    ssize_t readResult = deadlinePread(txn, df->mmf.getFd(), scratch.get(), size, begin);
+    if (readResult < 0 && errno == EBUSY) {
+        throw StorageBusyException(str::stream() << "deadline read of " << size << " bytes at "
+                                                 << loc.toString() << " in "
+                                                 << df->mmf.filename()
+                                                 << " rejected by the I/O scheduler");
+    }
+    if (readResult < 0) {
+        // Not a MittCFQ kernel (ENOSYS), or a failure the scheduler had no part in: let the
+        // mapping fault the pages in as usual and report any real error from there.
+        return false;
+    }
+    if (readResult != static_cast<ssize_t>(size)) {
+        // The kernel stops at the first rejected page, having read the ones before it.
+        throw StorageBusyException(str::stream() << "deadline read of " << size << " bytes at "
+                                                 << loc.toString() << " in "
+                                                 << df->mmf.filename()
+                                                 << " rejected by the I/O scheduler after "
+                                                 << readResult << " bytes");
+    }
+    return true;
+}
+
 std::unique_ptr<RecordFetcher> MmapV1ExtentManager::recordNeedsFetch(const DiskLoc& loc) const {
     if (loc.isNull())
         return {};
-    MmapV1RecordHeader* record = _recordForV1(loc,0);
+    MmapV1RecordHeader* record = _recordForV1(loc);
 
     // For testing: if failpoint is enabled we randomly request fetches without
     // going to the RecordAccessTracker.
@@ -123,6 +123,13 @@ public:
      */
     MmapV1RecordHeader* recordForV1(const DiskLoc& loc,int fromDisk) const;
 
+    MmapV1RecordHeader* readRecordForV1(OperationContext* txn, const DiskLoc& loc) const;
+
+    void touchForRead(OperationContext* txn, const DiskLoc& loc, int length) const;
+
+    void touchManyForRead(OperationContext* txn,
+                          const std::vector<std::pair<DiskLoc, int>>& ranges) const;
+
     std::unique_ptr<RecordFetcher> recordNeedsFetch(const DiskLoc& loc) const;
 
     /**
@@ -173,7 +180,29 @@ private:
      * Shared record retrieval logic used by the public recordForV1() and likelyInPhysicalMem()
      * above.
      */
-    MmapV1RecordHeader* _recordForV1(const DiskLoc& loc, int fromDisk) const;
+    MmapV1RecordHeader* _recordForV1(const DiskLoc& loc) const;
+
+    /**
+     * Deadline-reads the page aligned range [begin, end) of 'df' into the page cache, on behalf
+     * of a read of 'loc', and marks it resident. Returns false if the kernel has no deadline
+     * reads.
+     */
+    bool _readPagesForRead(OperationContext* txn,
+                           const DataFile* df,
+                           const DiskLoc& loc,
+                           unsigned long long begin,
+                           unsigned long long end) const;
+
+    /**
+     * The read behind _readPagesForRead(). Throws StorageBusyException if the I/O scheduler
+     * rejects it, and returns false if it fails for any other reason, in which case the caller
+     * falls back to the mapping.
+     */
+    bool _deadlineReadPages(OperationContext* txn,
+                            const DataFile* df,
+                            const DiskLoc& loc,
+                            unsigned long long begin,
+                            unsigned long long end) const;
 
     DiskLoc _getFreeListStart() const;
     DiskLoc _getFreeListEnd() const;
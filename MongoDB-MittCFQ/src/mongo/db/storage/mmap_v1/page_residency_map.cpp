@@ -0,0 +1,134 @@
+/**
+ *    Copyright (C) 2016 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/storage/mmap_v1/page_residency_map.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "mongo/util/clock_source.h"
+#include "mongo/util/processinfo.h"
+#include "mongo/util/time_support.h"
+
+namespace mongo {
+
+void PageResidencyMap::init(ClockSource* cs, const void* base, unsigned long long length) {
+    _clock = cs;
+    _base = static_cast<const char*>(base);
+    _pageSize = ProcessInfo::getPageSize();
+    _numPages = (length + _pageSize - 1) / _pageSize;
+    _chunks.reset(new Chunk[(_numPages + PagesPerChunk - 1) / PagesPerChunk]);
+    _systemCheck = _systemCheck && ProcessInfo::blockCheckSupported();
+}
+
+bool PageResidencyMap::isResident(unsigned long long ofs, unsigned long long len) {
+    if (!_chunks || len == 0) {
+        return false;
+    }
+
+    const unsigned long long first = ofs / _pageSize;
+    const unsigned long long last = (ofs + len - 1) / _pageSize;
+    if (last >= _numPages) {
+        return false;
+    }
+
+    const Date_t now = _clock->now();
+    for (unsigned long long chunk = first / PagesPerChunk; chunk <= last / PagesPerChunk;
+         ++chunk) {
+        const uint64_t wanted = _pageMask(chunk, first, last);
+        if ((_residentPages(chunk, now) & wanted) != wanted) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void PageResidencyMap::markResident(unsigned long long ofs, unsigned long long len) {
+    if (!_chunks || len == 0) {
+        return;
+    }
+
+    const unsigned long long first = ofs / _pageSize;
+    const unsigned long long last = std::min((ofs + len - 1) / _pageSize, _numPages - 1);
+    for (unsigned long long chunk = first / PagesPerChunk; chunk <= last / PagesPerChunk;
+         ++chunk) {
+        const uint64_t mask = _pageMask(chunk, first, last);
+        AtomicUInt64& residentPages = _chunks[chunk].residentPages;
+        uint64_t old = residentPages.load();
+        while ((old & mask) != mask) {
+            const uint64_t seen = residentPages.compareAndSwap(old, old | mask);
+            if (seen == old) {
+                break;
+            }
+            old = seen;
+        }
+    }
+}
+
+uint64_t PageResidencyMap::_pageMask(unsigned long long chunk,
+                                     unsigned long long first,
+                                     unsigned long long last) {
+    const unsigned long long chunkFirst = chunk * PagesPerChunk;
+    const unsigned long long lo = std::max(first, chunkFirst) - chunkFirst;
+    const unsigned long long hi = std::min(last, chunkFirst + PagesPerChunk - 1) - chunkFirst;
+    return (~0ULL >> (PagesPerChunk - 1 - hi)) & (~0ULL << lo);
+}
+
+uint64_t PageResidencyMap::_residentPages(unsigned long long chunk, Date_t now) {
+    Chunk& c = _chunks[chunk];
+    const long long nowMillis = now.toMillisSinceEpoch();
+    const long long sampledAtMillis = c.sampledAtMillis.load();
+    if (sampledAtMillis >= 0 && nowMillis - sampledAtMillis < MaxSampleAgeMillis) {
+        return c.residentPages.load();
+    }
+
+    // Stale: ask the kernel again. Concurrent samplers of the same chunk race harmlessly, the
+    // last one to finish wins.
+    uint64_t residentPages = 0;
+    if (_systemCheck) {
+        const unsigned long long firstPage = chunk * PagesPerChunk;
+        const size_t numPages =
+            std::min(static_cast<unsigned long long>(PagesPerChunk), _numPages - firstPage);
+        std::vector<char> pages;
+        if (ProcessInfo::pagesInMemory(_base + firstPage * _pageSize, numPages, &pages)) {
+            for (size_t i = 0; i < numPages; ++i) {
+                if (pages[i]) {
+                    residentPages |= 1ULL << i;
+                }
+            }
+        }
+    }
+
+    c.residentPages.store(residentPages);
+    c.sampledAtMillis.store(nowMillis);
+    return residentPages;
+}
+
+}  // namespace mongo
@@ -0,0 +1,109 @@
+/**
+ *    Copyright (C) 2016 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "mongo/base/disallow_copying.h"
+#include "mongo/platform/atomic_word.h"
+
+namespace mongo {
+
+class ClockSource;
+class Date_t;
+
+/**
+ * Tracks which pages of a memory mapped data file are resident in the page cache, so that
+ * reads of resident records can be served straight from the mapping and only likely-cold
+ * records pay for a deadline read. Residency is sampled with mincore() one chunk of pages at a
+ * time, whenever a chunk is consulted after its last sample went stale, and is also updated
+ * when we read pages in ourselves.
+ *
+ * The kernel may evict a page right after it was sampled, so answers are hints: a page
+ * reported resident can still fault, and a page reported cold may already be cached.
+ */
+class PageResidencyMap {
+    MONGO_DISALLOW_COPYING(PageResidencyMap);
+
+public:
+    enum Constants { PagesPerChunk = 64, MaxSampleAgeMillis = 1000 };
+
+    PageResidencyMap() = default;
+
+    /**
+     * Starts tracking the 'length' bytes mapped at 'base'. Until this is called every page is
+     * reported cold.
+     */
+    void init(ClockSource* cs, const void* base, unsigned long long length);
+
+    /**
+     * @return whether every page overlapping [ofs, ofs + len) is believed to be resident.
+     */
+    bool isResident(unsigned long long ofs, unsigned long long len);
+
+    /**
+     * Records that the pages overlapping [ofs, ofs + len) were just read into the page cache.
+     */
+    void markResident(unsigned long long ofs, unsigned long long len);
+
+    /**
+     * Only learn about residency through markResident(). For testing.
+     */
+    void disableSystemResidencyCheck() {
+        _systemCheck = false;
+    }
+
+private:
+    struct Chunk {
+        AtomicUInt64 residentPages;        // bit i is set if page i of the chunk is resident
+        AtomicInt64 sampledAtMillis{-1};   // -1 if never sampled
+    };
+
+    /**
+     * @return the pages of chunk 'chunk' that fall within pages [first, last], as a bit mask.
+     */
+    static uint64_t _pageMask(unsigned long long chunk,
+                              unsigned long long first,
+                              unsigned long long last);
+
+    /**
+     * @return the resident pages of chunk 'chunk', sampling them first if the last sample is
+     * older than MaxSampleAgeMillis.
+     */
+    uint64_t _residentPages(unsigned long long chunk, Date_t now);
+
+    ClockSource* _clock = nullptr;
+    const char* _base = nullptr;
+    unsigned long long _pageSize = 0;
+    unsigned long long _numPages = 0;
+    std::unique_ptr<Chunk[]> _chunks;
+    bool _systemCheck = true;
+};
+
+}  // namespace mongo
@@ -0,0 +1,114 @@
+/**
+ *    Copyright (C) 2016 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/storage/mmap_v1/page_residency_map.h"
+
+#include "mongo/unittest/unittest.h"
+#include "mongo/util/clock_source_mock.h"
+#include "mongo/util/processinfo.h"
+
+using namespace mongo;
+
+namespace {
+
+const unsigned long long kPageSize = ProcessInfo::getPageSize();
+
+// A mapping of three chunks, so that ranges can straddle chunk boundaries. Never dereferenced
+// since the system residency check is disabled.
+const void* const kBase = reinterpret_cast<const void*>(0x100000);
+const unsigned long long kLength = 3 * PageResidencyMap::PagesPerChunk * kPageSize;
+
+class PageResidencyMapTest : public unittest::Test {
+protected:
+    void setUp() override {
+        map.disableSystemResidencyCheck();
+        map.init(&clock, kBase, kLength);
+    }
+
+    ClockSourceMock clock;
+    PageResidencyMap map;
+};
+
+TEST_F(PageResidencyMapTest, PagesStartCold) {
+    ASSERT_FALSE(map.isResident(0, 1));
+    ASSERT_FALSE(map.isResident(kLength - 1, 1));
+}
+
+TEST_F(PageResidencyMapTest, MarkedPagesAreResident) {
+    ASSERT_FALSE(map.isResident(10 * kPageSize, 100));
+
+    map.markResident(10 * kPageSize, kPageSize);
+
+    ASSERT_TRUE(map.isResident(10 * kPageSize, 100));
+    ASSERT_TRUE(map.isResident(10 * kPageSize + 100, kPageSize - 100));
+    ASSERT_FALSE(map.isResident(9 * kPageSize, 100));
+    ASSERT_FALSE(map.isResident(10 * kPageSize, kPageSize + 1));
+}
+
+TEST_F(PageResidencyMapTest, RangeAcrossChunks) {
+    const unsigned long long chunkBytes = PageResidencyMap::PagesPerChunk * kPageSize;
+    const unsigned long long ofs = chunkBytes - kPageSize;
+
+    ASSERT_FALSE(map.isResident(ofs, 2 * kPageSize));
+
+    map.markResident(ofs, kPageSize);
+    ASSERT_FALSE(map.isResident(ofs, 2 * kPageSize));
+
+    map.markResident(chunkBytes, 1);
+    ASSERT_TRUE(map.isResident(ofs, 2 * kPageSize));
+}
+
+TEST_F(PageResidencyMapTest, RangePastEndIsCold) {
+    ASSERT_FALSE(map.isResident(kLength - kPageSize, kPageSize));
+    map.markResident(kLength - kPageSize, 2 * kPageSize);
+
+    ASSERT_TRUE(map.isResident(kLength - kPageSize, kPageSize));
+    ASSERT_FALSE(map.isResident(kLength - kPageSize, 2 * kPageSize));
+}
+
+TEST_F(PageResidencyMapTest, StaleSamplesAreDropped) {
+    ASSERT_FALSE(map.isResident(0, kPageSize));
+    map.markResident(0, kPageSize);
+    ASSERT_TRUE(map.isResident(0, kPageSize));
+
+    clock.advance(Milliseconds(PageResidencyMap::MaxSampleAgeMillis - 1));
+    ASSERT_TRUE(map.isResident(0, kPageSize));
+
+    clock.advance(Milliseconds(1));
+    ASSERT_FALSE(map.isResident(0, kPageSize));
+}
+
+TEST(PageResidencyMap, UninitializedMapIsCold) {
+    PageResidencyMap map;
+    map.markResident(0, 1);
+    ASSERT_FALSE(map.isResident(0, 1));
+}
+
+}  // namespace
@@ -170,7 +170,7 @@ int64_t RecordStoreV1Base::storageSize(OperationContext* txn,
 }
 
 RecordData RecordStoreV1Base::dataFor(OperationContext* txn, const RecordId& loc, int fromDisk) const {
-    return recordFor(DiskLoc::fromRecordId(loc),fromDisk)->toRecordData();
+    return _recordForRead(txn, DiskLoc::fromRecordId(loc), fromDisk)->toRecordData();
 }
 
 bool RecordStoreV1Base::findRecord(OperationContext* txn,
@@ -179,7 +179,7 @@ bool RecordStoreV1Base::findRecord(OperationContext* txn,
     // this is a bit odd, as the semantics of using the storage engine imply it _has_ to be.
     // And in fact we can't actually check.
     // So we assume the best.
-    MmapV1RecordHeader* rec = recordFor(DiskLoc::fromRecordId(loc),fromDisk);
+    MmapV1RecordHeader* rec = _recordForRead(txn, DiskLoc::fromRecordId(loc), fromDisk);
     if (!rec) {
         return false;
     }
@@ -187,10 +187,57 @@ bool RecordStoreV1Base::findRecord(OperationContext* txn,
     return true;
 }
 
+void RecordStoreV1Base::findRecords(OperationContext* txn,
+                                    const std::vector<RecordId>& locs,
+                                    std::vector<RecordData>* out,
+                                    int fromDisk) const {
+    if (fromDisk == 0) {
+        RecordStore::findRecords(txn, locs, out, fromDisk);
+        return;
+    }
+
+    out->clear();
+    out->resize(locs.size());
+    const std::vector<size_t> order = sortedOrder(locs);
+
+    // Bring the records into memory in disk order first, headers and then bodies, so that
+    // nearby cold records share a deadline read. The lookups below then find them resident.
+    std::vector<std::pair<DiskLoc, int>> ranges;
+    ranges.reserve(order.size());
+    for (size_t i : order) {
+        ranges.emplace_back(DiskLoc::fromRecordId(locs[i]), MmapV1RecordHeader::HeaderSize);
+    }
+    _extentManager->touchManyForRead(txn, ranges);
+    for (auto& range : ranges) {
+        range.second = recordFor(range.first, 0)->lengthWithHeaders();
+    }
+    _extentManager->touchManyForRead(txn, ranges);
+
+    for (size_t i : order) {
+        (*out)[i] = _recordForRead(txn, DiskLoc::fromRecordId(locs[i]), fromDisk)->toRecordData();
+    }
+}
+
 MmapV1RecordHeader* RecordStoreV1Base::recordFor(const DiskLoc& loc,int fromDisk) const {
     return _extentManager->recordForV1(loc,fromDisk);
 }
 
+MmapV1RecordHeader* RecordStoreV1Base::_recordForRead(OperationContext* txn,
+                                                      const DiskLoc& loc,
+                                                      int fromDisk) const {
+    if (fromDisk == 1) {
+        return _extentManager->readRecordForV1(txn, loc);
+    }
+    if (fromDisk == 2) {
+        // The record's length is in its header, so the header has to be in memory first.
+        _extentManager->touchForRead(txn, loc, MmapV1RecordHeader::HeaderSize);
+        MmapV1RecordHeader* rec = recordFor(loc, 0);
+        _extentManager->touchForRead(txn, loc, rec->lengthWithHeaders());
+        return rec;
+    }
+    return recordFor(loc, fromDisk);
+}
+
 const DeletedRecord* RecordStoreV1Base::deletedRecordFor(const DiskLoc& loc) const {
     invariant(loc.a() != -1);
     return reinterpret_cast<const DeletedRecord*>(recordFor(loc,0));
@@ -187,6 +187,11 @@ public:
 
     virtual bool findRecord(OperationContext* txn, const RecordId& loc, RecordData* rd, int fromDisk) const;
 
+    virtual void findRecords(OperationContext* txn,
+                             const std::vector<RecordId>& locs,
+                             std::vector<RecordData>* out,
+                             int fromDisk) const;
+
     void deleteRecord(OperationContext* txn, const RecordId& dl);
 
     StatusWith<RecordId> insertRecord(OperationContext* txn,
@@ -264,6 +269,15 @@ public:
 protected:
     virtual MmapV1RecordHeader* recordFor(const DiskLoc& loc,int fromDisk) const;
 
+    /**
+     * recordFor(), except that deadline reads are bounded by the time 'txn' has left. A
+     * 'fromDisk' of 1 reads a copy of the record; 2 brings the mapped record into memory with a
+     * deadline read and returns it in place.
+     */
+    MmapV1RecordHeader* _recordForRead(OperationContext* txn,
+                                       const DiskLoc& loc,
+                                       int fromDisk) const;
+
     const DeletedRecord* deletedRecordFor(const DiskLoc& loc) const;
 
     virtual bool isCapped() const = 0;
@@ -31,10 +31,18 @@
 #include "mongo/db/catalog/collection.h"
 #include "mongo/db/storage/mmap_v1/extent.h"
 #include "mongo/db/storage/mmap_v1/extent_manager.h"
+#include "mongo/db/storage/mmap_v1/record.h"
 #include "mongo/db/storage/mmap_v1/record_store_v1_simple.h"
 
 namespace mongo {
 
+namespace {
+
+// How much of the data file a scan brings into memory ahead of itself with each deadline read.
+const int kScanBatchBytes = 256 * 1024;
+
+}  // namespace
+
 //
 // Regular / non-capped collection traversal
 //
@@ -80,8 +88,10 @@ boost::optional<Record> SimpleRecordStoreV1Iterator::next() {
     if (isEOF())
         return {};
     auto toReturn = _curr.toRecordId();
+    touchBatch();
+    RecordData data = _recordStore->RecordStore::dataFor(_txn, toReturn, 2);
     advance();
-    return {{toReturn, _recordStore->RecordStore::dataFor(_txn, toReturn,0)}};
+    return {{toReturn, std::move(data)}};
 }
 
 boost::optional<Record> SimpleRecordStoreV1Iterator::seekExact(const RecordId& id) {
@@ -90,6 +100,21 @@ boost::optional<Record> SimpleRecordStoreV1Iterator::seekExact(const RecordId& i
     return {{id, _recordStore->RecordStore::dataFor(_txn, id,1)}};
 }
 
+void SimpleRecordStoreV1Iterator::touchBatch() {
+    if (_curr.a() == _batchStart.a() && _curr.getOfs() >= _batchStart.getOfs() &&
+        _curr.getOfs() + MmapV1RecordHeader::HeaderSize <= _batchStart.getOfs() + kScanBatchBytes) {
+        return;
+    }
+
+    // Records are laid out in disk order within an extent, so the records this scan returns next
+    // are most likely in the window after (or, going backwards, before) the current one.
+    int begin = _forward
+        ? _curr.getOfs()
+        : std::max(0, _curr.getOfs() + MmapV1RecordHeader::HeaderSize - kScanBatchBytes);
+    _batchStart = DiskLoc(_curr.a(), begin);
+    _recordStore->_extentManager->touchForRead(_txn, _batchStart, kScanBatchBytes);
+}
+
 void SimpleRecordStoreV1Iterator::advance() {
     // Move to the next thing.
     if (!isEOF()) {
@@ -63,6 +63,13 @@ public:
 
 private:
     void advance();
+
+    /**
+     * Brings the window of the data file that _curr starts into memory with a deadline read,
+     * unless the last window already covers it. Throws StorageBusyException if the read is
+     * rejected.
+     */
+    void touchBatch();
     bool isEOF() {
         return _curr.isNull();
     }
@@ -72,6 +79,10 @@ private:
 
     // The result returned on the next call to getNext().
     DiskLoc _curr;
+
+    // Start of the window last brought into memory by touchBatch().
+    DiskLoc _batchStart;
+
     const SimpleRecordStoreV1* const _recordStore;
     const bool _forward;
 };
@@ -34,6 +34,7 @@
 #include "mongo/db/storage/mmap_v1/extent.h"
 #include "mongo/db/storage/mmap_v1/record.h"
 #include "mongo/db/storage/mmap_v1/record_store_v1_test_help.h"
+#include "mongo/db/storage/storage_busy_exception.h"
 #include "mongo/unittest/unittest.h"
 
 using namespace mongo;
@@ -449,4 +450,109 @@ TEST(SimpleRecordStoreV1, Truncate) {
         assertStateV1RS(&txn, recs, drecs, NULL, &em, md);
     }
 }
+
+// -----------------
+
+/**
+ * A DummyExtentManager that records the ranges it is asked to bring into memory, and rejects
+ * them like a busy I/O scheduler once 'busy' is set.
+ */
+class TouchRecordingExtentManager : public DummyExtentManager {
+public:
+    void touchForRead(OperationContext* txn, const DiskLoc& loc, int length) const override {
+        touchManyForRead(txn, {{loc, length}});
+    }
+
+    void touchManyForRead(OperationContext* txn,
+                          const std::vector<std::pair<DiskLoc, int>>& ranges) const override {
+        if (busy) {
+            throw StorageBusyException("deadline read rejected");
+        }
+        touched.insert(touched.end(), ranges.begin(), ranges.end());
+    }
+
+    bool busy = false;
+    mutable std::vector<std::pair<DiskLoc, int>> touched;
+};
+
+// The window SimpleRecordStoreV1Iterator brings into memory ahead of a scan.
+const int kScanWindowBytes = 256 * 1024;
+
+TEST(SimpleRecordStoreV1, DataForFromDiskTouchesHeaderThenRecord) {
+    OperationContextNoop txn;
+    TouchRecordingExtentManager em;
+    DummyRecordStoreV1MetaData* md = new DummyRecordStoreV1MetaData(false, 0);
+    SimpleRecordStoreV1 rs(&txn, "test.foo", md, &em, false);
+
+    LocAndSize recs[] = {{DiskLoc(0, 1000), 100}, {}};
+    initializeV1RS(&txn, recs, NULL, NULL, &em, md);
+
+    // Reading in place does not touch anything.
+    rs.dataFor(&txn, DiskLoc(0, 1000).toRecordId(), 0);
+    ASSERT_TRUE(em.touched.empty());
+
+    // fromDisk == 2, as BtreeLogic::getBucket uses, needs the header for the record's length.
+    rs.dataFor(&txn, DiskLoc(0, 1000).toRecordId(), 2);
+    ASSERT_EQUALS(2U, em.touched.size());
+    ASSERT_EQUALS(DiskLoc(0, 1000), em.touched[0].first);
+    ASSERT_EQUALS(MmapV1RecordHeader::HeaderSize, em.touched[0].second);
+    ASSERT_EQUALS(DiskLoc(0, 1000), em.touched[1].first);
+    ASSERT_EQUALS(100, em.touched[1].second);
+
+    em.busy = true;
+    ASSERT_THROWS(rs.dataFor(&txn, DiskLoc(0, 1000).toRecordId(), 2), StorageBusyException);
+    rs.dataFor(&txn, DiskLoc(0, 1000).toRecordId(), 0);
+}
+
+TEST(SimpleRecordStoreV1, ScanTouchesOneWindowAtATime) {
+    OperationContextNoop txn;
+    TouchRecordingExtentManager em;
+    DummyRecordStoreV1MetaData* md = new DummyRecordStoreV1MetaData(false, 0);
+    SimpleRecordStoreV1 rs(&txn, "test.foo", md, &em, false);
+
+    LocAndSize recs[] = {{DiskLoc(0, 1000), 100},
+                         {DiskLoc(0, 1100), 100},
+                         {DiskLoc(0, 1000 + kScanWindowBytes), 100},
+                         {DiskLoc(1, 1000), 100},
+                         {}};
+    initializeV1RS(&txn, recs, NULL, NULL, &em, md);
+
+    auto cursor = rs.getCursor(&txn, true);
+    int count = 0;
+    while (cursor->next()) {
+        count++;
+    }
+    ASSERT_EQUALS(4, count);
+
+    std::vector<DiskLoc> windows;
+    for (const auto& range : em.touched) {
+        if (range.second == kScanWindowBytes) {
+            windows.push_back(range.first);
+        }
+    }
+
+    // The second record is in the first one's window; the third is past it, and the fourth is
+    // in another file.
+    ASSERT_EQUALS(3U, windows.size());
+    ASSERT_EQUALS(DiskLoc(0, 1000), windows[0]);
+    ASSERT_EQUALS(DiskLoc(0, 1000 + kScanWindowBytes), windows[1]);
+    ASSERT_EQUALS(DiskLoc(1, 1000), windows[2]);
+}
+
+TEST(SimpleRecordStoreV1, ScanThrowsWhenWindowIsRejected) {
+    OperationContextNoop txn;
+    TouchRecordingExtentManager em;
+    DummyRecordStoreV1MetaData* md = new DummyRecordStoreV1MetaData(false, 0);
+    SimpleRecordStoreV1 rs(&txn, "test.foo", md, &em, false);
+
+    LocAndSize recs[] = {{DiskLoc(0, 1000), 100}, {DiskLoc(0, 1000 + kScanWindowBytes), 100}, {}};
+    initializeV1RS(&txn, recs, NULL, NULL, &em, md);
+
+    auto cursor = rs.getCursor(&txn, true);
+    ASSERT_TRUE(cursor->next());
+
+    // Only the next window goes to disk.
+    em.busy = true;
+    ASSERT_THROWS(cursor->next(), StorageBusyException);
+}
 }
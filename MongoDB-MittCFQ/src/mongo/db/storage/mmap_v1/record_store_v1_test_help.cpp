@@ -255,6 +255,11 @@ void DummyExtentManager::freeListStats(OperationContext* txn,
     invariant(false);
 }
 
+MmapV1RecordHeader* DummyExtentManager::readRecordForV1(OperationContext* txn,
+                                                        const DiskLoc& loc) const {
+    return recordForV1(loc, 0);
+}
+
 std::unique_ptr<RecordFetcher> DummyExtentManager::recordNeedsFetch(const DiskLoc& loc) const {
     return {};
 }
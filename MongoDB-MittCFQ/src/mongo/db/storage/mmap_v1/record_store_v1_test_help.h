@@ -130,6 +130,13 @@ public:
 
     virtual MmapV1RecordHeader* recordForV1(const DiskLoc& loc,int fromDisk) const;
 
+    virtual MmapV1RecordHeader* readRecordForV1(OperationContext* txn, const DiskLoc& loc) const;
+
+    virtual void touchForRead(OperationContext* txn, const DiskLoc& loc, int length) const {}
+
+    virtual void touchManyForRead(OperationContext* txn,
+                                  const std::vector<std::pair<DiskLoc, int>>& ranges) const {}
+
     virtual std::unique_ptr<RecordFetcher> recordNeedsFetch(const DiskLoc& loc) const final;
 
     virtual Extent* extentForV1(const DiskLoc& loc) const;
@@ -30,7 +30,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <boost/optional.hpp>
+#include <numeric>
+#include <vector>
 
 #include "mongo/base/owned_pointer_vector.h"
 #include "mongo/bson/mutable/damage_vector.h"
@@ -365,6 +368,28 @@ public:
         return true;
     }
 
+    /**
+     * Looks up several records at once, which lets the storage engine read them in disk order
+     * rather than in the order they were asked for. Sets (*out)[i] to the contents of the record
+     * at locs[i], or to a null RecordData if there is none. 'fromDisk' means the same as for
+     * findRecord().
+     *
+     * Unowned data is valid as described for findRecord(). The same MMAPv1 caveat applies too.
+     */
+    virtual void findRecords(OperationContext* txn,
+                             const std::vector<RecordId>& locs,
+                             std::vector<RecordData>* out,
+                             int fromDisk) const {
+        out->clear();
+        out->resize(locs.size());
+        for (size_t i : sortedOrder(locs)) {
+            RecordData data;
+            if (findRecord(txn, locs[i], &data, fromDisk)) {
+                (*out)[i] = std::move(data);
+            }
+        }
+    }
+
     virtual void deleteRecord(OperationContext* txn, const RecordId& dl) = 0;
 
     virtual StatusWith<RecordId> insertRecord(OperationContext* txn,
@@ -611,6 +636,19 @@ public:
                                         long long dataSize) = 0;
 
 protected:
+    /**
+     * Returns the positions in 'locs' ordered by RecordId, the order findRecords()
+     * implementations visit them in.
+     */
+    static std::vector<size_t> sortedOrder(const std::vector<RecordId>& locs) {
+        std::vector<size_t> order(locs.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&locs](size_t lhs, size_t rhs) {
+            return locs[lhs] < locs[rhs];
+        });
+        return order;
+    }
+
     std::string _ns;
 };
 
@@ -132,4 +132,46 @@ TEST(RecordStoreTestHarness, DataForMultiple) {
     }
 }
 
+// Insert multiple records and verify their contents by calling findRecords() with the
+// returned RecordIds in reverse order.
+TEST(RecordStoreTestHarness, FindRecordsMultiple) {
+    unique_ptr<HarnessHelper> harnessHelper(newHarnessHelper());
+    unique_ptr<RecordStore> rs(harnessHelper->newNonCappedRecordStore());
+
+    const int nToInsert = 10;
+    std::vector<RecordId> locs;
+    for (int i = 0; i < nToInsert; i++) {
+        ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
+        {
+            stringstream ss;
+            ss << "record----" << i;
+            string data = ss.str();
+
+            WriteUnitOfWork uow(opCtx.get());
+            StatusWith<RecordId> res =
+                rs->insertRecord(opCtx.get(), data.c_str(), data.size() + 1, false);
+            ASSERT_OK(res.getStatus());
+            locs.push_back(res.getValue());
+            uow.commit();
+        }
+    }
+    std::reverse(locs.begin(), locs.end());
+
+    {
+        ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
+        std::vector<RecordData> records;
+        rs->findRecords(opCtx.get(), locs, &records, 0);
+        ASSERT_EQUALS(locs.size(), records.size());
+
+        for (int i = 0; i < nToInsert; i++) {
+            stringstream ss;
+            ss << "record----" << (nToInsert - 1 - i);
+            string data = ss.str();
+
+            ASSERT_EQUALS(data.size() + 1, static_cast<size_t>(records[i].size()));
+            ASSERT_EQUALS(data, records[i].data());
+        }
+    }
+}
+
 }  // namespace mongo
@@ -54,6 +54,20 @@ public:
 
     virtual void reportState(BSONObjBuilder* b) const {}
 
+    /**
+     * Adds the storage reads done through this RecoveryUnit since the last call to the
+     * StorageReadStats of 'opCtx'. Storage engines that count reads as they issue them don't need
+     * to implement this.
+     */
+    virtual void reportStorageReads(OperationContext* opCtx) {}
+
+    /**
+     * While set, record cursors opened through this RecoveryUnit are for scans whose data won't
+     * be read again soon, and the storage engine may keep it from displacing the data it caches
+     * for other operations. Storage engines without such a cache policy ignore the hint.
+     */
+    virtual void setReadOnce(bool readOnce) {}
+
     /**
      * These should be called through WriteUnitOfWork rather than directly.
      *
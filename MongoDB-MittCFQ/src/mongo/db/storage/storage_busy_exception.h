@@ -0,0 +1,52 @@
+/**
+ *    Copyright (C) 2016 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <string>
+
+#include "mongo/base/error_codes.h"
+#include "mongo/util/assert_util.h"
+
+namespace mongo {
+
+/**
+ * Thrown by a RecordStore when a deadline-bounded read of a record is rejected by the I/O
+ * scheduler because the device cannot serve it in time. The record itself is intact; the same
+ * read may succeed later, or immediately on another member of the replica set.
+ *
+ * Query stages that fetch documents translate this into a status member with code
+ * ErrorCodes::StorageBusy so that the error reaches the client instead of a partial result.
+ */
+class StorageBusyException : public DBException {
+public:
+    explicit StorageBusyException(const std::string& msg)
+        : DBException(msg, ErrorCodes::StorageBusy) {}
+};
+
+}  // namespace mongo
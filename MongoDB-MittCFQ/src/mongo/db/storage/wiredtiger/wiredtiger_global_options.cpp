@@ -57,6 +57,15 @@ Status WiredTigerGlobalOptions::add(moe::OptionSection* options) {
                            "0 means do not log statistics")
         .validRange(0, 100000)
         .setDefault(moe::Value(0));
+    wiredTigerOptions
+        .addOptionChaining("storage.wiredTiger.engineConfig.checkpointPaceReadLatencyMicros",
+                           "wiredTigerCheckpointPaceReadLatencyMicros",
+                           moe::Int,
+                           "spread checkpoint writes over the checkpoint interval, slowing them "
+                           "while reads take longer than this many microseconds; "
+                           "0 means write as fast as possible")
+        .validRange(0, 10000000)
+        .setDefault(moe::Value(0));
     wiredTigerOptions
         .addOptionChaining("storage.wiredTiger.engineConfig.journalCompressor",
                            "wiredTigerJournalCompressor",
@@ -125,6 +134,10 @@ Status WiredTigerGlobalOptions::store(const moe::Environment& params,
         wiredTigerGlobalOptions.statisticsLogDelaySecs =
             params["storage.wiredTiger.engineConfig.statisticsLogDelaySecs"].as<int>();
     }
+    if (params.count("storage.wiredTiger.engineConfig.checkpointPaceReadLatencyMicros")) {
+        wiredTigerGlobalOptions.checkpointPaceReadLatencyMicros =
+            params["storage.wiredTiger.engineConfig.checkpointPaceReadLatencyMicros"].as<int>();
+    }
     if (params.count("storage.wiredTiger.engineConfig.journalCompressor")) {
         wiredTigerGlobalOptions.journalCompressor =
             params["storage.wiredTiger.engineConfig.journalCompressor"].as<std::string>();
@@ -42,6 +42,7 @@ public:
     WiredTigerGlobalOptions()
         : cacheSizeGB(0),
           checkpointDelaySecs(0),
+          checkpointPaceReadLatencyMicros(0),
           statisticsLogDelaySecs(0),
           directoryForIndexes(false),
           useCollectionPrefixCompression(false),
@@ -52,6 +53,7 @@ public:
 
     double cacheSizeGB;
     size_t checkpointDelaySecs;
+    size_t checkpointPaceReadLatencyMicros;
     size_t statisticsLogDelaySecs;
     std::string journalCompressor;
     bool directoryForIndexes;
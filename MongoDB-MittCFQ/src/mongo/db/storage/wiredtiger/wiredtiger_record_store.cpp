@@ -45,7 +45,9 @@
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/service_context.h"
+#include "mongo/db/storage/deadline_read.h"
 #include "mongo/db/storage/oplog_hack.h"
+#include "mongo/db/storage/storage_busy_exception.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_customization_hooks.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_global_options.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_kv_engine.h"
@@ -91,9 +93,49 @@ bool shouldUseOplogHack(OperationContext* opCtx, const std::string& uri) {
 
 MONGO_FP_DECLARE(WTWriteConflictException);
 MONGO_FP_DECLARE(WTEmulateOutOfOrderNextRecordId);
+MONGO_FP_DECLARE(WTReadBusy);
 
 const std::string kWiredTigerEngineName = "wiredTiger";
 
+namespace {
+
+/**
+ * Positions 'c' on its key like WT_CURSOR::search, but with any page read the search needs
+ * bounded by the time 'txn' has left (see storageReadDeadline()). Operations that can't take a
+ * rejection (see canUseDeadlineReads()) search without a deadline.
+ *
+ * Throws StorageBusyException if the I/O scheduler rejects a read.
+ */
+int searchWithReadDeadline(OperationContext* txn, WT_CURSOR* c) {
+    if (!canUseDeadlineReads(txn)) {
+        return WT_OP_CHECK(c->search(c));
+    }
+
+    WT_SESSION* session = c->session;
+    const Microseconds deadline = storageReadDeadline(txn);
+    invariantWTOK(session->set_read_deadline(session, durationCount<Microseconds>(deadline)));
+    ON_BLOCK_EXIT([session] { invariantWTOK(session->set_read_deadline(session, -1)); });
+
+    uint64_t readsBefore, bytes, timeBefore, busy;
+    invariantWTOK(session->get_read_stats(session, &readsBefore, &bytes, &timeBefore, &busy));
+    int ret = MONGO_FAIL_POINT(WTReadBusy) ? WT_READ_BUSY : WT_OP_CHECK(c->search(c));
+    uint64_t reads, time;
+    invariantWTOK(session->get_read_stats(session, &reads, &bytes, &time, &busy));
+
+    // Searches served from the cache never reached the I/O scheduler and say nothing about its
+    // load. The rest are timed by the block reads themselves.
+    if (reads != readsBefore || ret == WT_READ_BUSY) {
+        noteDeadlineRead(
+            Microseconds(static_cast<long long>(time - timeBefore)), deadline, ret == WT_READ_BUSY);
+    }
+    if (ret == WT_READ_BUSY) {
+        throw StorageBusyException(wtRCToStatus(ret).reason());
+    }
+    return ret;
+}
+
+}  // namespace
+
 class WiredTigerRecordStore::OplogStones::InsertChange final : public RecoveryUnit::Change {
 public:
     InsertChange(OplogStones* oplogStones,
@@ -434,8 +476,9 @@ public:
         : _rs(rs),
           _txn(txn),
           _forward(forward),
+          _readOnce(WiredTigerRecoveryUnit::get(txn)->getReadOnce()),
           _readUntilForOplog(WiredTigerRecoveryUnit::get(txn)->getOplogReadTill()) {
-        _cursor.emplace(rs.getURI(), rs.tableId(), true, txn);
+        _cursor.emplace(rs.getURI(), rs.tableId(), true, txn, _readOnce);
     }
 
     boost::optional<Record> next() final {
@@ -518,8 +561,10 @@ public:
         _skipNextAdvance = false;
         WT_CURSOR* c = _cursor->get();
         c->set_key(c, _makeKey(id));
-        // Nothing after the next line can throw WCEs.
-        int seekRet = WT_OP_CHECK(c->search(c));
+        // Nothing after the next line can throw WCEs. Like the mmapv1 forward cursor, point
+        // lookups in ordinary collections use deadline reads; capped truncation must not fail.
+        int seekRet = (_forward && !_rs._isCapped) ? searchWithReadDeadline(_txn, c)
+                                                   : WT_OP_CHECK(c->search(c));
         if (seekRet == WT_NOTFOUND) {
             _eof = true;
             return {};
@@ -551,7 +596,7 @@ public:
 
     bool restore() final {
         if (!_cursor)
-            _cursor.emplace(_rs.getURI(), _rs.tableId(), true, _txn);
+            _cursor.emplace(_rs.getURI(), _rs.tableId(), true, _txn, _readOnce);
 
         // This will ensure an active session exists, so any restored cursors will bind to it
         invariant(WiredTigerRecoveryUnit::get(_txn)->getSession(_txn) == _cursor->getSession());
@@ -629,6 +674,7 @@ private:
     const WiredTigerRecordStore& _rs;
     OperationContext* _txn;
     const bool _forward;
+    const bool _readOnce;  // Scan without displacing the WiredTiger cache, kept across restore()
     bool _skipNextAdvance = false;
     boost::optional<WiredTigerCursor> _cursor;
     bool _eof = false;
@@ -957,7 +1003,7 @@ RecordData WiredTigerRecordStore::dataFor(OperationContext* txn, const RecordId&
     WT_CURSOR* c = curwrap.get();
     invariant(c);
     c->set_key(c, _makeKey(id));
-    int ret = WT_OP_CHECK(c->search(c));
+    int ret = fromDisk == 1 ? searchWithReadDeadline(txn, c) : WT_OP_CHECK(c->search(c));
     massert(28556, "Didn't find RecordId in WiredTigerRecordStore", ret != WT_NOTFOUND);
     invariantWTOK(ret);
     return _getData(curwrap);
@@ -970,7 +1016,7 @@ bool WiredTigerRecordStore::findRecord(OperationContext* txn,
     WT_CURSOR* c = curwrap.get();
     invariant(c);
     c->set_key(c, _makeKey(id));
-    int ret = WT_OP_CHECK(c->search(c));
+    int ret = fromDisk == 1 ? searchWithReadDeadline(txn, c) : WT_OP_CHECK(c->search(c));
     if (ret == WT_NOTFOUND) {
         return false;
     }
@@ -979,6 +1025,29 @@ bool WiredTigerRecordStore::findRecord(OperationContext* txn,
     return true;
 }
 
+void WiredTigerRecordStore::findRecords(OperationContext* txn,
+                                        const std::vector<RecordId>& ids,
+                                        std::vector<RecordData>* out,
+                                        int fromDisk) const {
+    out->clear();
+    out->resize(ids.size());
+
+    // Probing one cursor in key order walks the btree front to back once, so neighbouring ids
+    // share the internal pages and leaf reads of the search before them.
+    WiredTigerCursor curwrap(_uri, _tableId, true, txn);
+    WT_CURSOR* c = curwrap.get();
+    invariant(c);
+    for (size_t i : sortedOrder(ids)) {
+        c->set_key(c, _makeKey(ids[i]));
+        int ret = fromDisk == 1 ? searchWithReadDeadline(txn, c) : WT_OP_CHECK(c->search(c));
+        if (ret == WT_NOTFOUND) {
+            continue;
+        }
+        invariantWTOK(ret);
+        (*out)[i] = _getData(curwrap);
+    }
+}
+
 void WiredTigerRecordStore::deleteRecord(OperationContext* txn, const RecordId& id) {
     // Deletes should never occur on a capped collection because truncation uses
     // WT_SESSION::truncate().
@@ -115,6 +115,11 @@ public:
 
     virtual bool findRecord(OperationContext* txn, const RecordId& id, RecordData* out, int fromDisk) const;
 
+    virtual void findRecords(OperationContext* txn,
+                             const std::vector<RecordId>& ids,
+                             std::vector<RecordData>* out,
+                             int fromDisk) const;
+
     virtual void deleteRecord(OperationContext* txn, const RecordId& id);
 
     virtual Status insertRecords(OperationContext* txn,
@@ -36,10 +36,13 @@
 #include "mongo/base/checked_cast.h"
 #include "mongo/base/string_data.h"
 #include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/concurrency/d_concurrency.h"
+#include "mongo/db/concurrency/lock_state.h"
 #include "mongo/db/concurrency/write_conflict_exception.h"
 #include "mongo/db/json.h"
 #include "mongo/db/operation_context_noop.h"
 #include "mongo/db/storage/record_store_test_harness.h"
+#include "mongo/db/storage/storage_busy_exception.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_record_store.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_record_store_oplog_stones.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_recovery_unit.h"
@@ -48,6 +51,8 @@
 #include "mongo/db/storage/wiredtiger/wiredtiger_util.h"
 #include "mongo/unittest/temp_dir.h"
 #include "mongo/unittest/unittest.h"
+#include "mongo/util/fail_point_service.h"
+#include "mongo/util/scopeguard.h"
 
 namespace mongo {
 
@@ -667,6 +672,52 @@ TEST(WiredTigerRecordStoreTest, OplogHackOnNonOplog) {
     ASSERT_EQ(rs->oplogStartHack(opCtx.get(), RecordId(0, 1)), boost::none);
 }
 
+TEST(WiredTigerRecordStoreTest, WritePathsNeverGetStorageBusy) {
+    WiredTigerHarnessHelper harnessHelper;
+    unique_ptr<RecordStore> rs(harnessHelper.newNonCappedRecordStore());
+
+    RecordId id;
+    {
+        ServiceContext::UniqueOperationContext opCtx(harnessHelper.newOperationContext());
+        WriteUnitOfWork wuow(opCtx.get());
+        StatusWith<RecordId> res = rs->insertRecord(opCtx.get(), "a", 2, false);
+        ASSERT_OK(res.getStatus());
+        id = res.getValue();
+        wuow.commit();
+    }
+
+    // Every deadline read is rejected while the fail point is on.
+    FailPoint* readBusy = getGlobalFailPointRegistry()->getFailPoint("WTReadBusy");
+    readBusy->setMode(FailPoint::alwaysOn);
+    ON_BLOCK_EXIT([readBusy] { readBusy->setMode(FailPoint::off); });
+
+    {
+        ServiceContext::UniqueOperationContext opCtx(harnessHelper.newOperationContext());
+        RecordData data;
+        ASSERT_THROWS(rs->findRecord(opCtx.get(), id, &data, 1), StorageBusyException);
+        ASSERT_THROWS(rs->getCursor(opCtx.get())->seekExact(id), StorageBusyException);
+    }
+
+    {
+        // An operation holding a write lock reads without a deadline, so it is never rejected.
+        ServiceContext::UniqueOperationContext opCtx(harnessHelper.newOperationContext());
+        opCtx->releaseLockState();
+        opCtx->setLockState(stdx::make_unique<DefaultLockerImpl>());
+        Lock::GlobalWrite globalWrite(opCtx->lockState());
+
+        RecordData data;
+        ASSERT_TRUE(rs->findRecord(opCtx.get(), id, &data, 1));
+        ASSERT_EQUALS(std::string("a"), data.data());
+        ASSERT_EQUALS(std::string("a"), rs->dataFor(opCtx.get(), id, 1).data());
+        ASSERT_TRUE(rs->getCursor(opCtx.get())->seekExact(id));
+
+        std::vector<RecordData> out;
+        rs->findRecords(opCtx.get(), {id}, &out, 1);
+        ASSERT_EQUALS(1U, out.size());
+        ASSERT_EQUALS(std::string("a"), out[0].data());
+    }
+}
+
 TEST(WiredTigerRecordStoreTest, CappedOrder) {
     unique_ptr<WiredTigerHarnessHelper> harnessHelper(new WiredTigerHarnessHelper());
     unique_ptr<RecordStore> rs(harnessHelper->newCappedRecordStore("a.b", 100000, 10000));
@@ -773,6 +824,46 @@ TEST(WiredTigerRecordStoreTest, CappedCursorRollover) {
     ASSERT(!cursor->next());
 }
 
+TEST(WiredTigerRecordStoreTest, ReadOnceCursor) {
+    unique_ptr<WiredTigerHarnessHelper> harnessHelper(new WiredTigerHarnessHelper());
+    unique_ptr<RecordStore> rs(harnessHelper->newNonCappedRecordStore());
+
+    const int nToInsert = 10;
+    {
+        ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
+        for (int i = 0; i < nToInsert; ++i) {
+            WriteUnitOfWork uow(opCtx.get());
+            StatusWith<RecordId> res = rs->insertRecord(opCtx.get(), "a", 2, false);
+            ASSERT_OK(res.getStatus());
+            uow.commit();
+        }
+    }
+
+    // A cursor opened while the hint is set keeps it across a yield, after the hint is cleared.
+    ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
+    opCtx->recoveryUnit()->setReadOnce(true);
+    auto cursor = rs->getCursor(opCtx.get());
+    opCtx->recoveryUnit()->setReadOnce(false);
+
+    int nFound = 0;
+    while (cursor->next()) {
+        ++nFound;
+        cursor->save();
+        opCtx->recoveryUnit()->abandonSnapshot();
+        ASSERT(cursor->restore());
+    }
+    ASSERT_EQ(nToInsert, nFound);
+    cursor.reset();
+
+    // Read-once cursors are cached apart from the cursors the session hands out otherwise.
+    auto plainCursor = rs->getCursor(opCtx.get());
+    nFound = 0;
+    while (plainCursor->next()) {
+        ++nFound;
+    }
+    ASSERT_EQ(nToInsert, nFound);
+}
+
 RecordId _oplogOrderInsertOplog(OperationContext* txn, unique_ptr<RecordStore>& rs, int inc) {
     Timestamp opTime = Timestamp(5, inc);
     WiredTigerRecordStore* wrs = checked_cast<WiredTigerRecordStore*>(rs.get());
@@ -74,6 +74,30 @@ void WiredTigerRecoveryUnit::reportState(BSONObjBuilder* b) const {
         b->append("wt_millisSinceCommit", _timer.millis());
 }
 
+void WiredTigerRecoveryUnit::reportStorageReads(OperationContext* opCtx) {
+    if (!_session || !opCtx) {
+        return;
+    }
+    StorageReadStats current = _sessionReadStats();
+    StorageReadStats delta = current;
+    delta -= _readsReported;
+    StorageReadStats::add(opCtx, delta);
+    _readsReported = current;
+}
+
+StorageReadStats WiredTigerRecoveryUnit::_sessionReadStats() const {
+    WT_SESSION* s = _session->getSession();
+    uint64_t reads, bytes, timeMicros, busy;
+    invariantWTOK(s->get_read_stats(s, &reads, &bytes, &timeMicros, &busy));
+
+    StorageReadStats stats;
+    stats.reads = reads;
+    stats.bytesRead = bytes;
+    stats.timeReading = Microseconds(static_cast<long long>(timeMicros));
+    stats.busyRejections = busy;
+    return stats;
+}
+
 void WiredTigerRecoveryUnit::prepareForCreateSnapshot(OperationContext* opCtx) {
     invariant(!_active);  // Can't already be in a WT transaction.
     invariant(!_inUnitOfWork);
@@ -144,6 +168,7 @@ void WiredTigerRecoveryUnit::abortUnitOfWork() {
 void WiredTigerRecoveryUnit::_ensureSession() {
     if (!_session) {
         _session = _sessionCache->getSession();
+        _readsReported = _sessionReadStats();
     }
 }
 
@@ -239,6 +264,10 @@ void WiredTigerRecoveryUnit::_txnOpen(OperationContext* opCtx) {
     invariant(!_active);
     _ensureSession();
 
+    // Operations reopen their transaction at every yield, which keeps the reads that currentOp
+    // shows for long running operations reasonably fresh.
+    reportStorageReads(opCtx);
+
     WT_SESSION* s = _session->getSession();
 
     if (_readFromMajorityCommittedSnapshot) {
@@ -258,18 +287,20 @@ void WiredTigerRecoveryUnit::_txnOpen(OperationContext* opCtx) {
 WiredTigerCursor::WiredTigerCursor(const std::string& uri,
                                    uint64_t tableId,
                                    bool forRecordStore,
-                                   OperationContext* txn) {
+                                   OperationContext* txn,
+                                   bool readOnce) {
     _tableID = tableId;
+    _readOnce = readOnce;
     _ru = WiredTigerRecoveryUnit::get(txn);
     _session = _ru->getSession(txn);
-    _cursor = _session->getCursor(uri, tableId, forRecordStore);
+    _cursor = _session->getCursor(uri, tableId, forRecordStore, readOnce);
     if (!_cursor) {
         error() << "no cursor for uri: " << uri;
     }
 }
 
 WiredTigerCursor::~WiredTigerCursor() {
-    _session->releaseCursor(_tableID, _cursor);
+    _session->releaseCursor(_tableID, _cursor, _readOnce);
     _cursor = NULL;
 }
 
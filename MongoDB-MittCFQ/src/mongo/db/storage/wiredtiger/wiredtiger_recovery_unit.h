@@ -38,6 +38,7 @@
 #include "mongo/base/owned_pointer_vector.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/record_id.h"
+#include "mongo/db/storage/deadline_read.h"
 #include "mongo/db/storage/recovery_unit.h"
 #include "mongo/db/storage/snapshot_name.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_session_cache.h"
@@ -56,6 +57,12 @@ public:
 
     virtual void reportState(BSONObjBuilder* b) const;
 
+    void reportStorageReads(OperationContext* opCtx) final;
+
+    void setReadOnce(bool readOnce) final {
+        _readOnce = readOnce;
+    }
+
     void beginUnitOfWork(OperationContext* opCtx) final;
     void commitUnitOfWork() final;
     void abortUnitOfWork() final;
@@ -107,6 +114,10 @@ public:
         return _oplogReadTill;
     }
 
+    bool getReadOnce() const {
+        return _readOnce;
+    }
+
     static WiredTigerRecoveryUnit* get(OperationContext* txn) {
         return checked_cast<WiredTigerRecoveryUnit*>(txn->recoveryUnit());
     }
@@ -126,6 +137,7 @@ private:
     void _commit();
 
     void _ensureSession();
+    StorageReadStats _sessionReadStats() const;
     void _txnClose(bool commit);
     void _txnOpen(OperationContext* opCtx);
 
@@ -138,9 +150,13 @@ private:
     bool _everStartedWrite;
     Timer _timer;
     RecordId _oplogReadTill;
+    bool _readOnce = false;
     bool _readFromMajorityCommittedSnapshot = false;
     SnapshotName _majorityCommittedSnapshot = SnapshotName::min();
 
+    // The session's read counters as of the last reportStorageReads().
+    StorageReadStats _readsReported;
+
     typedef OwnedPointerVector<Change> Changes;
     Changes _changes;
 };
@@ -153,7 +169,8 @@ public:
     WiredTigerCursor(const std::string& uri,
                      uint64_t tableID,
                      bool forRecordStore,
-                     OperationContext* txn);
+                     OperationContext* txn,
+                     bool readOnce = false);
 
     ~WiredTigerCursor();
 
@@ -180,6 +197,7 @@ public:
 
 private:
     uint64_t _tableID;
+    bool _readOnce;
     WiredTigerRecoveryUnit* _ru;  // not owned
     WiredTigerSession* _session;
     WT_CURSOR* _cursor;  // owned, but pulled
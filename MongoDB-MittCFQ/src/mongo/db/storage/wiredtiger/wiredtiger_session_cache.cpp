@@ -35,6 +35,13 @@
 
 #include "mongo/db/storage/wiredtiger/wiredtiger_session_cache.h"
 
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+#include <functional>
+#include <utility>
+
 #include "mongo/base/error_codes.h"
 #include "mongo/db/storage/journal_listener.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_kv_engine.h"
@@ -46,12 +53,140 @@
 
 namespace mongo {
 
+size_t WiredTigerCursorCache::_home(uint64_t id, bool readOnce) const {
+    // Multiplicative hashing spreads the sequentially assigned source IDs over the table.
+    const uint64_t key = (id << 1) | (readOnce ? 1 : 0);
+    return static_cast<size_t>((key * 0x9E3779B97F4A7C15ULL) >> 32) & (_slots.size() - 1);
+}
+
+size_t WiredTigerCursorCache::_find(uint64_t id, bool readOnce) const {
+    const size_t mask = _slots.size() - 1;
+    size_t slot = _home(id, readOnce);
+    while (!_slots[slot].cursors.empty() &&
+           (_slots[slot].id != id || _slots[slot].readOnce != readOnce))
+        slot = (slot + 1) & mask;
+    return slot;
+}
+
+WT_CURSOR* WiredTigerCursorCache::take(uint64_t id, bool readOnce) {
+    if (_size == 0)
+        return NULL;
+
+    const size_t slot = _find(id, readOnce);
+    auto& cursors = _slots[slot].cursors;
+    if (cursors.empty())
+        return NULL;
+
+    WT_CURSOR* cursor = cursors.back()._cursor;
+    cursors.pop_back();
+    _size--;
+    if (cursors.empty())
+        _erase(slot);
+    return cursor;
+}
+
+void WiredTigerCursorCache::put(uint64_t id, bool readOnce, uint64_t gen, WT_CURSOR* cursor) {
+    // Keep at least half of the slots empty, so probe sequences stay short.
+    if ((_used + 1) * 2 > _slots.size())
+        _grow();
+
+    Slot& slot = _slots[_find(id, readOnce)];
+    if (slot.cursors.empty()) {
+        slot.id = id;
+        slot.readOnce = readOnce;
+        _used++;
+    }
+    slot.cursors.emplace_back(id, gen, cursor, readOnce);
+    _size++;
+}
+
+void WiredTigerCursorCache::takeOlderThan(uint64_t gen, std::vector<WT_CURSOR*>* cursors) {
+    // Each slot's cursors are in generation order, so the old ones come first. Emptying a slot
+    // moves others between slots, so only note the slots that would be emptied at first.
+    std::vector<std::pair<uint64_t, bool>> emptied;
+    for (auto& slot : _slots) {
+        auto firstNew = slot.cursors.begin();
+        while (firstNew != slot.cursors.end() && firstNew->_gen < gen)
+            ++firstNew;
+        if (firstNew == slot.cursors.begin())
+            continue;
+        if (firstNew == slot.cursors.end()) {
+            emptied.emplace_back(slot.id, slot.readOnce);
+            continue;
+        }
+        for (auto it = slot.cursors.begin(); it != firstNew; ++it)
+            cursors->push_back(it->_cursor);
+        _size -= firstNew - slot.cursors.begin();
+        slot.cursors.erase(slot.cursors.begin(), firstNew);
+    }
+    for (const auto& key : emptied) {
+        const size_t slot = _find(key.first, key.second);
+        for (const auto& entry : _slots[slot].cursors)
+            cursors->push_back(entry._cursor);
+        _size -= _slots[slot].cursors.size();
+        _erase(slot);
+    }
+}
+
+void WiredTigerCursorCache::takeAll(std::vector<WT_CURSOR*>* cursors) {
+    for (const auto& slot : _slots) {
+        for (const auto& entry : slot.cursors)
+            cursors->push_back(entry._cursor);
+    }
+    _slots.clear();
+    _used = 0;
+    _size = 0;
+}
+
+void WiredTigerCursorCache::_erase(size_t slot) {
+    // Move later entries of the probe sequence back into the hole, so that lookups, which stop
+    // at the first empty slot, still find them.
+    const size_t mask = _slots.size() - 1;
+    size_t next = slot;
+    for (;;) {
+        _slots[slot].cursors.clear();
+        for (;;) {
+            next = (next + 1) & mask;
+            if (_slots[next].cursors.empty()) {
+                _used--;
+                return;
+            }
+
+            // An entry can't move before its home slot.
+            const size_t home = _home(_slots[next].id, _slots[next].readOnce);
+            const bool stays =
+                slot <= next ? (slot < home && home <= next) : (slot < home || home <= next);
+            if (!stays)
+                break;
+        }
+        _slots[slot].id = _slots[next].id;
+        _slots[slot].readOnce = _slots[next].readOnce;
+        _slots[slot].cursors.swap(_slots[next].cursors);
+        slot = next;
+    }
+}
+
+void WiredTigerCursorCache::_grow() {
+    std::vector<Slot> old;
+    old.swap(_slots);
+    _slots.resize(old.empty() ? kMinSlots : old.size() * 2);
+    for (auto& entry : old) {
+        if (!entry.cursors.empty()) {
+            Slot& slot = _slots[_find(entry.id, entry.readOnce)];
+            slot.id = entry.id;
+            slot.readOnce = entry.readOnce;
+            slot.cursors.swap(entry.cursors);
+        }
+    }
+}
+
+// -----------------------
+
 WiredTigerSession::WiredTigerSession(WT_CONNECTION* conn, uint64_t epoch, uint64_t cursorEpoch)
     : _epoch(epoch),
       _cursorEpoch(cursorEpoch),
       _session(NULL),
       _cursorGen(0),
-      _cursorsCached(0),
       _cursorsOut(0) {
     invariantWTOK(conn->open_session(conn, NULL, "isolation=snapshot", &_session));
 }
@@ -65,7 +200,6 @@ WiredTigerSession::WiredTigerSession(WT_CONNECTION* conn,
       _cache(cache),
       _session(NULL),
       _cursorGen(0),
-      _cursorsCached(0),
       _cursorsOut(0) {
     invariantWTOK(conn->open_session(conn, NULL, "isolation=snapshot", &_session));
 }
@@ -76,21 +210,24 @@ WiredTigerSession::~WiredTigerSession() {
     }
 }
 
-WT_CURSOR* WiredTigerSession::getCursor(const std::string& uri, uint64_t id, bool forRecordStore) {
+WT_CURSOR* WiredTigerSession::getCursor(const std::string& uri,
+                                        uint64_t id,
+                                        bool forRecordStore,
+                                        bool readOnce) {
     // Find the most recently used cursor
-    for (CursorCache::iterator i = _cursors.begin(); i != _cursors.end(); ++i) {
-        if (i->_id == id) {
-            WT_CURSOR* c = i->_cursor;
-            _cursors.erase(i);
-            _cursorsOut++;
-            _cursorsCached--;
-            return c;
-        }
+    WT_CURSOR* c = _cursors.take(id, readOnce);
+    if (c) {
+        _cursorsOut++;
+        return c;
     }
 
-    WT_CURSOR* c = NULL;
-    int ret = _session->open_cursor(
-        _session, uri.c_str(), NULL, forRecordStore ? "" : "overwrite=false", &c);
+    const char* config;
+    if (readOnce)
+        config = forRecordStore ? "read_once=true" : "overwrite=false,read_once=true";
+    else
+        config = forRecordStore ? "" : "overwrite=false";
+
+    int ret = _session->open_cursor(_session, uri.c_str(), NULL, config, &c);
     if (ret != ENOENT)
         invariantWTOK(ret);
     if (c)
@@ -98,39 +235,37 @@ WT_CURSOR* WiredTigerSession::getCursor(const std::string& uri, uint64_t id, boo
     return c;
 }
 
-void WiredTigerSession::releaseCursor(uint64_t id, WT_CURSOR* cursor) {
+void WiredTigerSession::releaseCursor(uint64_t id, WT_CURSOR* cursor, bool readOnce) {
     invariant(_session);
     invariant(cursor);
     _cursorsOut--;
 
     invariantWTOK(cursor->reset(cursor));
 
-    // Cursors are pushed to the front of the list and removed from the back
-    _cursors.push_front(WiredTigerCachedCursor(id, _cursorGen++, cursor));
-    _cursorsCached++;
+    _cursors.put(id, readOnce, _cursorGen++, cursor);
 
     // "Old" is defined as not used in the last N**2 operations, if we have N cursors cached.
     // The reasoning here is to imagine a workload with N tables performing operations randomly
     // across all of them (i.e., each cursor has 1/N chance of used for each operation).  We
     // would like to cache N cursors in that case, so any given cursor could go N**2 operations
-    // in between use.
-    while (_cursorGen - _cursors.back()._gen > 10000) {
-        cursor = _cursors.back()._cursor;
-        _cursors.pop_back();
-        _cursorsCached--;
-        invariantWTOK(cursor->close(cursor));
+    // in between use. Finding old cursors means checking every cached cursor, so that's only
+    // done every so many releases.
+    if (_cursorGen % kCursorSweepInterval == 0 && _cursorGen > kCursorMaxAge) {
+        std::vector<WT_CURSOR*> old;
+        _cursors.takeOlderThan(_cursorGen - kCursorMaxAge, &old);
+        for (WT_CURSOR* oldCursor : old) {
+            invariantWTOK(oldCursor->close(oldCursor));
+        }
     }
 }
 
 void WiredTigerSession::closeAllCursors() {
     invariant(_session);
-    for (CursorCache::iterator i = _cursors.begin(); i != _cursors.end(); ++i) {
-        WT_CURSOR* cursor = i->_cursor;
-        if (cursor) {
-            invariantWTOK(cursor->close(cursor));
-        }
+    std::vector<WT_CURSOR*> cursors;
+    _cursors.takeAll(&cursors);
+    for (WT_CURSOR* cursor : cursors) {
+        invariantWTOK(cursor->close(cursor));
     }
-    _cursors.clear();
     _cursorEpoch = _cache->getCursorEpoch();
 }
 
@@ -145,10 +280,14 @@ uint64_t WiredTigerSession::genTableId() {
 // -----------------------
 
 WiredTigerSessionCache::WiredTigerSessionCache(WiredTigerKVEngine* engine)
-    : _engine(engine), _conn(engine->getConnection()), _snapshotManager(_conn), _shuttingDown(0) {}
+    : _engine(engine),
+      _conn(engine->getConnection()),
+      _snapshotManager(_conn),
+      _shuttingDown(0),
+      _sessionsOverflow(0) {}
 
 WiredTigerSessionCache::WiredTigerSessionCache(WT_CONNECTION* conn)
-    : _engine(NULL), _conn(conn), _snapshotManager(_conn), _shuttingDown(0) {}
+    : _engine(NULL), _conn(conn), _snapshotManager(_conn), _shuttingDown(0), _sessionsOverflow(0) {}
 
 WiredTigerSessionCache::~WiredTigerSessionCache() {
     shuttingDown();
@@ -233,25 +372,97 @@ void WiredTigerSessionCache::closeAllCursors() {
     // Increment the cursor epoch so that all cursors from this epoch are closed.
     _cursorEpoch.fetchAndAdd(1);
 
-    stdx::lock_guard<stdx::mutex> lock(_cacheLock);
-    for (SessionCache::iterator i = _sessions.begin(); i != _sessions.end(); i++) {
+    // Take the cached sessions out of the cache to close their cursors: sessions in use close
+    // theirs when they're released.
+    SessionCache sessions;
+    _takeAllCachedSessions(&sessions);
+    for (SessionCache::iterator i = sessions.begin(); i != sessions.end(); i++) {
         (*i)->closeAllCursors();
+        _cacheSession(*i);
     }
 }
 
 void WiredTigerSessionCache::closeAll() {
     // Increment the epoch as we are now closing all sessions with this epoch.
-    SessionCache swap;
+    _epoch.fetchAndAdd(1);
 
-    {
+    SessionCache sessions;
+    _takeAllCachedSessions(&sessions);
+    for (SessionCache::iterator i = sessions.begin(); i != sessions.end(); i++) {
+        delete (*i);
+    }
+}
+
+// static
+size_t WiredTigerSessionCache::_partitionForThisThread() {
+#if defined(__linux__)
+    const int cpu = sched_getcpu();
+    if (cpu >= 0)
+        return static_cast<size_t>(cpu) % kNumPartitions;
+#endif
+    return std::hash<stdx::thread::id>()(stdx::this_thread::get_id()) % kNumPartitions;
+}
+
+// static
+WiredTigerSession* WiredTigerSessionCache::_takeFromPartition(SessionPartition* partition) {
+    for (size_t i = 0; i < kSlotsPerPartition; i++) {
+        if (partition->slots[i].loadRelaxed() == NULL)
+            continue;
+        if (WiredTigerSession* session = partition->slots[i].swap(NULL))
+            return session;
+    }
+    return NULL;
+}
+
+WiredTigerSession* WiredTigerSessionCache::_takeCachedSession() {
+    const size_t partition = _partitionForThisThread();
+    if (WiredTigerSession* session = _takeFromPartition(&_partitions[partition]))
+        return session;
+
+    if (_sessionsOverflow.load() != 0) {
         stdx::lock_guard<stdx::mutex> lock(_cacheLock);
-        _epoch.fetchAndAdd(1);
-        _sessions.swap(swap);
+        if (!_sessions.empty()) {
+            // Get the most recently used session so that if we discard sessions, we're
+            // discarding older ones
+            WiredTigerSession* session = _sessions.back();
+            _sessions.pop_back();
+            _sessionsOverflow.store(_sessions.size());
+            return session;
+        }
     }
 
-    for (SessionCache::iterator i = swap.begin(); i != swap.end(); i++) {
-        delete (*i);
+    // Take a session released on another CPU rather than open a new one.
+    for (size_t i = 1; i < kNumPartitions; i++) {
+        if (WiredTigerSession* session =
+                _takeFromPartition(&_partitions[(partition + i) % kNumPartitions]))
+            return session;
+    }
+    return NULL;
+}
+
+void WiredTigerSessionCache::_cacheSession(WiredTigerSession* session) {
+    SessionPartition* partition = &_partitions[_partitionForThisThread()];
+    for (size_t i = 0; i < kSlotsPerPartition; i++) {
+        if (partition->slots[i].loadRelaxed() == NULL &&
+            partition->slots[i].compareAndSwap(NULL, session) == NULL)
+            return;
     }
+
+    stdx::lock_guard<stdx::mutex> lock(_cacheLock);
+    _sessions.push_back(session);
+    _sessionsOverflow.store(_sessions.size());
+}
+
+void WiredTigerSessionCache::_takeAllCachedSessions(SessionCache* sessions) {
+    for (size_t i = 0; i < kNumPartitions; i++) {
+        while (WiredTigerSession* session = _takeFromPartition(&_partitions[i]))
+            sessions->push_back(session);
+    }
+
+    stdx::lock_guard<stdx::mutex> lock(_cacheLock);
+    sessions->insert(sessions->end(), _sessions.begin(), _sessions.end());
+    _sessions.clear();
+    _sessionsOverflow.store(0);
 }
 
 bool WiredTigerSessionCache::isEphemeral() {
@@ -263,18 +474,20 @@ UniqueWiredTigerSession WiredTigerSessionCache::getSession() {
     // operations should be allowed to start.
     invariant(!(_shuttingDown.loadRelaxed() & kShuttingDownMask));
 
-    {
-        stdx::lock_guard<stdx::mutex> lock(_cacheLock);
-        if (!_sessions.empty()) {
-            // Get the most recently used session so that if we discard sessions, we're
-            // discarding older ones
-            WiredTigerSession* cachedSession = _sessions.back();
-            _sessions.pop_back();
-            return UniqueWiredTigerSession(cachedSession);
+    while (WiredTigerSession* cachedSession = _takeCachedSession()) {
+        // A session released while closeAll was running may have been cached after it, free it.
+        if (cachedSession->_getEpoch() != _epoch.load()) {
+            delete cachedSession;
+            continue;
         }
+
+        // Likewise a session cached while closeAllCursors was running may still have cursors.
+        if (cachedSession->_getCursorEpoch() != _cursorEpoch.load())
+            cachedSession->closeAllCursors();
+        return UniqueWiredTigerSession(cachedSession);
     }
 
-    // Outside of the cache partition lock, but on release will be put back on the cache
+    // Not taken from the cache, but on release will be put back on the cache
     return UniqueWiredTigerSession(
         new WiredTigerSession(_conn, this, _epoch.load(), _cursorEpoch.load()));
 }
@@ -314,20 +527,15 @@ void WiredTigerSessionCache::releaseSession(WiredTigerSession* session) {
     if (session->_getCursorEpoch() != cursorEpoch)
         session->closeAllCursors();
 
-    bool returnedToCache = false;
+    // If closeAll runs after this check, the session may be cached after closeAll took the
+    // cached sessions. getSession frees such sessions.
     uint64_t currentEpoch = _epoch.load();
-
-    if (session->_getEpoch() == currentEpoch) {  // check outside of lock to reduce contention
-        stdx::lock_guard<stdx::mutex> lock(_cacheLock);
-        if (session->_getEpoch() == _epoch.load()) {  // recheck inside the lock for correctness
-            returnedToCache = true;
-            _sessions.push_back(session);
-        }
-    } else
+    if (session->_getEpoch() == currentEpoch) {
+        _cacheSession(session);
+    } else {
         invariant(session->_getEpoch() < currentEpoch);
-
-    if (!returnedToCache)
         delete session;
+    }
 
     if (_engine && _engine->haveDropsQueued())
         _engine->dropSomeQueuedIdents();
@@ -31,8 +31,8 @@
 
 #pragma once
 
-#include <list>
 #include <string>
+#include <vector>
 
 #include <boost/thread/shared_mutex.hpp>
 #include <wiredtiger.h>
@@ -50,17 +50,77 @@ class WiredTigerSessionCache;
 
 class WiredTigerCachedCursor {
 public:
-    WiredTigerCachedCursor(uint64_t id, uint64_t gen, WT_CURSOR* cursor)
-        : _id(id), _gen(gen), _cursor(cursor) {}
+    WiredTigerCachedCursor(uint64_t id, uint64_t gen, WT_CURSOR* cursor, bool readOnce)
+        : _id(id), _gen(gen), _cursor(cursor), _readOnce(readOnce) {}
 
     uint64_t _id;   // Source ID, assigned to each URI
     uint64_t _gen;  // Generation, used to age out old cursors
     WT_CURSOR* _cursor;
+    bool _readOnce;  // Opened with read_once=true, only reused for scans
 };
 
 /**
- * This is a structure that caches 1 cursor for each uri.
- * The idea is that there is a pool of these somewhere.
+ * The cursors cached by a WiredTigerSession, in an open-addressing hash table with linear probing
+ * keyed by source ID and readOnce. Each key holds any number of cursors, since an operation can
+ * have several cursors open on the same table, and take() hands out the most recently released
+ * one first. Cursors are only removed from the cache, closing them is up to the caller.
+ * NOT THREADSAFE
+ */
+class WiredTigerCursorCache {
+public:
+    /**
+     * Removes and returns the cursor most recently cached for 'id' and 'readOnce', or returns
+     * NULL.
+     */
+    WT_CURSOR* take(uint64_t id, bool readOnce);
+
+    /**
+     * Caches 'cursor' for 'id' and 'readOnce' at generation 'gen', which must be higher than the
+     * generation of every cursor already cached.
+     */
+    void put(uint64_t id, bool readOnce, uint64_t gen, WT_CURSOR* cursor);
+
+    /**
+     * Removes the cursors cached at a generation before 'gen', or all of them, and appends them
+     * to 'cursors'.
+     */
+    void takeOlderThan(uint64_t gen, std::vector<WT_CURSOR*>* cursors);
+    void takeAll(std::vector<WT_CURSOR*>* cursors);
+
+    /**
+     * Returns the number of cursors cached.
+     */
+    size_t size() const {
+        return _size;
+    }
+
+private:
+    static const size_t kMinSlots = 16;
+
+    struct Slot {
+        uint64_t id = 0;
+        bool readOnce = false;
+        std::vector<WiredTigerCachedCursor> cursors;  // Oldest first, empty in an empty slot
+    };
+
+    size_t _home(uint64_t id, bool readOnce) const;
+
+    // Returns the slot holding 'id' and 'readOnce', or the empty slot ending their probe sequence.
+    size_t _find(uint64_t id, bool readOnce) const;
+
+    // Empties the slot and takes it out of the probe sequences it is on.
+    void _erase(size_t slot);
+
+    void _grow();
+
+    std::vector<Slot> _slots;
+    size_t _used = 0;  // Slots holding cursors
+    size_t _size = 0;  // Cursors held
+};
+
+/**
+ * This is a structure that caches released cursors, several for each uri if an operation had
+ * several open on it. The idea is that there is a pool of these somewhere.
  * NOT THREADSAFE
  */
 class WiredTigerSession {
@@ -93,9 +153,16 @@ public:
         return _session;
     }
 
-    WT_CURSOR* getCursor(const std::string& uri, uint64_t id, bool forRecordStore);
+    /**
+     * Returns a cursor on 'uri', reusing a cached one if there is one. A 'readOnce' cursor is
+     * meant for a scan: pages it reads don't displace the rest of the WiredTiger cache.
+     */
+    WT_CURSOR* getCursor(const std::string& uri,
+                         uint64_t id,
+                         bool forRecordStore,
+                         bool readOnce = false);
 
-    void releaseCursor(uint64_t id, WT_CURSOR* cursor);
+    void releaseCursor(uint64_t id, WT_CURSOR* cursor, bool readOnce = false);
 
     void closeAllCursors();
 
@@ -113,8 +180,11 @@ public:
 private:
     friend class WiredTigerSessionCache;
 
-    // The cursor cache is a list of pairs that contain an ID and cursor
-    typedef std::list<WiredTigerCachedCursor> CursorCache;
+    // Cursors not used in this many releases are closed, see releaseCursor.
+    static const uint64_t kCursorMaxAge = 10000;
+
+    // Releases between checks for cursors to age out.
+    static const uint64_t kCursorSweepInterval = 1024;
 
     // Used internally by WiredTigerSessionCache
     uint64_t _getEpoch() const {
@@ -130,9 +200,9 @@ private:
     uint64_t _cursorEpoch;
     WiredTigerSessionCache* _cache;  // not owned
     WT_SESSION* _session;            // owned
-    CursorCache _cursors;            // owned
+    WiredTigerCursorCache _cursors;  // owned
     uint64_t _cursorGen;
-    int _cursorsCached, _cursorsOut;
+    int _cursorsOut;
 };
 
 /**
@@ -215,9 +285,21 @@ private:
     AtomicUInt32 _shuttingDown;
     static const uint32_t kShuttingDownMask = 1 << 31;
 
+    // Idle sessions are cached in per-CPU partitions of slots, so threads on different CPUs don't
+    // contend for them. A session is taken from a slot by swapping in NULL and put in one by
+    // swapping out NULL, so the slots need no lock. A partition's slots fill one cache line.
+    static const size_t kNumPartitions = 64;
+    static const size_t kSlotsPerPartition = 8;
+    struct SessionPartition {
+        AtomicWord<WiredTigerSession*> slots[kSlotsPerPartition];
+    };
+    SessionPartition _partitions[kNumPartitions];
+
+    // Sessions released when their CPU's partition is full, protected by _cacheLock.
     stdx::mutex _cacheLock;
     typedef std::vector<WiredTigerSession*> SessionCache;
     SessionCache _sessions;
+    AtomicUInt32 _sessionsOverflow;  // Size of _sessions, checked outside of the lock
 
     // Bumped when all open sessions need to be closed
     AtomicUInt64 _epoch;  // atomic so we can check it outside of the lock
@@ -239,6 +321,32 @@ private:
      * session and releasing it, the session is directly released. This method is thread safe.
      */
     void releaseSession(WiredTigerSession* session);
+
+    /**
+     * Returns the partition for the CPU the calling thread is running on.
+     */
+    static size_t _partitionForThisThread();
+
+    /**
+     * Takes a session from one of a partition's slots, or returns NULL if they're all empty.
+     */
+    static WiredTigerSession* _takeFromPartition(SessionPartition* partition);
+
+    /**
+     * Takes a cached session, preferring the calling thread's partition, then the overflow, then
+     * other partitions. Returns NULL if no session is cached.
+     */
+    WiredTigerSession* _takeCachedSession();
+
+    /**
+     * Caches an idle session in the calling thread's partition, or the overflow if it's full.
+     */
+    void _cacheSession(WiredTigerSession* session);
+
+    /**
+     * Removes all sessions from the partitions and the overflow, appending them to 'sessions'.
+     */
+    void _takeAllCachedSessions(SessionCache* sessions);
 };
 
 /**
@@ -0,0 +1,242 @@
+// wiredtiger_session_cache_test.cpp
+
+/**
+ *    Copyright (C) 2016 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include <vector>
+
+#include "mongo/db/storage/wiredtiger/wiredtiger_session_cache.h"
+#include "mongo/db/storage/wiredtiger/wiredtiger_util.h"
+#include "mongo/stdx/memory.h"
+#include "mongo/stdx/thread.h"
+#include "mongo/unittest/temp_dir.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+const char* const kUri = "table:session_cache";
+
+// The cursor cache never dereferences the cursors it holds.
+WT_CURSOR* fakeCursor(uintptr_t n) {
+    return reinterpret_cast<WT_CURSOR*>(n * 8);
+}
+
+TEST(WiredTigerCursorCacheTest, TakeReturnsCachedCursor) {
+    WiredTigerCursorCache cache;
+    ASSERT(cache.take(1, false) == NULL);
+    cache.put(1, false, 0, fakeCursor(1));
+    cache.put(1, true, 1, fakeCursor(2));
+    ASSERT_EQUALS(2U, cache.size());
+
+    ASSERT(cache.take(1, false) == fakeCursor(1));
+    ASSERT(cache.take(1, false) == NULL);
+    ASSERT(cache.take(1, true) == fakeCursor(2));
+    ASSERT_EQUALS(0U, cache.size());
+}
+
+TEST(WiredTigerCursorCacheTest, CachesSeveralCursorsPerSource) {
+    WiredTigerCursorCache cache;
+    cache.put(7, false, 0, fakeCursor(1));
+    cache.put(7, false, 1, fakeCursor(2));
+    cache.put(7, false, 2, fakeCursor(3));
+    ASSERT_EQUALS(3U, cache.size());
+
+    // The most recently released cursor comes back first.
+    ASSERT(cache.take(7, false) == fakeCursor(3));
+    ASSERT(cache.take(7, false) == fakeCursor(2));
+    cache.put(7, false, 3, fakeCursor(4));
+    ASSERT(cache.take(7, false) == fakeCursor(4));
+    ASSERT(cache.take(7, false) == fakeCursor(1));
+    ASSERT(cache.take(7, false) == NULL);
+    ASSERT_EQUALS(0U, cache.size());
+}
+
+TEST(WiredTigerCursorCacheTest, ManySources) {
+    WiredTigerCursorCache cache;
+    for (uint64_t id = 1; id <= 1000; id++)
+        cache.put(id, false, id, fakeCursor(id));
+    ASSERT_EQUALS(1000U, cache.size());
+
+    // Removing entries mustn't hide the entries probed past them.
+    for (uint64_t id = 1; id <= 1000; id += 2)
+        ASSERT(cache.take(id, false) == fakeCursor(id));
+    for (uint64_t id = 1; id <= 1000; id++)
+        ASSERT(cache.take(id, false) == (id % 2 == 0 ? fakeCursor(id) : NULL));
+    ASSERT_EQUALS(0U, cache.size());
+}
+
+TEST(WiredTigerCursorCacheTest, TakeOlderThan) {
+    WiredTigerCursorCache cache;
+    for (uint64_t id = 1; id <= 100; id++)
+        cache.put(id, false, id, fakeCursor(id));
+
+    std::vector<WT_CURSOR*> cursors;
+    cache.takeOlderThan(51, &cursors);
+    ASSERT_EQUALS(50U, cursors.size());
+    ASSERT_EQUALS(50U, cache.size());
+    for (uint64_t id = 1; id <= 100; id++)
+        ASSERT(cache.take(id, false) == (id > 50 ? fakeCursor(id) : NULL));
+
+    cache.put(1, false, 1, fakeCursor(1));
+    cursors.clear();
+    cache.takeAll(&cursors);
+    ASSERT_EQUALS(1U, cursors.size());
+    ASSERT_EQUALS(0U, cache.size());
+}
+
+TEST(WiredTigerCursorCacheTest, TakeOlderThanSeveralCursorsPerSource) {
+    WiredTigerCursorCache cache;
+    uint64_t gen = 0;
+    for (uint64_t id = 1; id <= 100; id++) {
+        for (int i = 0; i < 3; i++, gen++)
+            cache.put(id, false, gen, fakeCursor(gen + 1));
+    }
+
+    // Sources up to 50 lose all of their cursors, source 51 only its oldest.
+    std::vector<WT_CURSOR*> cursors;
+    cache.takeOlderThan(151, &cursors);
+    ASSERT_EQUALS(151U, cursors.size());
+    ASSERT_EQUALS(149U, cache.size());
+    for (uint64_t id = 1; id <= 50; id++)
+        ASSERT(cache.take(id, false) == NULL);
+    ASSERT(cache.take(51, false) == fakeCursor(153));
+    ASSERT(cache.take(51, false) == fakeCursor(152));
+    ASSERT(cache.take(51, false) == NULL);
+    for (uint64_t id = 52; id <= 100; id++)
+        ASSERT(cache.take(id, false) == fakeCursor(id * 3));
+}
+
+class WiredTigerSessionCacheTest : public unittest::Test {
+public:
+    WiredTigerSessionCacheTest() : _dbpath("wt_test"), _conn(NULL) {}
+
+    virtual void setUp() {
+        ASSERT_OK(wtRCToStatus(
+            wiredtiger_open(_dbpath.path().c_str(), NULL, "create,session_max=200", &_conn)));
+        _sessionCache = stdx::make_unique<WiredTigerSessionCache>(_conn);
+
+        UniqueWiredTigerSession session = _sessionCache->getSession();
+        WT_SESSION* s = session->getSession();
+        ASSERT_OK(wtRCToStatus(s->create(s, kUri, "key_format=q,value_format=q")));
+    }
+
+    virtual void tearDown() {
+        _sessionCache.reset();
+        _conn->close(_conn, NULL);
+    }
+
+protected:
+    unittest::TempDir _dbpath;
+    WT_CONNECTION* _conn;
+    std::unique_ptr<WiredTigerSessionCache> _sessionCache;
+};
+
+TEST_F(WiredTigerSessionCacheTest, ReusesReleasedSession) {
+    WT_SESSION* first;
+    {
+        UniqueWiredTigerSession session = _sessionCache->getSession();
+        first = session->getSession();
+    }
+    UniqueWiredTigerSession session = _sessionCache->getSession();
+    ASSERT_EQUALS(first, session->getSession());
+}
+
+TEST_F(WiredTigerSessionCacheTest, ReusesReleasedCursor) {
+    const uint64_t id = WiredTigerSession::genTableId();
+    UniqueWiredTigerSession session = _sessionCache->getSession();
+
+    WT_CURSOR* cursor = session->getCursor(kUri, id, true);
+    ASSERT(cursor);
+    ASSERT_EQUALS(1, session->cursorsOut());
+    session->releaseCursor(id, cursor);
+    ASSERT_EQUALS(0, session->cursorsOut());
+
+    ASSERT_EQUALS(cursor, session->getCursor(kUri, id, true));
+    session->releaseCursor(id, cursor);
+
+    // A read-once cursor isn't the cached one.
+    WT_CURSOR* readOnceCursor = session->getCursor(kUri, id, true, true);
+    ASSERT_NOT_EQUALS(cursor, readOnceCursor);
+    session->releaseCursor(id, readOnceCursor, true);
+}
+
+TEST_F(WiredTigerSessionCacheTest, CachesSeveralCursorsPerTable) {
+    const uint64_t id = WiredTigerSession::genTableId();
+    UniqueWiredTigerSession session = _sessionCache->getSession();
+
+    WT_CURSOR* first = session->getCursor(kUri, id, true);
+    WT_CURSOR* second = session->getCursor(kUri, id, true);
+    ASSERT_NOT_EQUALS(first, second);
+    session->releaseCursor(id, first);
+    session->releaseCursor(id, second);
+
+    // Both cursors stay open and cached.
+    ASSERT_EQUALS(second, session->getCursor(kUri, id, true));
+    ASSERT_EQUALS(first, session->getCursor(kUri, id, true));
+    session->releaseCursor(id, first);
+    session->releaseCursor(id, second);
+}
+
+TEST_F(WiredTigerSessionCacheTest, CloseAllCursorsClosesCachedCursors) {
+    const uint64_t id = WiredTigerSession::genTableId();
+    {
+        UniqueWiredTigerSession session = _sessionCache->getSession();
+        session->releaseCursor(id, session->getCursor(kUri, id, true));
+    }
+    _sessionCache->closeAllCursors();
+
+    // With every cursor closed, the table can be dropped.
+    UniqueWiredTigerSession session = _sessionCache->getSession();
+    WT_SESSION* s = session->getSession();
+    ASSERT_OK(wtRCToStatus(s->drop(s, kUri, NULL)));
+}
+
+TEST_F(WiredTigerSessionCacheTest, ConcurrentGetAndRelease) {
+    const uint64_t id = WiredTigerSession::genTableId();
+    std::vector<stdx::thread> threads;
+    for (int i = 0; i < 8; i++) {
+        threads.emplace_back([this, id] {
+            for (int j = 0; j < 1000; j++) {
+                UniqueWiredTigerSession session = _sessionCache->getSession();
+                WT_CURSOR* cursor = session->getCursor(kUri, id, true);
+                ASSERT(cursor);
+                session->releaseCursor(id, cursor);
+            }
+        });
+    }
+    for (int i = 0; i < 10; i++)
+        _sessionCache->closeAllCursors();
+    for (auto&& thread : threads)
+        thread.join();
+}
+
+}  // namespace
+}  // namespace mongo
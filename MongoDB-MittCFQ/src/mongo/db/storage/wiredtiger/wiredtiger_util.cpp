@@ -74,6 +74,10 @@ Status wtRCToStatus_slow(int retCode, const char* prefix) {
 
     uassert(ErrorCodes::ExceededMemoryLimit, s, retCode != WT_CACHE_FULL);
 
+    if (retCode == WT_READ_BUSY) {
+        return Status(ErrorCodes::StorageBusy, s);
+    }
+
     // TODO convert specific codes rather than just using UNKNOWN_ERROR for everything.
     return Status(ErrorCodes::UnknownError, s);
 }
@@ -35,6 +35,7 @@
 
 #include "mongo/base/string_data.h"
 #include "mongo/db/operation_context_noop.h"
+#include "mongo/db/storage/deadline_read.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_recovery_unit.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_session_cache.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_util.h"
@@ -347,4 +348,111 @@ TEST(WiredTigerUtilTest, GetStatisticsValueAsUInt8) {
     ASSERT_EQUALS(static_cast<uint8_t>(100), resultInt16.getValue());
 }
 
+TEST(WiredTigerUtilTest, ReadBusyMapsToStorageBusy) {
+    Status status = wtRCToStatus(WT_READ_BUSY);
+    ASSERT_EQUALS(ErrorCodes::StorageBusy, status.code());
+}
+
+TEST(WiredTigerUtilTest, SearchWithReadDeadlineReadsCachedPages) {
+    WiredTigerUtilHarnessHelper harnessHelper("");
+    WiredTigerRecoveryUnit recoveryUnit(harnessHelper.getSessionCache());
+    WiredTigerSession* session = recoveryUnit.getSession(NULL);
+    WT_SESSION* wtSession = session->getSession();
+    ASSERT_OK(wtRCToStatus(
+        wtSession->create(wtSession, "table:mytable", "key_format=q,value_format=u")));
+
+    WT_CURSOR* cursor;
+    ASSERT_OK(
+        wtRCToStatus(wtSession->open_cursor(wtSession, "table:mytable", NULL, NULL, &cursor)));
+    WT_ITEM value = {"abc", 3};
+    cursor->set_key(cursor, 1LL);
+    cursor->set_value(cursor, &value);
+    ASSERT_OK(wtRCToStatus(cursor->insert(cursor)));
+
+    // Pages already in the cache never need a read, so a deadline doesn't change the result.
+    ASSERT_OK(wtRCToStatus(wtSession->set_read_deadline(wtSession, 1)));
+    cursor->set_key(cursor, 1LL);
+    ASSERT_OK(wtRCToStatus(cursor->search(cursor)));
+    ASSERT_OK(wtRCToStatus(wtSession->set_read_deadline(wtSession, -1)));
+    ASSERT_OK(wtRCToStatus(cursor->close(cursor)));
+}
+
+TEST(WiredTigerUtilTest, CachedPagesAreNotCountedAsReads) {
+    WiredTigerUtilHarnessHelper harnessHelper("");
+    WiredTigerRecoveryUnit recoveryUnit(harnessHelper.getSessionCache());
+    WiredTigerSession* session = recoveryUnit.getSession(NULL);
+    WT_SESSION* wtSession = session->getSession();
+    ASSERT_OK(wtRCToStatus(
+        wtSession->create(wtSession, "table:mytable", "key_format=q,value_format=u")));
+
+    WT_CURSOR* cursor;
+    ASSERT_OK(
+        wtRCToStatus(wtSession->open_cursor(wtSession, "table:mytable", NULL, NULL, &cursor)));
+    WT_ITEM value = {"abc", 3};
+    cursor->set_key(cursor, 1LL);
+    cursor->set_value(cursor, &value);
+    ASSERT_OK(wtRCToStatus(cursor->insert(cursor)));
+    cursor->set_key(cursor, 1LL);
+    ASSERT_OK(wtRCToStatus(cursor->search(cursor)));
+    ASSERT_OK(wtRCToStatus(cursor->close(cursor)));
+
+    // The table was created in this session and never left the cache.
+    uint64_t reads, bytes, timeMicros, busy;
+    ASSERT_OK(
+        wtRCToStatus(wtSession->get_read_stats(wtSession, &reads, &bytes, &timeMicros, &busy)));
+    ASSERT_EQUALS(0U, reads);
+    ASSERT_EQUALS(0U, bytes);
+    ASSERT_EQUALS(0U, busy);
+}
+
+TEST(WiredTigerUtilTest, UncachedPagesAreCountedAsReads) {
+    unittest::TempDir dbpath("wt_test");
+    {
+        WiredTigerConnection connection(dbpath.path(), "");
+        WT_CONNECTION* conn = connection.getConnection();
+        WT_SESSION* wtSession;
+        ASSERT_OK(wtRCToStatus(conn->open_session(conn, NULL, NULL, &wtSession)));
+        ASSERT_OK(wtRCToStatus(
+            wtSession->create(wtSession, "table:mytable", "key_format=q,value_format=u")));
+
+        WT_CURSOR* cursor;
+        ASSERT_OK(
+            wtRCToStatus(wtSession->open_cursor(wtSession, "table:mytable", NULL, NULL, &cursor)));
+        WT_ITEM value = {"abc", 3};
+        cursor->set_key(cursor, 1LL);
+        cursor->set_value(cursor, &value);
+        ASSERT_OK(wtRCToStatus(cursor->insert(cursor)));
+        ASSERT_OK(wtRCToStatus(cursor->close(cursor)));
+    }
+
+    // Closing the connection checkpointed the table, so the reopened one has to read it back.
+    WiredTigerConnection connection(dbpath.path(), "");
+    WiredTigerSessionCache sessionCache(connection.getConnection());
+    std::unique_ptr<OperationContext> opCtx(
+        new OperationContextNoop(new WiredTigerRecoveryUnit(&sessionCache)));
+    WiredTigerRecoveryUnit* recoveryUnit = WiredTigerRecoveryUnit::get(opCtx.get());
+    WT_SESSION* wtSession = recoveryUnit->getSession(opCtx.get())->getSession();
+
+    WT_CURSOR* cursor;
+    ASSERT_OK(
+        wtRCToStatus(wtSession->open_cursor(wtSession, "table:mytable", NULL, NULL, &cursor)));
+    cursor->set_key(cursor, 1LL);
+    ASSERT_OK(wtRCToStatus(cursor->search(cursor)));
+    ASSERT_OK(wtRCToStatus(cursor->close(cursor)));
+
+    uint64_t reads, bytes, timeMicros, busy;
+    ASSERT_OK(
+        wtRCToStatus(wtSession->get_read_stats(wtSession, &reads, &bytes, &timeMicros, &busy)));
+    ASSERT_GREATER_THAN(reads, 0U);
+    ASSERT_GREATER_THAN(bytes, 0U);
+    ASSERT_EQUALS(0U, busy);
+
+    // The operation is charged with the same reads.
+    recoveryUnit->reportStorageReads(opCtx.get());
+    StorageReadStats stats = StorageReadStats::get(opCtx.get());
+    ASSERT_EQUALS(static_cast<long long>(reads), stats.reads);
+    ASSERT_EQUALS(static_cast<long long>(bytes), stats.bytesRead);
+    ASSERT_EQUALS(0, stats.busyRejections);
+}
+
 }  // namespace mongo
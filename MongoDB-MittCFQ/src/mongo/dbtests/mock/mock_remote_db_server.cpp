@@ -73,6 +73,7 @@ MockRemoteDBServer::MockRemoteDBServer(const string& hostAndPort)
     : _isRunning(true),
       _hostAndPort(hostAndPort),
       _delayMilliSec(0),
+      _storageBusy(false),
       _cmdCount(0),
       _queryCount(0),
       _instanceID(0) {
@@ -87,6 +88,11 @@ void MockRemoteDBServer::setDelay(long long milliSec) {
     _delayMilliSec = milliSec;
 }
 
+void MockRemoteDBServer::setStorageBusy(bool busy) {
+    scoped_spinlock sLock(_lock);
+    _storageBusy = busy;
+}
+
 void MockRemoteDBServer::shutdown() {
     scoped_spinlock sLock(_lock);
     _isRunning = false;
@@ -214,6 +220,12 @@ mongo::BSONArray MockRemoteDBServer::query(MockRemoteDBServer::InstanceID id,
     scoped_spinlock sLock(_lock);
     _queryCount++;
 
+    if (_storageBusy) {
+        throw DBException(str::stream() << _hostAndPort
+                                        << " could not serve the read before its deadline",
+                          ErrorCodes::StorageBusy);
+    }
+
     const vector<BSONObj>& coll = _dataMgr[ns];
     BSONArrayBuilder result;
     for (vector<BSONObj>::const_iterator iter = coll.begin(); iter != coll.end(); ++iter) {
@@ -86,6 +86,12 @@ public:
      */
     void setDelay(long long milliSec);
 
+    /**
+     * Makes queries fail with ErrorCodes::StorageBusy, as if the server's I/O scheduler had
+     * rejected their reads.
+     */
+    void setStorageBusy(bool busy);
+
     /**
      * Shuts down this server. Any operations on this server with an InstanceID
      * less than or equal to the current one will throw a mongo::SocketException.
@@ -224,6 +230,7 @@ private:
 
     const std::string _hostAndPort;
     long long _delayMilliSec;
+    bool _storageBusy;
 
     //
     // Mock replies
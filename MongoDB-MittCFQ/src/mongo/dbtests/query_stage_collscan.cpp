@@ -40,14 +40,17 @@
 #include "mongo/db/dbdirectclient.h"
 #include "mongo/db/exec/collection_scan.h"
 #include "mongo/db/exec/plan_stage.h"
+#include "mongo/db/exec/working_set_common.h"
 #include "mongo/db/json.h"
 #include "mongo/db/matcher/expression_parser.h"
 #include "mongo/db/matcher/extensions_callback_disallow_extensions.h"
 #include "mongo/db/query/plan_executor.h"
 #include "mongo/db/storage/record_store.h"
+#include "mongo/db/storage/storage_engine.h"
 #include "mongo/dbtests/dbtests.h"
 #include "mongo/stdx/memory.h"
 #include "mongo/util/fail_point_service.h"
+#include "mongo/util/scopeguard.h"
 
 namespace QueryStageCollectionScan {
 
@@ -400,6 +403,50 @@ public:
     }
 };
 
+//
+// A collection scan whose read the I/O scheduler rejects fails with StorageBusy, unless it holds
+// a write lock, which never uses deadline reads. Only mmapv1 bounds scans with deadline reads.
+//
+class QueryStageCollscanStorageBusy : public QueryStageCollectionScanBase {
+public:
+    void run() {
+        if (!getGlobalServiceContext()->getGlobalStorageEngine()->isMmapV1()) {
+            return;
+        }
+
+        FailPoint* readBusy = getGlobalFailPointRegistry()->getFailPoint("mmapv1ReadBusy");
+        readBusy->setMode(FailPoint::alwaysOn);
+        ON_BLOCK_EXIT([readBusy] { readBusy->setMode(FailPoint::off); });
+
+        // Like a find with maxTimeMS, whose reads get the time it has left as their deadline.
+        _txn.setDeadlineAfterNowBy(Seconds(60));
+
+        {
+            AutoGetCollectionForRead ctx(&_txn, ns());
+            WorkingSet ws;
+            CollectionScanParams params;
+            params.collection = ctx.getCollection();
+            params.direction = CollectionScanParams::FORWARD;
+            params.tailable = false;
+
+            unique_ptr<CollectionScan> scan(new CollectionScan(&_txn, params, &ws, NULL));
+            WorkingSetID id = WorkingSet::INVALID_ID;
+            PlanStage::StageState state = PlanStage::NEED_TIME;
+            while (PlanStage::NEED_TIME == state || PlanStage::NEED_YIELD == state) {
+                state = scan->work(&id);
+            }
+            ASSERT_EQUALS(PlanStage::FAILURE, state);
+            ASSERT_EQUALS(ErrorCodes::StorageBusy,
+                          WorkingSetCommon::getMemberStatus(*ws.get(id)).code());
+        }
+
+        OldClientWriteContext ctx(&_txn, ns());
+        vector<RecordId> recordIds;
+        getRecordIds(ctx.getCollection(), CollectionScanParams::FORWARD, &recordIds);
+        ASSERT_EQUALS(numObj(), static_cast<int>(recordIds.size()));
+    }
+};
+
 class All : public Suite {
 public:
     All() : Suite("QueryStageCollectionScan") {}
@@ -414,6 +461,7 @@ public:
         add<QueryStageCollscanObjectsInOrderBackward>();
         add<QueryStageCollscanInvalidateUpcomingObject>();
         add<QueryStageCollscanInvalidateUpcomingObjectBackward>();
+        add<QueryStageCollscanStorageBusy>();
     }
 };
 
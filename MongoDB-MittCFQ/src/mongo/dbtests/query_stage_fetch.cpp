@@ -41,11 +41,15 @@
 #include "mongo/db/exec/fetch.h"
 #include "mongo/db/exec/plan_stage.h"
 #include "mongo/db/exec/queued_data_stage.h"
+#include "mongo/db/exec/working_set_common.h"
 #include "mongo/db/json.h"
 #include "mongo/db/matcher/expression_parser.h"
 #include "mongo/db/matcher/extensions_callback_disallow_extensions.h"
+#include "mongo/db/storage/storage_options.h"
 #include "mongo/dbtests/dbtests.h"
 #include "mongo/stdx/memory.h"
+#include "mongo/util/fail_point_service.h"
+#include "mongo/util/scopeguard.h"
 
 namespace QueryStageFetch {
 
@@ -219,6 +223,123 @@ public:
     }
 };
 
+//
+// Test that a read-only fetch of several records returns them in the order the child produced
+// them, whatever order the storage engine read them in.
+//
+class FetchStageBatchKeepsChildOrder : public QueryStageFetchBase {
+public:
+    void run() {
+        // Batch even if the kernel has no deadline reads.
+        FailPoint* alwaysBatch =
+            getGlobalFailPointRegistry()->getFailPoint("fetchStageAlwaysBatch");
+        alwaysBatch->setMode(FailPoint::alwaysOn);
+        ON_BLOCK_EXIT([alwaysBatch] { alwaysBatch->setMode(FailPoint::off); });
+
+        const int numDocs = 10;
+        for (int i = 0; i < numDocs; ++i) {
+            insert(BSON("foo" << i));
+        }
+
+        AutoGetCollectionForRead ctx(&_txn, ns());
+        Collection* coll = ctx.getCollection();
+        ASSERT(coll);
+
+        WorkingSet ws;
+        set<RecordId> recordIds;
+        getRecordIds(&recordIds, coll);
+        ASSERT_EQUALS(size_t(numDocs), recordIds.size());
+
+        // Queue the documents in reverse RecordId order.
+        auto mockStage = make_unique<QueuedDataStage>(&_txn, &ws);
+        for (auto it = recordIds.rbegin(); it != recordIds.rend(); ++it) {
+            WorkingSetID id = ws.allocate();
+            WorkingSetMember* mockMember = ws.get(id);
+            mockMember->recordId = *it;
+            ws.transitionToRecordIdAndIdx(id);
+            mockStage->pushBack(id);
+        }
+
+        unique_ptr<FetchStage> fetchStage(
+            new FetchStage(&_txn, &ws, mockStage.release(), NULL, coll));
+
+        std::vector<RecordId> returned;
+        WorkingSetID id = WorkingSet::INVALID_ID;
+        PlanStage::StageState state = PlanStage::NEED_TIME;
+        while (state != PlanStage::IS_EOF) {
+            state = fetchStage->work(&id);
+            ASSERT_NOT_EQUALS(PlanStage::FAILURE, state);
+            if (state == PlanStage::ADVANCED) {
+                WorkingSetMember* member = ws.get(id);
+                ASSERT_EQUALS(WorkingSetMember::RID_AND_OBJ, member->getState());
+                returned.push_back(member->recordId);
+                ws.free(id);
+            }
+        }
+
+        ASSERT_EQUALS(size_t(numDocs), returned.size());
+        ASSERT(std::equal(returned.begin(), returned.end(), recordIds.rbegin()));
+    }
+};
+
+//
+// Test that a fetch whose read the I/O scheduler rejects fails with StorageBusy, one record or
+// a batch at a time, instead of dropping the documents.
+//
+class FetchStageStorageBusy : public QueryStageFetchBase {
+public:
+    void run() {
+        // WTReadBusy rejects the point reads of WiredTiger only.
+        if (storageGlobalParams.engine != "wiredTiger") {
+            return;
+        }
+
+        for (int i = 0; i < 3; ++i) {
+            insert(BSON("foo" << i));
+        }
+
+        FailPoint* readBusy = getGlobalFailPointRegistry()->getFailPoint("WTReadBusy");
+        readBusy->setMode(FailPoint::alwaysOn);
+        ON_BLOCK_EXIT([readBusy] { readBusy->setMode(FailPoint::off); });
+
+        FailPoint* alwaysBatch =
+            getGlobalFailPointRegistry()->getFailPoint("fetchStageAlwaysBatch");
+        ON_BLOCK_EXIT([alwaysBatch] { alwaysBatch->setMode(FailPoint::off); });
+
+        for (bool batch : {false, true}) {
+            alwaysBatch->setMode(batch ? FailPoint::alwaysOn : FailPoint::off);
+
+            AutoGetCollectionForRead ctx(&_txn, ns());
+            Collection* coll = ctx.getCollection();
+            ASSERT(coll);
+
+            WorkingSet ws;
+            set<RecordId> recordIds;
+            getRecordIds(&recordIds, coll);
+
+            auto mockStage = make_unique<QueuedDataStage>(&_txn, &ws);
+            for (const RecordId& recordId : recordIds) {
+                WorkingSetID id = ws.allocate();
+                ws.get(id)->recordId = recordId;
+                ws.transitionToRecordIdAndIdx(id);
+                mockStage->pushBack(id);
+            }
+
+            unique_ptr<FetchStage> fetchStage(
+                new FetchStage(&_txn, &ws, mockStage.release(), NULL, coll));
+
+            WorkingSetID id = WorkingSet::INVALID_ID;
+            PlanStage::StageState state = PlanStage::NEED_TIME;
+            while (PlanStage::NEED_TIME == state) {
+                state = fetchStage->work(&id);
+            }
+            ASSERT_EQUALS(PlanStage::FAILURE, state);
+            ASSERT_EQUALS(ErrorCodes::StorageBusy,
+                          WorkingSetCommon::getMemberStatus(*ws.get(id)).code());
+        }
+    }
+};
+
 class All : public Suite {
 public:
     All() : Suite("query_stage_fetch") {}
@@ -226,6 +347,8 @@ public:
     void setupTests() {
         add<FetchStageAlreadyFetched>();
         add<FetchStageFilter>();
+        add<FetchStageStorageBusy>();
+        add<FetchStageBatchKeepsChildOrder>();
     }
 };
 
@@ -0,0 +1,117 @@
+/**
+ *    Copyright (C) 2016 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+/**
+ * This file tests db/exec/idhack.cpp.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/catalog/collection.h"
+#include "mongo/db/catalog/index_catalog.h"
+#include "mongo/db/client.h"
+#include "mongo/db/db_raii.h"
+#include "mongo/db/dbdirectclient.h"
+#include "mongo/db/exec/idhack.h"
+#include "mongo/db/exec/working_set_common.h"
+#include "mongo/db/storage/storage_options.h"
+#include "mongo/dbtests/dbtests.h"
+#include "mongo/util/fail_point_service.h"
+#include "mongo/util/scopeguard.h"
+
+namespace QueryStageIDHack {
+
+class QueryStageIDHackBase {
+public:
+    QueryStageIDHackBase() : _client(&_txn) {
+        _client.dropCollection(ns());
+        _client.insert(ns(), BSON("_id" << 1 << "foo" << 1));
+    }
+
+    virtual ~QueryStageIDHackBase() {
+        _client.dropCollection(ns());
+    }
+
+    static const char* ns() {
+        return "unittests.QueryStageIDHack";
+    }
+
+protected:
+    const ServiceContext::UniqueOperationContext _txnPtr = cc().makeOperationContext();
+    OperationContext& _txn = *_txnPtr;
+    DBDirectClient _client;
+};
+
+//
+// A lookup whose document read the I/O scheduler rejects fails with StorageBusy, so that the
+// client can retry on another member, instead of returning nothing.
+//
+class IDHackStorageBusy : public QueryStageIDHackBase {
+public:
+    void run() {
+        // WTReadBusy rejects the point reads of WiredTiger only.
+        if (storageGlobalParams.engine != "wiredTiger") {
+            return;
+        }
+
+        FailPoint* readBusy = getGlobalFailPointRegistry()->getFailPoint("WTReadBusy");
+        readBusy->setMode(FailPoint::alwaysOn);
+        ON_BLOCK_EXIT([readBusy] { readBusy->setMode(FailPoint::off); });
+
+        AutoGetCollectionForRead ctx(&_txn, ns());
+        Collection* coll = ctx.getCollection();
+        ASSERT(coll);
+
+        WorkingSet ws;
+        IDHackStage idhack(
+            &_txn, coll, BSON("_id" << 1), &ws, coll->getIndexCatalog()->findIdIndex(&_txn));
+
+        WorkingSetID id = WorkingSet::INVALID_ID;
+        PlanStage::StageState state = PlanStage::NEED_TIME;
+        while (PlanStage::NEED_TIME == state || PlanStage::NEED_YIELD == state) {
+            state = idhack.work(&id);
+        }
+        ASSERT_EQUALS(PlanStage::FAILURE, state);
+        ASSERT_EQUALS(ErrorCodes::StorageBusy,
+                      WorkingSetCommon::getMemberStatus(*ws.get(id)).code());
+        ASSERT_TRUE(idhack.isEOF());
+    }
+};
+
+class All : public Suite {
+public:
+    All() : Suite("query_stage_idhack") {}
+
+    void setupTests() {
+        add<IDHackStorageBusy>();
+    }
+};
+
+SuiteInstance<All> queryStageIDHackAll;
+
+}  // namespace QueryStageIDHack
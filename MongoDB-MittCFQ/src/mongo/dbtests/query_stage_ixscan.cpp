@@ -30,11 +30,16 @@
 
 #include "mongo/db/client.h"
 #include "mongo/db/db_raii.h"
+#include "mongo/db/dbdirectclient.h"
 #include "mongo/db/exec/index_scan.h"
 #include "mongo/db/exec/working_set.h"
+#include "mongo/db/exec/working_set_common.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/json.h"
+#include "mongo/db/storage/storage_engine.h"
 #include "mongo/dbtests/dbtests.h"
+#include "mongo/util/fail_point_service.h"
+#include "mongo/util/scopeguard.h"
 
 namespace QueryStageIxscan {
 
@@ -310,6 +315,68 @@ public:
     }
 };
 
+// An index scan whose bucket read the I/O scheduler rejects fails with StorageBusy. Only mmapv1
+// reads index buckets with deadline reads, and only for operations that hold no write lock, so
+// this test does not use IndexScanTest and its database lock.
+class QueryStageIxscanStorageBusy {
+public:
+    QueryStageIxscanStorageBusy() : _client(&_txn) {}
+
+    ~QueryStageIxscanStorageBusy() {
+        _client.dropCollection(ns());
+    }
+
+    void run() {
+        if (!getGlobalServiceContext()->getGlobalStorageEngine()->isMmapV1()) {
+            return;
+        }
+
+        _client.dropCollection(ns());
+        ASSERT_OK(dbtests::createIndex(&_txn, ns(), BSON("x" << 1)));
+        for (int i = 0; i < 10; ++i) {
+            _client.insert(ns(), BSON("x" << i));
+        }
+
+        FailPoint* readBusy = getGlobalFailPointRegistry()->getFailPoint("mmapv1ReadBusy");
+        readBusy->setMode(FailPoint::alwaysOn);
+        ON_BLOCK_EXIT([readBusy] { readBusy->setMode(FailPoint::off); });
+
+        AutoGetCollectionForRead ctx(&_txn, ns());
+        std::vector<IndexDescriptor*> indexes;
+        ctx.getCollection()->getIndexCatalog()->findIndexesByKeyPattern(
+            &_txn, BSON("x" << 1), false, &indexes);
+        ASSERT_EQ(indexes.size(), 1U);
+
+        IndexScanParams params;
+        params.descriptor = indexes[0];
+        params.bounds.isSimpleRange = true;
+        params.bounds.startKey = BSON("x" << 0);
+        params.bounds.endKey = BSON("x" << 9);
+        params.bounds.endKeyInclusive = true;
+        params.direction = 1;
+
+        WorkingSet ws;
+        IndexScan ixscan(&_txn, params, &ws, NULL);
+        WorkingSetID id = WorkingSet::INVALID_ID;
+        PlanStage::StageState state = PlanStage::NEED_TIME;
+        while (PlanStage::NEED_TIME == state) {
+            state = ixscan.work(&id);
+        }
+        ASSERT_EQUALS(PlanStage::FAILURE, state);
+        ASSERT_EQUALS(ErrorCodes::StorageBusy,
+                      WorkingSetCommon::getMemberStatus(*ws.get(id)).code());
+    }
+
+    static const char* ns() {
+        return "unittest.QueryStageIxscanStorageBusy";
+    }
+
+private:
+    const ServiceContext::UniqueOperationContext _txnPtr = cc().makeOperationContext();
+    OperationContext& _txn = *_txnPtr;
+    DBDirectClient _client;
+};
+
 class All : public Suite {
 public:
     All() : Suite("query_stage_ixscan") {}
@@ -320,6 +387,7 @@ public:
         add<QueryStageIxscanInsertDuringSaveExclusive>();
         add<QueryStageIxscanInsertDuringSaveExclusive2>();
         add<QueryStageIxscanInsertDuringSaveReverse>();
+        add<QueryStageIxscanStorageBusy>();
     }
 } QueryStageIxscanAll;
 
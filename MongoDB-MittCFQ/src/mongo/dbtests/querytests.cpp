@@ -45,7 +45,11 @@
 #include "mongo/db/query/find.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/service_context_d.h"
+#include "mongo/db/storage/storage_options.h"
 #include "mongo/dbtests/dbtests.h"
+#include "mongo/rpc/get_status_from_command_result.h"
+#include "mongo/util/fail_point_service.h"
+#include "mongo/util/scopeguard.h"
 #include "mongo/util/timer.h"
 
 namespace QueryTests {
@@ -1726,6 +1730,70 @@ public:
     }
 };
 
+/**
+ * A document read that the I/O scheduler rejects fails find, getMore and their legacy opcodes
+ * with StorageBusy, which clients retry on another member, rather than with an executor error.
+ */
+class StorageBusyReads : public CollectionBase {
+public:
+    StorageBusyReads() : CollectionBase("storagebusyreads") {}
+    void run() {
+        // WTReadBusy rejects the point reads of WiredTiger only.
+        if (storageGlobalParams.engine != "wiredTiger") {
+            return;
+        }
+
+        ASSERT_OK(dbtests::createIndex(&_txn, ns(), BSON("a" << 1)));
+        for (int i = 0; i < 3; ++i) {
+            insert(ns(), BSON("a" << i));
+        }
+
+        // Open cursors while reads still succeed. The index scan fetches each document.
+        const BSONObj findCmd = BSON("find"
+                                     << "querytests.storagebusyreads"
+                                     << "filter"
+                                     << BSON("a" << GTE << 0)
+                                     << "hint"
+                                     << BSON("a" << 1)
+                                     << "batchSize"
+                                     << 1);
+        BSONObj result;
+        ASSERT(_client.runCommand("unittests", findCmd, result));
+        const long long cmdCursorId = result["cursor"]["id"].numberLong();
+        ASSERT_NE(0, cmdCursorId);
+
+        unique_ptr<DBClientCursor> cursor =
+            _client.query(ns(), QUERY("a" << GTE << 0).hint(BSON("a" << 1)), 0, 0, 0, 0, 1);
+        ASSERT_EQUALS(1, cursor->objsLeftInBatch());
+        const long long opCursorId = cursor->getCursorId();
+        ASSERT_NE(0, opCursorId);
+        cursor->decouple();
+        cursor.reset();
+
+        FailPoint* readBusy = getGlobalFailPointRegistry()->getFailPoint("WTReadBusy");
+        readBusy->setMode(FailPoint::alwaysOn);
+        ON_BLOCK_EXIT([readBusy] { readBusy->setMode(FailPoint::off); });
+
+        ASSERT_FALSE(_client.runCommand("unittests", findCmd, result));
+        ASSERT_EQUALS(ErrorCodes::StorageBusy, getStatusFromCommandResult(result));
+
+        ASSERT_FALSE(_client.runCommand("unittests",
+                                        BSON("getMore" << cmdCursorId << "collection"
+                                                       << "querytests.storagebusyreads"),
+                                        result));
+        ASSERT_EQUALS(ErrorCodes::StorageBusy, getStatusFromCommandResult(result));
+
+        BSONObj error;
+        cursor = _client.query(ns(), QUERY("a" << GTE << 0).hint(BSON("a" << 1)));
+        ASSERT(cursor->peekError(&error));
+        ASSERT_EQUALS(ErrorCodes::StorageBusy, error["code"].numberInt());
+
+        cursor = _client.getMore(ns(), opCursorId);
+        ASSERT(cursor->peekError(&error));
+        ASSERT_EQUALS(ErrorCodes::StorageBusy, error["code"].numberInt());
+    }
+};
+
 namespace queryobjecttests {
 class names1 {
 public:
@@ -1821,6 +1889,7 @@ public:
         add<QueryCursorTimeout>();
         add<QueryReadsAll>();
         add<KillPinnedCursor>();
+        add<StorageBusyReads>();
 
         add<queryobjecttests::names1>();
 
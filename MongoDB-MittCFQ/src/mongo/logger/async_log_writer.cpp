@@ -0,0 +1,257 @@
+/**
+ *    Copyright (C) 2016 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/logger/async_log_writer.h"
+
+#include <sstream>
+
+#include "mongo/logger/message_event.h"
+#include "mongo/logger/message_event_utf8_encoder.h"
+#include "mongo/logger/rotatable_file_writer.h"
+#include "mongo/util/concurrency/thread_name.h"
+#include "mongo/util/mongoutils/str.h"
+#include "mongo/util/time_support.h"
+
+namespace mongo {
+namespace logger {
+
+namespace {
+
+// A batch is written once it reaches this size even if more messages are queued.
+const size_t kMaxBatchBytes = 1024 * 1024;
+
+// How long the writer thread sleeps when it may have missed a wakeup.
+const Milliseconds kIdleWait(100);
+
+size_t roundUpToPowerOfTwo(size_t n) {
+    size_t result = 2;
+    while (result < n) {
+        result <<= 1;
+    }
+    return result;
+}
+
+}  // namespace
+
+AsyncLogWriter::AsyncLogWriter(RotatableFileWriter* writer, size_t capacity)
+    : _writer(writer),
+      _mask(roundUpToPowerOfTwo(capacity) - 1),
+      _slots(new Slot[_mask + 1]) {
+    for (size_t i = 0; i <= _mask; ++i) {
+        _slots[i].sequence.store(i);
+    }
+    _thread = stdx::thread([this] { _run(); });
+}
+
+AsyncLogWriter::~AsyncLogWriter() {
+    shutdown();
+}
+
+bool AsyncLogWriter::write(std::string message, bool mayDrop) {
+    while (!_stopped.load()) {
+        if (_tryPush(&message)) {
+            if (_writerIdle.load()) {
+                stdx::lock_guard<stdx::mutex> lk(_mutex);
+                _workAvailable.notify_one();
+            }
+            if (_stopped.load()) {
+                // Raced with shutdown(); the writer thread may be gone already.
+                stdx::lock_guard<stdx::mutex> lk(_drainMutex);
+                _drainAndWrite_inlock();
+            }
+            return true;
+        }
+
+        if (mayDrop) {
+            _dropped.addAndFetch(1);
+            return false;
+        }
+
+        stdx::unique_lock<stdx::mutex> lk(_mutex);
+        _workAvailable.notify_one();
+        _progress.wait_for(lk, kIdleWait.toSystemDuration());
+    }
+
+    stdx::lock_guard<stdx::mutex> lk(_drainMutex);
+    _drainAndWrite_inlock();
+    _writeBatch(message);
+    return true;
+}
+
+void AsyncLogWriter::flush() {
+    const uint64_t target = _enqueuePos.load();
+
+    {
+        stdx::unique_lock<stdx::mutex> lk(_mutex);
+        while (_writtenPos.load() < target && !_stopped.load()) {
+            _workAvailable.notify_one();
+            _progress.wait_for(lk, kIdleWait.toSystemDuration());
+        }
+    }
+
+    if (_stopped.load()) {
+        stdx::lock_guard<stdx::mutex> lk(_drainMutex);
+        _drainAndWrite_inlock();
+    }
+}
+
+void AsyncLogWriter::shutdown() {
+    {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        if (_shutdown) {
+            return;
+        }
+        _shutdown = true;
+        _workAvailable.notify_one();
+    }
+
+    _thread.join();
+    _stopped.store(true);
+
+    {
+        stdx::lock_guard<stdx::mutex> lk(_drainMutex);
+        _drainAndWrite_inlock();
+    }
+
+    stdx::lock_guard<stdx::mutex> lk(_mutex);
+    _progress.notify_all();
+}
+
+AsyncLogWriter::Stats AsyncLogWriter::getStats() {
+    Stats stats;
+    stats.written = static_cast<long long>(_writtenPos.load());
+    stats.dropped = _dropped.load();
+    stats.batches = _batches.load();
+    return stats;
+}
+
+bool AsyncLogWriter::_tryPush(std::string* message) {
+    uint64_t pos = _enqueuePos.load();
+    while (true) {
+        Slot& slot = _slots[pos & _mask];
+        const int64_t diff =
+            static_cast<int64_t>(slot.sequence.load()) - static_cast<int64_t>(pos);
+        if (diff == 0) {
+            const uint64_t current = _enqueuePos.compareAndSwap(pos, pos + 1);
+            if (current == pos) {
+                slot.message = std::move(*message);
+                slot.sequence.store(pos + 1);
+                return true;
+            }
+            pos = current;
+        } else if (diff < 0) {
+            // The writer thread has not consumed the message a full lap behind us yet.
+            return false;
+        } else {
+            pos = _enqueuePos.load();
+        }
+    }
+}
+
+void AsyncLogWriter::_run() {
+    setThreadName("logWriter");
+
+    std::string batch;
+    while (true) {
+        _drain(&batch);
+        if (!batch.empty()) {
+            _writeBatch(batch);
+            batch.clear();
+
+            stdx::lock_guard<stdx::mutex> lk(_mutex);
+            _progress.notify_all();
+            continue;
+        }
+
+        stdx::unique_lock<stdx::mutex> lk(_mutex);
+        if (_shutdown) {
+            return;
+        }
+
+        // Writing threads only take the mutex to wake us when they see this flag set, so check
+        // for messages again after setting it.
+        _writerIdle.store(true);
+        if (_slots[_readPos & _mask].sequence.load() != _readPos + 1) {
+            _workAvailable.wait_for(lk, kIdleWait.toSystemDuration());
+        }
+        _writerIdle.store(false);
+    }
+}
+
+void AsyncLogWriter::_drain(std::string* batch) {
+    const long long dropped = _dropped.load();
+    if (dropped != _droppedReported) {
+        const std::string message = str::stream()
+            << "dropped " << (dropped - _droppedReported)
+            << " log messages because the asynchronous log buffer was full";
+        std::ostringstream os;
+        MessageEventDetailsEncoder().encode(
+            MessageEventEphemeral(Date_t::now(), LogSeverity::Warning(), "logWriter", message),
+            os);
+        batch->append(os.str());
+        _droppedReported = dropped;
+    }
+
+    while (batch->size() < kMaxBatchBytes) {
+        Slot& slot = _slots[_readPos & _mask];
+        if (slot.sequence.load() != _readPos + 1) {
+            break;
+        }
+        batch->append(slot.message);
+        std::string().swap(slot.message);
+        slot.sequence.store(_readPos + _mask + 1);
+        ++_readPos;
+    }
+}
+
+void AsyncLogWriter::_writeBatch(const std::string& batch) {
+    {
+        RotatableFileWriter::Use useWriter(_writer);
+        if (useWriter.status().isOK()) {
+            useWriter.stream().write(batch.data(), batch.size()).flush();
+            _batches.addAndFetch(1);
+        }
+    }
+    _writtenPos.store(_readPos);
+}
+
+void AsyncLogWriter::_drainAndWrite_inlock() {
+    std::string batch;
+    do {
+        batch.clear();
+        _drain(&batch);
+        if (!batch.empty()) {
+            _writeBatch(batch);
+        }
+    } while (!batch.empty());
+}
+
+}  // namespace logger
+}  // namespace mongo
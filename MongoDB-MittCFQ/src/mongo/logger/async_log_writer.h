@@ -0,0 +1,141 @@
+/**
+ *    Copyright (C) 2016 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "mongo/base/disallow_copying.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/stdx/thread.h"
+
+namespace mongo {
+namespace logger {
+
+class RotatableFileWriter;
+
+/**
+ * Writes already-encoded log messages to a RotatableFileWriter from a dedicated thread, so that
+ * the threads that log never wait for the disk.
+ *
+ * Messages go through a bounded ring buffer that any number of threads may write to without
+ * taking a lock. The writer thread drains it in batches and writes each batch with a single
+ * write to the file. When the buffer is full, messages that may be dropped are counted and
+ * discarded; the others wait for room. A warning with the number of dropped messages is written
+ * once the buffer has room again.
+ *
+ * The file itself is still used through RotatableFileWriter::Use, so log rotation works as for
+ * the synchronous appender.
+ */
+class AsyncLogWriter {
+    MONGO_DISALLOW_COPYING(AsyncLogWriter);
+
+public:
+    struct Stats {
+        long long written = 0;  // messages written to the file
+        long long dropped = 0;  // messages discarded because the buffer was full
+        long long batches = 0;  // writes issued to the file
+    };
+
+    /**
+     * Starts the writer thread. "capacity" is rounded up to a power of two. Does not own
+     * "writer", which must outlive this object.
+     */
+    AsyncLogWriter(RotatableFileWriter* writer, size_t capacity);
+
+    ~AsyncLogWriter();
+
+    /**
+     * Queues "message" for writing. Never blocks when "mayDrop" is true; returns false if the
+     * message was dropped. After shutdown() the message is written synchronously.
+     */
+    bool write(std::string message, bool mayDrop);
+
+    /**
+     * Waits until every message queued before this call has been written to the file.
+     */
+    void flush();
+
+    /**
+     * Writes out the queued messages and stops the writer thread. Later writes go directly to
+     * the file. Safe to call more than once.
+     */
+    void shutdown();
+
+    Stats getStats();
+
+private:
+    struct Slot {
+        // Ticket of the write that may fill this slot next, plus one once it holds a message.
+        AtomicUInt64 sequence;
+        std::string message;
+    };
+
+    bool _tryPush(std::string* message);
+    void _run();
+
+    /**
+     * Moves queued messages into "batch" until the queue is empty or the batch is large enough.
+     * Only called by the writer thread, or with _drainMutex held once it has stopped.
+     */
+    void _drain(std::string* batch);
+    void _writeBatch(const std::string& batch);
+    void _drainAndWrite_inlock();
+
+    RotatableFileWriter* const _writer;
+    const size_t _mask;
+    std::unique_ptr<Slot[]> _slots;
+
+    // Next ticket handed to a writing thread, and the first ticket not yet consumed.
+    AtomicUInt64 _enqueuePos;
+    uint64_t _readPos = 0;
+
+    AtomicUInt64 _writtenPos;
+    AtomicInt64 _dropped;
+    AtomicInt64 _batches;
+    long long _droppedReported = 0;
+
+    AtomicWord<bool> _writerIdle{false};
+    AtomicWord<bool> _stopped{false};  // writer thread has exited; writes are synchronous
+
+    // Taken instead of the writer thread's role once it has stopped. Never held together with
+    // _mutex, since callers may log while holding the file.
+    stdx::mutex _drainMutex;
+
+    stdx::mutex _mutex;
+    stdx::condition_variable _workAvailable;  // writer thread waits for messages or shutdown
+    stdx::condition_variable _progress;       // flush() and full-buffer writers wait on this
+    bool _shutdown = false;
+    stdx::thread _thread;
+};
+
+}  // namespace logger
+}  // namespace mongo
@@ -0,0 +1,149 @@
+/*    Copyright 2016 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects
+ *    for all of the code used other than as permitted herein. If you modify
+ *    file(s) with this exception, you may extend this exception to your
+ *    version of the file(s), but you are not obligated to do so. If you do not
+ *    wish to do so, delete this exception statement from your version. If you
+ *    delete this exception statement from all source files in the program,
+ *    then also delete it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+#include "mongo/logger/async_log_writer.h"
+#include "mongo/logger/rotatable_file_writer.h"
+#include "mongo/stdx/thread.h"
+#include "mongo/util/mongoutils/str.h"
+#include "mongo/unittest/unittest.h"
+
+namespace {
+using namespace mongo;
+using namespace mongo::logger;
+
+const std::string logFileName("LogTest_AsyncLogWriter.txt");
+
+class AsyncLogWriterTest : public mongo::unittest::Test {
+public:
+    AsyncLogWriterTest() {
+        unlink(logFileName.c_str());
+        ASSERT_OK(RotatableFileWriter::Use(&fileWriter).setFileName(logFileName, false));
+    }
+
+    virtual ~AsyncLogWriterTest() {
+        unlink(logFileName.c_str());
+    }
+
+    std::vector<std::string> readLines() {
+        std::vector<std::string> lines;
+        std::ifstream ifs(logFileName.c_str());
+        std::string line;
+        while (std::getline(ifs, line)) {
+            lines.push_back(line);
+        }
+        return lines;
+    }
+
+    RotatableFileWriter fileWriter;
+};
+
+TEST_F(AsyncLogWriterTest, FlushWritesMessagesFromAllThreadsInTheirOrder) {
+    const int kThreads = 4;
+    const int kMessagesPerThread = 1000;
+
+    AsyncLogWriter writer(&fileWriter, 64);
+    std::vector<stdx::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&writer, t] {
+            for (int i = 0; i < kMessagesPerThread; ++i) {
+                writer.write(str::stream() << t << " " << i << "\n", false);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    writer.flush();
+
+    const auto lines = readLines();
+    ASSERT_EQUALS(static_cast<size_t>(kThreads * kMessagesPerThread), lines.size());
+
+    std::vector<int> next(kThreads, 0);
+    for (const auto& line : lines) {
+        std::istringstream is(line);
+        int t, i;
+        is >> t >> i;
+        ASSERT_EQUALS(next[t], i);
+        next[t]++;
+    }
+
+    const auto stats = writer.getStats();
+    ASSERT_EQUALS(kThreads * kMessagesPerThread, stats.written);
+    ASSERT_EQUALS(0, stats.dropped);
+    ASSERT_LESS_THAN_OR_EQUALS(1, stats.batches);
+}
+
+TEST_F(AsyncLogWriterTest, DropsWhenFullAndReportsTheCount) {
+    AsyncLogWriter writer(&fileWriter, 4);
+
+    int dropped = 0;
+    {
+        // Holding the file stalls the writer thread, so the buffer fills up.
+        RotatableFileWriter::Use stall(&fileWriter);
+        for (int i = 0; i < 100; ++i) {
+            if (!writer.write("message\n", true)) {
+                dropped++;
+            }
+        }
+    }
+    writer.flush();
+
+    ASSERT_LESS_THAN(0, dropped);
+    ASSERT_EQUALS(dropped, writer.getStats().dropped);
+
+    const auto lines = readLines();
+    ASSERT_EQUALS(static_cast<size_t>(100 - dropped + 1), lines.size());
+
+    bool reported = false;
+    for (const auto& line : lines) {
+        if (line.find(str::stream() << "dropped " << dropped << " log messages") !=
+            std::string::npos) {
+            reported = true;
+        }
+    }
+    ASSERT_TRUE(reported);
+}
+
+TEST_F(AsyncLogWriterTest, WritesSynchronouslyAfterShutdown) {
+    AsyncLogWriter writer(&fileWriter, 16);
+    writer.write("before\n", true);
+    writer.shutdown();
+    writer.write("after\n", true);
+
+    const auto lines = readLines();
+    ASSERT_EQUALS(2U, lines.size());
+    ASSERT_EQUALS("before", lines[0]);
+    ASSERT_EQUALS("after", lines[1]);
+}
+
+}  // namespace
@@ -0,0 +1,676 @@
+/**
+ *    Copyright (C) 2016 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#define MONGO_LOG_DEFAULT_COMPONENT ::mongo::logger::LogComponent::kNetwork
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/transport/transport_layer_asio.h"
+
+#include <asio.hpp>
+#include <vector>
+
+#include "mongo/base/checked_cast.h"
+#include "mongo/config.h"
+#include "mongo/db/server_options.h"
+#include "mongo/db/stats/counters.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/stdx/memory.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/stdx/thread.h"
+#include "mongo/stdx/unordered_map.h"
+#include "mongo/transport/service_entry_point.h"
+#include "mongo/transport/ticket_impl.h"
+#include "mongo/util/concurrency/thread_name.h"
+#include "mongo/util/log.h"
+#include "mongo/util/mongoutils/str.h"
+#include "mongo/util/net/listen.h"
+#include "mongo/util/net/sock.h"
+#include "mongo/util/net/message.h"
+#include "mongo/util/net/ssl_types.h"
+#include "mongo/util/net/ssl_options.h"
+#include "mongo/util/stringutils.h"
+
+namespace mongo {
+namespace transport {
+
+namespace {
+
+Status networkErrorToStatus(const std::error_code& ec) {
+    return {ErrorCodes::HostUnreachable, ec.message()};
+}
+
+/**
+ * Validates the length in a message header, and returns a buffer for the whole message with the
+ * header already copied in.
+ */
+StatusWith<SharedBuffer> allocateMessageBuffer(const MSGHEADER::Value& header) {
+    const int len = header.constView().getMessageLength();
+    if (static_cast<size_t>(len) < sizeof(MSGHEADER::Value) ||
+        static_cast<size_t>(len) > MaxMessageSizeBytes) {
+        return {ErrorCodes::ProtocolError,
+                str::stream() << "recv(): message len " << len << " is invalid. Min "
+                              << sizeof(MSGHEADER::Value)
+                              << " Max: "
+                              << MaxMessageSizeBytes};
+    }
+
+    auto buffer = SharedBuffer::allocate(len);
+    memcpy(buffer.get(), &header, sizeof(header));
+    return buffer;
+}
+
+char* messageBody(const SharedBuffer& buffer) {
+    return buffer.get() + sizeof(MSGHEADER::Value);
+}
+
+size_t messageBodyLength(const SharedBuffer& buffer) {
+    return MsgData::ConstView(buffer.get()).getLen() - sizeof(MSGHEADER::Value);
+}
+
+/**
+ * Hands a fully read message to the owner of the source ticket, decompressing it if needed.
+ */
+Status completeSource(Message* message,
+                      MessageCompressorManager* compressorManager,
+                      SharedBuffer buffer) {
+    message->setData(std::move(buffer));
+
+    networkCounter.hitPhysical(message->size(), 0);
+    if (message->operation() == dbCompressed) {
+        auto swm = compressorManager->decompressMessage(*message);
+        if (!swm.isOK())
+            return swm.getStatus();
+        *message = swm.getValue();
+    }
+    networkCounter.hitLogical(message->size(), 0);
+    return Status::OK();
+}
+
+void shutdownSocket(asio::ip::tcp::socket* socket) {
+    // Unlike socket->shutdown(), this is safe while another thread has an operation pending on
+    // the socket; the pending operation completes with an error.
+#ifdef _WIN32
+    ::shutdown(socket->native_handle(), SD_BOTH);
+#else
+    ::shutdown(socket->native_handle(), SHUT_RDWR);
+#endif
+}
+
+HostAndPort endpointToHostAndPort(const asio::ip::tcp::endpoint& endpoint) {
+    return HostAndPort(endpoint.address().to_string(), endpoint.port());
+}
+
+}  // namespace
+
+class TransportLayerASIO::ASIOTicket : public TicketImpl {
+    MONGO_DISALLOW_COPYING(ASIOTicket);
+
+public:
+    ASIOTicket(const Session& session, Date_t expiration, Message* source);
+    ASIOTicket(const Session& session, Date_t expiration, const Message& sink);
+
+    SessionId sessionId() const override;
+    Date_t expiration() const override;
+
+    SessionId _sessionId;
+    Date_t _expiration;
+
+    // Exactly one of these is set.
+    Message* _source;
+    const Message* _sink;
+
+    MessageCompressorManager* _compressorManager;
+};
+
+class TransportLayerASIO::Impl {
+    MONGO_DISALLOW_COPYING(Impl);
+
+public:
+    Impl(TransportLayerASIO* tl, const Options& opts, ServiceEntryPoint* sep)
+        : _tl(tl), _sep(sep), _options(opts), _running(false) {}
+
+    Status setup();
+    Status start();
+
+    int listenerPort() const;
+
+    Status wait(const Ticket& ticket, ASIOTicket* asioTicket);
+    void asyncWait(std::shared_ptr<Ticket> ticket, ASIOTicket* asioTicket, TicketCallback callback);
+
+    void registerTags(const Session& session);
+    Stats sessionStats();
+
+    void end(Session& session);
+    void endAllSessions(Session::TagMask tags);
+
+    void shutdown();
+
+    void destroy(Session& session);
+
+private:
+    using Socket = asio::ip::tcp::socket;
+
+    struct Connection {
+        Connection(std::shared_ptr<Socket> socket, Session::TagMask tags)
+            : socket(std::move(socket)), tags(tags) {}
+
+        std::shared_ptr<Socket> socket;
+        Session::TagMask tags;
+        bool ended = false;
+    };
+
+    using ConnectionMap = stdx::unordered_map<Session::Id, Connection>;
+
+    void _acceptConnection(asio::ip::tcp::acceptor* acceptor);
+    void _handleNewConnection(std::shared_ptr<Socket> socket);
+
+    StatusWith<std::shared_ptr<Socket>> _getSocket(const Ticket& ticket);
+
+    void _endSession_inlock(ConnectionMap::iterator conn);
+
+    TransportLayerASIO* const _tl;
+    ServiceEntryPoint* const _sep;
+    const Options _options;
+
+    asio::io_service _ioService;
+    std::unique_ptr<asio::io_service::work> _work;
+    std::vector<std::unique_ptr<asio::ip::tcp::acceptor>> _acceptors;
+    std::vector<stdx::thread> _networkThreads;
+
+    stdx::mutex _connectionsMutex;
+    ConnectionMap _connections;
+
+    AtomicWord<bool> _running;
+};
+
+TransportLayerASIO::ASIOTicket::ASIOTicket(const Session& session,
+                                           Date_t expiration,
+                                           Message* source)
+    : _sessionId(session.id()),
+      _expiration(expiration),
+      _source(source),
+      _sink(nullptr),
+      _compressorManager(&const_cast<Session&>(session).getCompressorManager()) {}
+
+TransportLayerASIO::ASIOTicket::ASIOTicket(const Session& session,
+                                           Date_t expiration,
+                                           const Message& sink)
+    : _sessionId(session.id()),
+      _expiration(expiration),
+      _source(nullptr),
+      _sink(&sink),
+      _compressorManager(&const_cast<Session&>(session).getCompressorManager()) {}
+
+SessionId TransportLayerASIO::ASIOTicket::sessionId() const {
+    return _sessionId;
+}
+
+Date_t TransportLayerASIO::ASIOTicket::expiration() const {
+    return _expiration;
+}
+
+TransportLayerASIO::TransportLayerASIO(const TransportLayerASIO::Options& opts,
+                                       ServiceEntryPoint* sep)
+    : _impl(stdx::make_unique<Impl>(this, opts, sep)) {}
+
+TransportLayerASIO::~TransportLayerASIO() = default;
+
+Status TransportLayerASIO::setup() {
+    return _impl->setup();
+}
+
+Status TransportLayerASIO::start() {
+    return _impl->start();
+}
+
+int TransportLayerASIO::listenerPort() const {
+    return _impl->listenerPort();
+}
+
+Ticket TransportLayerASIO::sourceMessage(Session& session, Message* message, Date_t expiration) {
+    return Ticket(this, stdx::make_unique<ASIOTicket>(session, expiration, message));
+}
+
+Ticket TransportLayerASIO::sinkMessage(Session& session,
+                                       const Message& message,
+                                       Date_t expiration) {
+    return Ticket(this, stdx::make_unique<ASIOTicket>(session, expiration, message));
+}
+
+Status TransportLayerASIO::wait(Ticket&& ticket) {
+    return _impl->wait(ticket, checked_cast<ASIOTicket*>(getTicketImpl(ticket)));
+}
+
+void TransportLayerASIO::asyncWait(Ticket&& ticket, TicketCallback callback) {
+    // The ticket owns the ASIOTicket, so it has to live until the callback runs.
+    auto sharedTicket = std::make_shared<Ticket>(std::move(ticket));
+    auto asioTicket = checked_cast<ASIOTicket*>(getTicketImpl(*sharedTicket));
+    _impl->asyncWait(std::move(sharedTicket), asioTicket, std::move(callback));
+}
+
+void TransportLayerASIO::registerTags(const Session& session) {
+    _impl->registerTags(session);
+}
+
+SSLPeerInfo TransportLayerASIO::getX509PeerInfo(const Session& session) const {
+    return SSLPeerInfo();
+}
+
+TransportLayer::Stats TransportLayerASIO::sessionStats() {
+    return _impl->sessionStats();
+}
+
+void TransportLayerASIO::end(Session& session) {
+    _impl->end(session);
+}
+
+void TransportLayerASIO::endAllSessions(Session::TagMask tags) {
+    _impl->endAllSessions(tags);
+}
+
+void TransportLayerASIO::shutdown() {
+    _impl->shutdown();
+}
+
+void TransportLayerASIO::_destroy(Session& session) {
+    _impl->destroy(session);
+}
+
+Status TransportLayerASIO::Impl::setup() {
+#ifdef MONGO_CONFIG_SSL
+    if (sslGlobalParams.sslMode.load() != SSLParams::SSLMode_disabled) {
+        return {ErrorCodes::BadValue, "The asio transport layer does not support SSL"};
+    }
+#endif
+
+    std::vector<std::string> ips;
+    if (_options.ipList.empty()) {
+        ips.push_back("0.0.0.0");
+        if (IPv6Enabled()) {
+            ips.push_back("::");
+        }
+    } else {
+        splitStringDelim(_options.ipList, &ips, ',');
+    }
+
+    for (const auto& ip : ips) {
+        if (ip.empty() || ip.find('/') != std::string::npos) {
+            // Unix domain sockets are left to the legacy transport layer.
+            continue;
+        }
+
+        std::error_code ec;
+        auto address = asio::ip::address::from_string(ip, ec);
+        if (ec) {
+            return {ErrorCodes::BadValue,
+                    str::stream() << "Invalid bind address " << ip << ": " << ec.message()};
+        }
+
+        asio::ip::tcp::endpoint endpoint(address, _options.port);
+        auto acceptor = stdx::make_unique<asio::ip::tcp::acceptor>(_ioService);
+        acceptor->open(endpoint.protocol(), ec);
+        if (!ec) {
+            acceptor->set_option(asio::ip::tcp::acceptor::reuse_address(true), ec);
+        }
+        if (!ec && address.is_v6()) {
+            acceptor->set_option(asio::ip::v6_only(true), ec);
+        }
+        if (!ec) {
+            acceptor->bind(endpoint, ec);
+        }
+        if (!ec) {
+            acceptor->listen(SOMAXCONN, ec);
+        }
+        if (ec) {
+            error() << "listen(): bind() failed " << ec.message() << " for socket: " << ip << ":"
+                    << _options.port;
+            return {ErrorCodes::SocketException, "Failed to set up sockets"};
+        }
+
+        _acceptors.push_back(std::move(acceptor));
+    }
+
+    if (_acceptors.empty()) {
+        return {ErrorCodes::BadValue, "No TCP address to listen on"};
+    }
+
+    return Status::OK();
+}
+
+Status TransportLayerASIO::Impl::start() {
+    if (_running.swap(true)) {
+        return {ErrorCodes::InternalError, "TransportLayer is already running"};
+    }
+
+    for (auto& acceptor : _acceptors) {
+        _acceptConnection(acceptor.get());
+    }
+
+    log() << "waiting for connections on port " << listenerPort() << " (asio, "
+          << _options.networkThreads << " network threads)";
+
+    _work = stdx::make_unique<asio::io_service::work>(_ioService);
+    for (int i = 0; i < std::max(_options.networkThreads, 1); ++i) {
+        _networkThreads.emplace_back([this, i] {
+            setThreadName(str::stream() << "network" << i);
+            _ioService.run();
+        });
+    }
+
+    return Status::OK();
+}
+
+int TransportLayerASIO::Impl::listenerPort() const {
+    invariant(!_acceptors.empty());
+    std::error_code ec;
+    const auto endpoint = _acceptors.front()->local_endpoint(ec);
+    return ec ? -1 : endpoint.port();
+}
+
+Status TransportLayerASIO::Impl::wait(const Ticket& ticket, ASIOTicket* asioTicket) {
+    auto swSocket = _getSocket(ticket);
+    if (!swSocket.isOK()) {
+        return swSocket.getStatus();
+    }
+    auto& socket = *swSocket.getValue();
+
+    std::error_code ec;
+    if (asioTicket->_sink) {
+        networkCounter.hitLogical(0, asioTicket->_sink->size());
+        auto swm = asioTicket->_compressorManager->compressMessage(*asioTicket->_sink);
+        if (!swm.isOK())
+            return swm.getStatus();
+        const auto& compressedMessage = swm.getValue();
+        asio::write(socket, asio::buffer(compressedMessage.buf(), compressedMessage.size()), ec);
+        if (ec) {
+            return networkErrorToStatus(ec);
+        }
+        networkCounter.hitPhysical(0, compressedMessage.size());
+        return Status::OK();
+    }
+
+    MSGHEADER::Value header;
+    asio::read(socket, asio::buffer(&header, sizeof(header)), ec);
+    if (ec) {
+        return networkErrorToStatus(ec);
+    }
+
+    auto swBuffer = allocateMessageBuffer(header);
+    if (!swBuffer.isOK()) {
+        return swBuffer.getStatus();
+    }
+    auto buffer = std::move(swBuffer.getValue());
+
+    asio::read(socket, asio::buffer(messageBody(buffer), messageBodyLength(buffer)), ec);
+    if (ec) {
+        return networkErrorToStatus(ec);
+    }
+
+    return completeSource(asioTicket->_source, asioTicket->_compressorManager, std::move(buffer));
+}
+
+void TransportLayerASIO::Impl::asyncWait(std::shared_ptr<Ticket> sharedTicket,
+                                         ASIOTicket* asioTicket,
+                                         TicketCallback callback) {
+    auto swSocket = _getSocket(*sharedTicket);
+    if (!swSocket.isOK()) {
+        callback(swSocket.getStatus());
+        return;
+    }
+    auto socket = std::move(swSocket.getValue());
+
+    if (asioTicket->_sink) {
+        networkCounter.hitLogical(0, asioTicket->_sink->size());
+        auto swm = asioTicket->_compressorManager->compressMessage(*asioTicket->_sink);
+        if (!swm.isOK()) {
+            callback(swm.getStatus());
+            return;
+        }
+        auto compressedMessage = std::make_shared<Message>(std::move(swm.getValue()));
+        asio::async_write(
+            *socket,
+            asio::buffer(compressedMessage->buf(), compressedMessage->size()),
+            [socket, sharedTicket, compressedMessage, callback](const std::error_code& ec,
+                                                                 size_t) {
+                if (ec) {
+                    callback(networkErrorToStatus(ec));
+                    return;
+                }
+                networkCounter.hitPhysical(0, compressedMessage->size());
+                callback(Status::OK());
+            });
+        return;
+    }
+
+    auto header = std::make_shared<MSGHEADER::Value>();
+    asio::async_read(
+        *socket,
+        asio::buffer(header.get(), sizeof(*header)),
+        [socket, sharedTicket, asioTicket, header, callback](const std::error_code& ec, size_t) {
+            if (ec) {
+                callback(networkErrorToStatus(ec));
+                return;
+            }
+
+            auto swBuffer = allocateMessageBuffer(*header);
+            if (!swBuffer.isOK()) {
+                callback(swBuffer.getStatus());
+                return;
+            }
+            auto buffer = std::move(swBuffer.getValue());
+            auto body = asio::buffer(messageBody(buffer), messageBodyLength(buffer));
+
+            asio::async_read(
+                *socket,
+                body,
+                [socket, sharedTicket, asioTicket, buffer, callback](const std::error_code& ec,
+                                                                     size_t) {
+                    if (ec) {
+                        callback(networkErrorToStatus(ec));
+                        return;
+                    }
+                    callback(completeSource(
+                        asioTicket->_source, asioTicket->_compressorManager, buffer));
+                });
+        });
+}
+
+TransportLayer::Stats TransportLayerASIO::Impl::sessionStats() {
+    Stats stats;
+    {
+        stdx::lock_guard<stdx::mutex> lk(_connectionsMutex);
+        stats.numOpenSessions = _connections.size();
+    }
+
+    stats.numAvailableSessions = Listener::globalTicketHolder.available();
+    stats.numCreatedSessions = Listener::globalConnectionNumber.load();
+
+    return stats;
+}
+
+void TransportLayerASIO::Impl::end(Session& session) {
+    stdx::lock_guard<stdx::mutex> lk(_connectionsMutex);
+    auto conn = _connections.find(session.id());
+    if (conn != _connections.end()) {
+        _endSession_inlock(conn);
+    }
+}
+
+void TransportLayerASIO::Impl::registerTags(const Session& session) {
+    stdx::lock_guard<stdx::mutex> lk(_connectionsMutex);
+    auto conn = _connections.find(session.id());
+    if (conn != _connections.end()) {
+        conn->second.tags = session.getTags();
+    }
+}
+
+void TransportLayerASIO::Impl::_endSession_inlock(ConnectionMap::iterator conn) {
+    if (conn->second.ended) {
+        return;
+    }
+    conn->second.ended = true;
+    shutdownSocket(conn->second.socket.get());
+    Listener::globalTicketHolder.release();
+}
+
+void TransportLayerASIO::Impl::endAllSessions(Session::TagMask tags) {
+    log() << "asio transport layer ending all sessions";
+    stdx::lock_guard<stdx::mutex> lk(_connectionsMutex);
+    for (auto conn = _connections.begin(); conn != _connections.end(); ++conn) {
+        if (conn->second.tags & tags) {
+            log() << "Skip closing connection for connection # " << conn->first;
+        } else {
+            _endSession_inlock(conn);
+        }
+    }
+}
+
+void TransportLayerASIO::Impl::shutdown() {
+    if (!_running.swap(false)) {
+        return;
+    }
+
+    // Acceptors may only be used from one thread at a time, so close them on a network thread.
+    _ioService.post([this] {
+        for (auto& acceptor : _acceptors) {
+            std::error_code ec;
+            acceptor->close(ec);
+        }
+    });
+
+    endAllSessions(Session::kEmptyTagMask);
+
+    // Every socket is shut down, so the pending operations complete with errors and the network
+    // threads return once their callbacks have run.
+    _work.reset();
+    for (auto& thread : _networkThreads) {
+        thread.join();
+    }
+}
+
+void TransportLayerASIO::Impl::destroy(Session& session) {
+    stdx::lock_guard<stdx::mutex> lk(_connectionsMutex);
+    auto conn = _connections.find(session.id());
+
+    invariant(conn != _connections.end());
+    _endSession_inlock(conn);
+    _connections.erase(conn);
+}
+
+StatusWith<std::shared_ptr<TransportLayerASIO::Impl::Socket>> TransportLayerASIO::Impl::_getSocket(
+    const Ticket& ticket) {
+    if (!_running.load()) {
+        return TransportLayer::ShutdownStatus;
+    }
+
+    if (ticket.expiration() < Date_t::now()) {
+        return Ticket::ExpiredStatus;
+    }
+
+    stdx::lock_guard<stdx::mutex> lk(_connectionsMutex);
+
+    // Error if we cannot find the session.
+    auto conn = _connections.find(ticket.sessionId());
+    if (conn == _connections.end()) {
+        return TransportLayer::TicketSessionUnknownStatus;
+    }
+
+    // Error if we find the session but its connection is closed.
+    if (conn->second.ended) {
+        return TransportLayer::TicketSessionClosedStatus;
+    }
+
+    return conn->second.socket;
+}
+
+void TransportLayerASIO::Impl::_acceptConnection(asio::ip::tcp::acceptor* acceptor) {
+    auto socket = std::make_shared<Socket>(_ioService);
+    acceptor->async_accept(*socket, [this, acceptor, socket](const std::error_code& ec) {
+        if (!_running.load() || ec == asio::error::operation_aborted) {
+            return;
+        }
+
+        if (ec) {
+            // The acceptor may be closed by now, so don't let finding its address throw.
+            std::error_code endpointEc;
+            const auto endpoint = acceptor->local_endpoint(endpointEc);
+            log() << "Error accepting new connection on "
+                  << (endpointEc ? std::string("a closed listener")
+                                 : endpointToHostAndPort(endpoint).toString())
+                  << ": " << ec.message();
+        } else {
+            _handleNewConnection(std::move(socket));
+        }
+
+        _acceptConnection(acceptor);
+    });
+}
+
+void TransportLayerASIO::Impl::_handleNewConnection(std::shared_ptr<Socket> socket) {
+    std::error_code ec;
+    const auto remote = socket->remote_endpoint(ec);
+    const auto local = socket->local_endpoint(ec);
+    if (ec) {
+        // The client already went away.
+        return;
+    }
+
+    if (!Listener::globalTicketHolder.tryAcquire()) {
+        log() << "connection refused because too many open connections: "
+              << Listener::globalTicketHolder.used();
+        return;
+    }
+
+    socket->set_option(asio::ip::tcp::no_delay(true), ec);
+    socket->set_option(asio::socket_base::keep_alive(true), ec);
+
+    Session session(endpointToHostAndPort(remote), endpointToHostAndPort(local), _tl);
+    Listener::globalConnectionNumber.addAndFetch(1);
+
+    size_t openSessions;
+    {
+        stdx::lock_guard<stdx::mutex> lk(_connectionsMutex);
+        _connections.emplace(std::piecewise_construct,
+                             std::forward_as_tuple(session.id()),
+                             std::forward_as_tuple(std::move(socket), session.getTags()));
+        openSessions = _connections.size();
+    }
+
+    if (!serverGlobalParams.quiet) {
+        const char* word = (openSessions == 1 ? " connection" : " connections");
+        log() << "connection accepted from " << session.remote() << " #" << session.id() << " ("
+              << openSessions << word << " now open)";
+    }
+
+    invariant(_sep);
+    _sep->startSession(std::move(session));
+}
+
+}  // namespace transport
+}  // namespace mongo
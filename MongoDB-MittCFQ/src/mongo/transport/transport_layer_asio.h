@@ -0,0 +1,109 @@
+/**
+ *    Copyright (C) 2016 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "mongo/base/disallow_copying.h"
+#include "mongo/transport/transport_layer.h"
+
+namespace mongo {
+
+class ServiceEntryPoint;
+
+namespace transport {
+
+/**
+ * A TransportLayer that multiplexes all client connections over a small, fixed pool of network
+ * threads running an asio::io_service.
+ *
+ * Sessions are read with asyncWait(), which completes on a network thread once a whole message
+ * has arrived, so a connection waiting for its next request holds no thread at all. wait() is
+ * supported too, for service entry points that still run a thread per session.
+ *
+ * Only TCP is supported; SSL and unix domain sockets need TransportLayerLegacy.
+ */
+class TransportLayerASIO final : public TransportLayer {
+    MONGO_DISALLOW_COPYING(TransportLayerASIO);
+
+public:
+    struct Options {
+        int port = 0;            // port to bind to
+        std::string ipList;      // addresses to bind to
+        int networkThreads = 2;  // threads running the io_service
+    };
+
+    TransportLayerASIO(const Options& opts, ServiceEntryPoint* sep);
+
+    ~TransportLayerASIO();
+
+    Status setup();
+    Status start() override;
+
+    /**
+     * Returns the port the first listening socket is bound to, which is the one the kernel picked
+     * if Options::port was 0. Only valid after a successful setup().
+     */
+    int listenerPort() const;
+
+    Ticket sourceMessage(Session& session,
+                         Message* message,
+                         Date_t expiration = Ticket::kNoExpirationDate) override;
+
+    Ticket sinkMessage(Session& session,
+                       const Message& message,
+                       Date_t expiration = Ticket::kNoExpirationDate) override;
+
+    Status wait(Ticket&& ticket) override;
+    void asyncWait(Ticket&& ticket, TicketCallback callback) override;
+
+    void registerTags(const Session& session) override;
+    SSLPeerInfo getX509PeerInfo(const Session& session) const override;
+
+    Stats sessionStats() override;
+
+    void end(Session& session) override;
+    void endAllSessions(transport::Session::TagMask tags) override;
+
+    void shutdown() override;
+
+private:
+    class ASIOTicket;
+    class Impl;
+
+    void _destroy(Session& session) override;
+
+    // Holds the io_service, its threads, the acceptors and the open connections, so that users of
+    // this header do not need asio.
+    std::unique_ptr<Impl> _impl;
+};
+
+}  // namespace transport
+}  // namespace mongo
@@ -0,0 +1,233 @@
+/**
+ *    Copyright (C) 2016 MongoDB Inc.
+ *
+ *    This program is free software: you can redistribute it and/or  modify
+ *    it under the terms of the GNU Affero General Public License, version 3,
+ *    as published by the Free Software Foundation.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU Affero General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Affero General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the GNU Affero General Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/transport/transport_layer_asio.h"
+
+#include <asio.hpp>
+#include <vector>
+
+#include "mongo/base/status.h"
+#include "mongo/bson/util/builder.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/memory.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/transport/service_entry_point.h"
+#include "mongo/transport/session.h"
+#include "mongo/transport/ticket.h"
+#include "mongo/unittest/unittest.h"
+#include "mongo/util/concurrency/notification.h"
+#include "mongo/util/net/message.h"
+
+namespace mongo {
+namespace transport {
+namespace {
+
+/**
+ * Keeps every session it is given, so that the test can drive them.
+ */
+class ServiceEntryPointStub : public ServiceEntryPoint {
+public:
+    void startSession(Session&& session) override {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        _sessions.push_back(stdx::make_unique<Session>(std::move(session)));
+        _sessionAdded.notify_all();
+    }
+
+    Session* waitForSession() {
+        stdx::unique_lock<stdx::mutex> lk(_mutex);
+        _sessionAdded.wait(lk, [&] { return !_sessions.empty(); });
+        return _sessions.front().get();
+    }
+
+    void clear() {
+        stdx::lock_guard<stdx::mutex> lk(_mutex);
+        _sessions.clear();
+    }
+
+private:
+    stdx::mutex _mutex;
+    stdx::condition_variable _sessionAdded;
+    std::vector<std::unique_ptr<Session>> _sessions;
+};
+
+Message makeMessage(int32_t id, const char* text) {
+    BufBuilder b;
+    b.skip(sizeof(MSGHEADER::Value));
+    b.appendStr(text);
+
+    MsgData::View header(b.buf());
+    header.setLen(b.len());
+    header.setId(id);
+    header.setResponseToMsgId(0);
+    header.setOperation(dbQuery);
+
+    Message message;
+    message.setData(b.release());
+    return message;
+}
+
+class TransportLayerASIOTest : public mongo::unittest::Test {
+public:
+    void setUp() override {
+        TransportLayerASIO::Options options;
+        options.ipList = "127.0.0.1";
+        options.port = 0;
+        options.networkThreads = 2;
+        _tl = stdx::make_unique<TransportLayerASIO>(options, &_sep);
+        ASSERT_OK(_tl->setup());
+        ASSERT_OK(_tl->start());
+    }
+
+    void tearDown() override {
+        _client.reset();
+        _tl->shutdown();
+
+        // Sessions unregister themselves from the transport layer, so they must go first.
+        _sep.clear();
+        _tl.reset();
+    }
+
+    TransportLayerASIO* tl() {
+        return _tl.get();
+    }
+
+    /**
+     * Connects a client to the transport layer and returns the server side of the connection.
+     */
+    Session* connect() {
+        _client = stdx::make_unique<asio::ip::tcp::socket>(_clientService);
+        _client->connect(asio::ip::tcp::endpoint(asio::ip::address::from_string("127.0.0.1"),
+                                                 _tl->listenerPort()));
+        return _sep.waitForSession();
+    }
+
+    void clientWrite(const void* data, size_t len) {
+        asio::write(*_client, asio::buffer(data, len));
+    }
+
+    void clientSend(const Message& message) {
+        clientWrite(message.buf(), message.size());
+    }
+
+    std::string clientReceiveText() {
+        MSGHEADER::Value header;
+        asio::read(*_client, asio::buffer(&header, sizeof(header)));
+        const int len = header.constView().getMessageLength();
+        ASSERT_GREATER_THAN(len, static_cast<int>(sizeof(header)));
+
+        std::vector<char> body(len - sizeof(header));
+        asio::read(*_client, asio::buffer(body.data(), body.size()));
+        return std::string(body.data());
+    }
+
+private:
+    ServiceEntryPointStub _sep;
+    std::unique_ptr<TransportLayerASIO> _tl;
+
+    asio::io_service _clientService;
+    std::unique_ptr<asio::ip::tcp::socket> _client;
+};
+
+TEST_F(TransportLayerASIOTest, ListensOnAPickedPort) {
+    ASSERT_GREATER_THAN(tl()->listenerPort(), 0);
+}
+
+TEST_F(TransportLayerASIOTest, SourceAndSinkWithWait) {
+    Session* session = connect();
+
+    clientSend(makeMessage(1, "ping"));
+    Message request;
+    ASSERT_OK(session->sourceMessage(&request).wait());
+    ASSERT_EQUALS(request.header().getId(), 1);
+    ASSERT_EQUALS(std::string(request.singleData().data()), "ping");
+
+    Message response = makeMessage(2, "pong");
+    response.header().setResponseToMsgId(request.header().getId());
+    ASSERT_OK(session->sinkMessage(response).wait());
+    ASSERT_EQUALS(clientReceiveText(), "pong");
+}
+
+TEST_F(TransportLayerASIOTest, SourceAndSinkWithAsyncWait) {
+    Session* session = connect();
+
+    // Start waiting before the message is sent, as a service entry point does between requests.
+    Message request;
+    Notification<Status> sourced;
+    tl()->asyncWait(session->sourceMessage(&request),
+                    [&](Status status) { sourced.set(status); });
+    clientSend(makeMessage(1, "ping"));
+    ASSERT_OK(sourced.get());
+    ASSERT_EQUALS(std::string(request.singleData().data()), "ping");
+
+    Message response = makeMessage(2, "pong");
+    Notification<Status> sunk;
+    tl()->asyncWait(session->sinkMessage(response), [&](Status status) { sunk.set(status); });
+    ASSERT_OK(sunk.get());
+    ASSERT_EQUALS(clientReceiveText(), "pong");
+}
+
+TEST_F(TransportLayerASIOTest, InvalidMessageLengthIsAProtocolError) {
+    Session* session = connect();
+
+    MSGHEADER::Value header;
+    header.view().setMessageLength(3);
+    header.view().setRequestMsgId(1);
+    header.view().setResponseToMsgId(0);
+    header.view().setOpCode(dbQuery);
+    clientWrite(&header, sizeof(header));
+
+    Message request;
+    ASSERT_EQUALS(session->sourceMessage(&request).wait().code(), ErrorCodes::ProtocolError);
+}
+
+TEST_F(TransportLayerASIOTest, EndFailsPendingAsyncSource) {
+    Session* session = connect();
+
+    Message request;
+    Notification<Status> sourced;
+    tl()->asyncWait(session->sourceMessage(&request),
+                    [&](Status status) { sourced.set(status); });
+
+    tl()->end(*session);
+    ASSERT_NOT_OK(sourced.get());
+
+    ASSERT_EQUALS(session->sourceMessage(&request).wait(),
+                  TransportLayer::TicketSessionClosedStatus);
+}
+
+TEST_F(TransportLayerASIOTest, SessionStatsCountOpenSessions) {
+    ASSERT_EQUALS(tl()->sessionStats().numOpenSessions, 0U);
+    connect();
+    ASSERT_EQUALS(tl()->sessionStats().numOpenSessions, 1U);
+}
+
+}  // namespace
+}  // namespace transport
+}  // namespace mongo
@@ -168,6 +168,10 @@ const char* const kDiskFields[] = {
 
 const size_t kDiskFieldCount = std::extent<decltype(kDiskFields)>::value;
 
+const char* const kMittCFQFields[] = {
+    "mitt_admitted", "mitt_rejected", "mitt_predicted_wait_us", "mitt_prediction_error_us",
+};
+
 }  // namespace
 
 namespace procparser {
@@ -542,6 +546,50 @@ Status parseProcDiskStatsFile(StringData filename,
     return parseProcDiskStats(disks, swString.getValue(), builder);
 }
 
+Status parseMittCFQStatsDirectory(StringData directory,
+                                  const std::vector<StringData>& disks,
+                                  BSONObjBuilder* builder) {
+    bool foundKeys = false;
+
+    for (const auto& disk : disks) {
+        const std::string ioschedPath = str::stream() << directory << "/" << disk
+                                                      << "/queue/iosched/";
+
+        // The counters come and go with the scheduler, which can be switched at runtime.
+        boost::system::error_code ec;
+        if (!boost::filesystem::exists(ioschedPath + kMittCFQFields[0], ec)) {
+            continue;
+        }
+
+        BSONObjBuilder sub(builder->subobjStart(disk));
+
+        for (const char* field : kMittCFQFields) {
+            auto swString = readFileAsString(ioschedPath + field);
+            if (!swString.isOK()) {
+                continue;
+            }
+
+            // Each file holds a single decimal number, usually followed by a newline.
+            const std::string& contents = swString.getValue();
+            StringData stringValue(
+                contents.c_str(),
+                std::min(contents.find_first_not_of("-0123456789"), contents.size()));
+
+            long long value;
+            if (parseNumberFromString(stringValue, &value).isOK()) {
+                sub.appendNumber(field, value);
+            }
+        }
+
+        sub.doneFast();
+        foundKeys = true;
+    }
+
+    return foundKeys
+        ? Status::OK()
+        : Status(ErrorCodes::NoSuchKey, "Failed to find MittCFQ counters for any disk");
+}
+
 namespace {
 
 /**
@@ -109,6 +109,21 @@ Status parseProcDiskStatsFile(StringData filename,
                               const std::vector<StringData>& disks,
                               BSONObjBuilder* builder);
 
+/**
+ * Read the MittCFQ admission counters that the patched cfq scheduler exposes as
+ * <directory>/<disk>/queue/iosched/mitt_*, and write one document per disk in builder.
+ *
+ * Disks whose scheduler does not expose the counters (a stock kernel, or a scheduler other than
+ * cfq) are skipped.
+ *
+ * directory - path to the block device directory, normally /sys/block
+ * disks - list of disks to read counters for
+ * builder - BSON output
+ */
+Status parseMittCFQStatsDirectory(StringData directory,
+                                  const std::vector<StringData>& disks,
+                                  BSONObjBuilder* builder);
+
 /**
  * Get a vector of disks to monitor by enumerating the specified directory.
  *
@@ -33,10 +33,12 @@
 #include "mongo/util/procparser.h"
 
 #include <boost/filesystem.hpp>
+#include <fstream>
 #include <map>
 
 #include "mongo/bson/bsonobj.h"
 #include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/unittest/temp_dir.h"
 #include "mongo/unittest/unittest.h"
 #include "mongo/util/log.h"
 
@@ -506,5 +508,50 @@ TEST(FTDCProcDiskStats, TestLocalDiskStats) {
     }
 }
 
+void writeSysfsFile(const boost::filesystem::path& path, StringData contents) {
+    std::ofstream out(path.string());
+    out << contents;
+}
+
+TEST(FTDCProcMittCFQ, TestMittCFQStats) {
+    unittest::TempDir sysBlock("procparser_test_sys_block");
+
+    // sda runs the patched cfq scheduler, sdb a scheduler without the counters.
+    boost::filesystem::path sdaIosched(sysBlock.path());
+    sdaIosched /= "sda/queue/iosched";
+    boost::filesystem::create_directories(sdaIosched);
+    writeSysfsFile(sdaIosched / "mitt_admitted", "1234\n");
+    writeSysfsFile(sdaIosched / "mitt_rejected", "56\n");
+    writeSysfsFile(sdaIosched / "mitt_predicted_wait_us", "7\n");
+    // A value without the trailing newline is read to the end of the file.
+    writeSysfsFile(sdaIosched / "mitt_prediction_error_us", "890");
+
+    boost::filesystem::path sdbIosched(sysBlock.path());
+    sdbIosched /= "sdb/queue/iosched";
+    boost::filesystem::create_directories(sdbIosched);
+    writeSysfsFile(sdbIosched / "quantum", "8\n");
+
+    {
+        std::vector<StringData> disks{"sda", "sdb", "sdc"};
+        BSONObjBuilder builder;
+        ASSERT_OK(procparser::parseMittCFQStatsDirectory(sysBlock.path(), disks, &builder));
+
+        BSONObj obj = builder.obj();
+        auto stringMap = toNestedStringMap(obj);
+        ASSERT_KEY_AND_VALUE("sda.mitt_admitted", 1234UL);
+        ASSERT_KEY_AND_VALUE("sda.mitt_rejected", 56UL);
+        ASSERT_KEY_AND_VALUE("sda.mitt_predicted_wait_us", 7UL);
+        ASSERT_KEY_AND_VALUE("sda.mitt_prediction_error_us", 890UL);
+        ASSERT_FALSE(obj.hasField("sdb"));
+        ASSERT_FALSE(obj.hasField("sdc"));
+    }
+
+    {
+        std::vector<StringData> disks{"sdb"};
+        BSONObjBuilder builder;
+        ASSERT_NOT_OK(procparser::parseMittCFQStatsDirectory(sysBlock.path(), disks, &builder));
+    }
+}
+
 }  // namespace
 }  // namespace mongo
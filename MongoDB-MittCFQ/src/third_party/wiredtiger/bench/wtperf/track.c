@@ -93,6 +93,11 @@ sum_insert_ops(CONFIG *cfg)
 	return (sum_ops(cfg, offsetof(CONFIG_THREAD, insert)));
 }
 uint64_t
+sum_read_busy_ops(CONFIG *cfg)
+{
+	return (sum_ops(cfg, offsetof(CONFIG_THREAD, read_busy)));
+}
+uint64_t
 sum_read_ops(CONFIG *cfg)
 {
 	return (sum_ops(cfg, offsetof(CONFIG_THREAD, read)));
@@ -266,6 +271,11 @@ sum_read_latency(CONFIG *cfg, TRACK *total)
 	sum_latency(cfg, offsetof(CONFIG_THREAD, read), total);
 }
 static void
+sum_read_busy_latency(CONFIG *cfg, TRACK *total)
+{
+	sum_latency(cfg, offsetof(CONFIG_THREAD, read_busy), total);
+}
+static void
 sum_update_latency(CONFIG *cfg, TRACK *total)
 {
 	sum_latency(cfg, offsetof(CONFIG_THREAD, update), total);
@@ -316,6 +326,59 @@ latency_print_single(CONFIG *cfg, TRACK *total, const char *name)
 	(void)fclose(fp);
 }
 
+/*
+ * latency_percentile --
+ *	Return the latency in usecs below which the given share of operations,
+ * in hundredths of a percent, completed.  The histogram buckets round up, the
+ * same way latency_print_single reports them.
+ */
+static uint64_t
+latency_percentile(TRACK *total, uint64_t pct)
+{
+	uint64_t cumops, target;
+	u_int i;
+
+	target = (total->ops * pct + 9999) / 10000;
+	if (target == 0)
+		target = 1;
+
+	cumops = 0;
+	for (i = 0; i < ELEMENTS(total->us); ++i)
+		if ((cumops += total->us[i]) >= target)
+			return (i + 1);
+	for (i = 1; i < ELEMENTS(total->ms); ++i)
+		if ((cumops += total->ms[i]) >= target)
+			return (ms_to_us(i + 1));
+	for (i = 1; i < ELEMENTS(total->sec); ++i)
+		if ((cumops += total->sec[i]) >= target)
+			return (sec_to_us(i + 1));
+	return (sec_to_us(ELEMENTS(total->sec)));
+}
+
+/*
+ * latency_print_percentiles --
+ *	Log the latency percentiles of an operation.
+ */
+static void
+latency_print_percentiles(CONFIG *cfg, TRACK *total, const char *name)
+{
+	if (total->ops == 0) {
+		lprintf(cfg, 0, 1, "%s latency: no operations", name);
+		return;
+	}
+	lprintf(cfg, 0, 1,
+	    "%s latency (usecs) over %" PRIu64 " operations: 50%%=%" PRIu64
+	    " 90%%=%" PRIu64 " 99%%=%" PRIu64 " 99.9%%=%" PRIu64
+	    " 99.99%%=%" PRIu64 " max=%" PRIu64,
+	    name, total->ops,
+	    latency_percentile(total, 5000),
+	    latency_percentile(total, 9000),
+	    latency_percentile(total, 9900),
+	    latency_percentile(total, 9990),
+	    latency_percentile(total, 9999),
+	    latency_percentile(total, 10000));
+}
+
 void
 latency_print(CONFIG *cfg)
 {
@@ -325,6 +388,19 @@ latency_print(CONFIG *cfg)
 	latency_print_single(cfg, &total, "insert");
 	sum_read_latency(cfg, &total);
 	latency_print_single(cfg, &total, "read");
+	if (cfg->read_deadline != 0)
+		latency_print_percentiles(cfg, &total, "Admitted read");
 	sum_update_latency(cfg, &total);
 	latency_print_single(cfg, &total, "update");
+
+	/*
+	 * With deadline reads, every read is timed: report the reads rejected
+	 * as busy next to the admitted ones, a rejection is only useful if
+	 * it comes back well before the deadline.
+	 */
+	if (cfg->read_deadline != 0) {
+		sum_read_busy_latency(cfg, &total);
+		latency_print_single(cfg, &total, "read_busy");
+		latency_print_percentiles(cfg, &total, "Rejected read");
+	}
 }
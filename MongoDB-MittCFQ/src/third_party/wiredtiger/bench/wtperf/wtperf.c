@@ -62,6 +62,7 @@ static const CONFIG default_cfg = {
 	0,				/* notify threads to stop */
 	0,				/* in warmup phase */
 	false,				/* Signal for idle cycle thread */
+	NULL,				/* background I/O noise */
 	0,				/* total seconds running */
 	0,				/* flags */
 	{NULL, NULL},			/* the truncate queue */
@@ -646,6 +647,13 @@ worker(void *arg)
 		measure_latency =
 		    cfg->sample_interval != 0 && trk != NULL &&
 		    trk->ops != 0 && (trk->ops % cfg->sample_rate == 0);
+
+		/*
+		 * Deadline reads are reported in percentiles split between
+		 * admitted and rejected reads, time every one of them.
+		 */
+		if (*op == WORKER_READ && cfg->read_deadline != 0)
+			measure_latency = 1;
 		if (measure_latency && (ret = __wt_epoch(NULL, &start)) != 0) {
 			lprintf(cfg, ret, 0, "Get time call failed");
 			goto err;
@@ -662,7 +670,28 @@ worker(void *arg)
 			 * finished the actual insert.  Count failed search in
 			 * a random range as a "read".
 			 */
-			ret = cursor->search(cursor);
+			if (cfg->read_deadline != 0) {
+				if ((ret = session->set_read_deadline(session,
+				    (int64_t)cfg->read_deadline)) != 0) {
+					lprintf(cfg, ret, 0,
+					    "set_read_deadline in read.");
+					goto err;
+				}
+				ret = cursor->search(cursor);
+				(void)session->set_read_deadline(session, -1);
+
+				/*
+				 * The storage was too busy to meet the
+				 * deadline: the read is rejected, not failed,
+				 * track it separately.
+				 */
+				if (ret == WT_READ_BUSY) {
+					trk = &thread->read_busy;
+					ret = 0;
+					break;
+				}
+			} else
+				ret = cursor->search(cursor);
 			if (ret == 0) {
 				if ((ret = cursor->get_value(
 				    cursor, &value)) != 0) {
@@ -1699,6 +1728,13 @@ execute_workload(CONFIG *cfg)
 	if ((ret = start_idle_table_cycle(cfg, &idle_table_cycle_thread)) != 0)
 		return (ret);
 
+	/* Start the background I/O noise. */
+	if ((ret = start_noise(cfg)) != 0) {
+		(void)stop_noise(cfg);
+		(void)stop_idle_table_cycle(cfg, idle_table_cycle_thread);
+		return (ret);
+	}
+
 	if (cfg->warmup != 0)
 		cfg->in_warmup = 1;
 
@@ -1814,6 +1850,9 @@ err:	cfg->stop = 1;
 	    cfg, (u_int)cfg->workers_cnt, cfg->workers)) != 0 && ret == 0)
 		ret = t_ret;
 
+	if ((t_ret = stop_noise(cfg)) != 0 && ret == 0)
+		ret = t_ret;
+
 	/* Drop tables if configured to and this isn't an error path */
 	if (ret == 0 && cfg->drop_tables && (ret = drop_all_tables(cfg)) != 0)
 		lprintf(cfg, ret, 0, "Drop tables failed.");
@@ -2066,7 +2105,7 @@ static int
 start_run(CONFIG *cfg)
 {
 	pthread_t monitor_thread;
-	uint64_t total_ops;
+	uint64_t read_busy_ops, total_ops;
 	uint32_t run_time;
 	int monitor_created, ret, t_ret;
 
@@ -2135,11 +2174,13 @@ start_run(CONFIG *cfg)
 
 		/* One final summation of the operations we've completed. */
 		cfg->read_ops = sum_read_ops(cfg);
+		read_busy_ops = sum_read_busy_ops(cfg);
 		cfg->insert_ops = sum_insert_ops(cfg);
 		cfg->truncate_ops = sum_truncate_ops(cfg);
 		cfg->update_ops = sum_update_ops(cfg);
 		cfg->ckpt_ops = sum_ckpt_ops(cfg);
-		total_ops = cfg->read_ops + cfg->insert_ops + cfg->update_ops;
+		total_ops = cfg->read_ops + read_busy_ops +
+		    cfg->insert_ops + cfg->update_ops;
 
 		run_time = cfg->run_time == 0 ? 1 : cfg->run_time;
 		lprintf(cfg, 0, 1,
@@ -2147,6 +2188,12 @@ start_run(CONFIG *cfg)
 		    "%%) %" PRIu64 " ops/sec",
 		    cfg->read_ops, (cfg->read_ops * 100) / total_ops,
 		    cfg->read_ops / run_time);
+		if (cfg->read_deadline != 0)
+			lprintf(cfg, 0, 1,
+			    "Rejected %" PRIu64 " busy read operations (%"
+			    PRIu64 "%%) %" PRIu64 " ops/sec",
+			    read_busy_ops, (read_busy_ops * 100) / total_ops,
+			    read_busy_ops / run_time);
 		lprintf(cfg, 0, 1,
 		    "Executed %" PRIu64 " insert operations (%" PRIu64
 		    "%%) %" PRIu64 " ops/sec",
@@ -2528,6 +2575,7 @@ start_threads(CONFIG *cfg,
 		 */
 		thread->ckpt.min_latency =
 		thread->insert.min_latency = thread->read.min_latency =
+		thread->read_busy.min_latency =
 		thread->update.min_latency = UINT32_MAX;
 		thread->ckpt.max_latency = thread->insert.max_latency =
 		thread->read.max_latency = thread->update.max_latency = 0;
@@ -38,6 +38,7 @@
 
 typedef struct __config CONFIG;
 typedef struct __config_thread CONFIG_THREAD;
+typedef struct __noise NOISE;
 typedef struct __truncate_queue_entry TRUNCATE_QUEUE_ENTRY;
 
 #define	EXT_PFX	",extensions=("
@@ -161,6 +162,8 @@ struct __config {			/* Configuration structure */
 
 	volatile bool idle_cycle_run;	/* Signal for idle cycle thread */
 
+	NOISE *noise;			/* Background I/O noise */
+
 	volatile uint32_t totalsec;	/* total seconds running */
 
 #define	CFG_GROW	0x0001		/* There is a grow workload */
@@ -255,6 +258,7 @@ struct __config_thread {		/* Per-thread structure */
 	TRACK ckpt;			/* Checkpoint operations */
 	TRACK insert;			/* Insert operations */
 	TRACK read;			/* Read operations */
+	TRACK read_busy;		/* Read operations rejected busy */
 	TRACK update;			/* Update operations */
 	TRACK truncate;			/* Truncate operations */
 	TRACK truncate_sleep;		/* Truncate sleep operations */
@@ -281,10 +285,13 @@ int	 setup_log_file(CONFIG *);
 void	 setup_throttle(CONFIG_THREAD*);
 int	 setup_truncate(CONFIG *, CONFIG_THREAD *, WT_SESSION *);
 int	 start_idle_table_cycle(CONFIG *, pthread_t *);
+int	 start_noise(CONFIG *);
 int	 stop_idle_table_cycle(CONFIG *, pthread_t);
+int	 stop_noise(CONFIG *);
 uint64_t sum_ckpt_ops(CONFIG *);
 uint64_t sum_insert_ops(CONFIG *);
 uint64_t sum_pop_ops(CONFIG *);
+uint64_t sum_read_busy_ops(CONFIG *);
 uint64_t sum_read_ops(CONFIG *);
 uint64_t sum_truncate_ops(CONFIG *);
 uint64_t sum_update_ops(CONFIG *);
@@ -0,0 +1,514 @@
+/*-
+ * Public Domain 2014-2016 MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "wtperf.h"
+
+/*
+ * Background I/O noise: threads doing direct I/O to a file or device while
+ * the workload runs, so reads bounded by a deadline meet a busy device.  The
+ * noise follows a profile in the format of the cluster noise injector: each
+ * period of the profile has an intensity, the number of noise threads doing
+ * I/O during that period, each keeping one I/O outstanding.  The profile
+ * loops, aligned to the wall clock.  Without a profile, every noise thread
+ * does I/O all the time.
+ */
+
+#define	NOISE_ALIGN		4096		/* Direct I/O alignment */
+#define	NOISE_FILE		"noise.img"	/* Default target */
+
+struct __noise {
+	CONFIG *cfg;
+
+	char	*target;		/* File or block device */
+	int	 fd;
+	bool	 direct;		/* Opened for direct I/O */
+
+	uint64_t period_us;		/* Profile period */
+	uint32_t *intensity;		/* Threads doing I/O in each period */
+	u_int	 intensity_cnt;
+
+	uint32_t io_size;		/* Bytes per I/O */
+	uint32_t read_pct;		/* Percentage of reads */
+	uint64_t span;			/* Bytes of the target used */
+
+	pthread_t *threads;
+	u_int	 thread_cnt;
+	u_int	 thread_started;
+	volatile bool run;		/* Signal for noise threads */
+
+	struct timespec start;
+	uint64_t ops;			/* I/Os done */
+	uint64_t bytes;			/* Bytes transferred */
+};
+
+typedef struct {
+	NOISE *noise;
+	u_int id;
+} NOISE_THREAD;
+
+/*
+ * noise_profile --
+ *	Read a noise profile.
+ */
+static int
+noise_profile(CONFIG *cfg, NOISE *noise, const char *path)
+{
+	FILE *fp;
+	uint64_t value;
+	u_int alloc;
+	int c, ret;
+	bool in_intensity;
+	char key[64], target[1024];
+
+	if ((fp = fopen(path, "r")) == NULL) {
+		ret = errno;
+		lprintf(cfg, ret, 0, "noise_profile: %s", path);
+		return (ret);
+	}
+
+	ret = 0;
+	alloc = 0;
+	in_intensity = false;
+	for (;;) {
+		/* Skip white space and comments. */
+		while ((c = fgetc(fp)) != EOF && isspace(c))
+			;
+		if (c == EOF)
+			break;
+		if (c == '#') {
+			while ((c = fgetc(fp)) != EOF && c != '\n')
+				;
+			continue;
+		}
+		(void)ungetc(c, fp);
+
+		if (in_intensity) {
+			if (fscanf(fp, "%" SCNu64, &value) != 1)
+				goto format;
+			if (noise->intensity_cnt == alloc) {
+				alloc = alloc == 0 ? 1024 : alloc * 2;
+				noise->intensity = drealloc(noise->intensity,
+				    alloc * sizeof(*noise->intensity));
+			}
+			noise->intensity[noise->intensity_cnt++] =
+			    (uint32_t)value;
+			continue;
+		}
+
+		if (fscanf(fp, "%63s", key) != 1)
+			goto format;
+		if (strcmp(key, "intensity") == 0) {
+			in_intensity = true;
+			continue;
+		}
+		if (strcmp(key, "target") == 0) {
+			if (fscanf(fp, "%1023s", target) != 1)
+				goto format;
+			free(noise->target);
+			noise->target = dstrdup(target);
+			continue;
+		}
+		if (fscanf(fp, "%" SCNu64, &value) != 1)
+			goto format;
+		if (strcmp(key, "period_us") == 0)
+			noise->period_us = value;
+		else if (strcmp(key, "io_size") == 0)
+			noise->io_size = (uint32_t)value;
+		else if (strcmp(key, "read_pct") == 0)
+			noise->read_pct = (uint32_t)value;
+		else if (strcmp(key, "span") == 0)
+			noise->span = value;
+		else {
+			lprintf(cfg, EINVAL, 0,
+			    "noise_profile: %s: unknown keyword %s", path, key);
+			ret = EINVAL;
+			break;
+		}
+	}
+
+	if (ret == 0 && (noise->period_us == 0 || noise->intensity_cnt == 0)) {
+		lprintf(cfg, EINVAL, 0,
+		    "noise_profile: %s: no period_us or intensity values",
+		    path);
+		ret = EINVAL;
+	}
+
+	if (0) {
+format:		lprintf(cfg, EINVAL, 0,
+		    "noise_profile: %s: badly formatted profile", path);
+		ret = EINVAL;
+	}
+	(void)fclose(fp);
+	return (ret);
+}
+
+/*
+ * noise_fill --
+ *	Extend the default noise file to the span, noise reads of a hole
+ * wouldn't go to the device.
+ */
+static int
+noise_fill(CONFIG *cfg, NOISE *noise, uint8_t *buf)
+{
+	struct stat sb;
+	wt_off_t offset;
+	ssize_t n;
+	int fd, ret;
+
+	if ((fd = open(noise->target, O_CREAT | O_WRONLY, 0666)) == -1) {
+		ret = errno;
+		lprintf(cfg, ret, 0, "noise: %s", noise->target);
+		return (ret);
+	}
+	ret = 0;
+	if (fstat(fd, &sb) != 0) {
+		ret = errno;
+		goto err;
+	}
+	if ((uint64_t)sb.st_size >= noise->span)
+		goto err;
+
+	lprintf(cfg, 0, 1, "Filling %s to %" PRIu64 "MB for I/O noise",
+	    noise->target, noise->span / WT_MEGABYTE);
+	for (offset = sb.st_size - sb.st_size % noise->io_size;
+	    (uint64_t)offset < noise->span; offset += noise->io_size)
+		if ((n = pwrite(fd, buf, noise->io_size, offset)) !=
+		    (ssize_t)noise->io_size) {
+			ret = n == -1 ? errno : EIO;
+			goto err;
+		}
+	if (fsync(fd) != 0)
+		ret = errno;
+
+err:	if (ret != 0)
+		lprintf(cfg, ret, 0, "noise: %s", noise->target);
+	if (close(fd) != 0 && ret == 0)
+		ret = errno;
+	return (ret);
+}
+
+/*
+ * noise_open --
+ *	Open the noise target, for direct I/O if it's supported.
+ */
+static int
+noise_open(CONFIG *cfg, NOISE *noise)
+{
+	struct stat sb;
+	wt_off_t size;
+	int flags, ret;
+
+	flags = noise->read_pct < 100 ? O_RDWR : O_RDONLY;
+#ifdef O_DIRECT
+	if ((noise->fd = open(noise->target, flags | O_DIRECT)) != -1)
+		noise->direct = true;
+	else if (errno == EINVAL)
+#endif
+		noise->fd = open(noise->target, flags);
+	if (noise->fd == -1) {
+		ret = errno;
+		lprintf(cfg, ret, 0, "noise: %s", noise->target);
+		return (ret);
+	}
+	if (!noise->direct)
+		lprintf(cfg, 0, 1,
+		    "noise: %s: direct I/O not supported, noise I/O may be "
+		    "satisfied from the buffer cache", noise->target);
+
+	if (fstat(noise->fd, &sb) != 0) {
+		ret = errno;
+		lprintf(cfg, ret, 0, "noise: %s", noise->target);
+		return (ret);
+	}
+	if (S_ISBLK(sb.st_mode) && noise->read_pct < 100) {
+		lprintf(cfg, EINVAL, 0,
+		    "noise: %s: refusing to write to a block device",
+		    noise->target);
+		return (EINVAL);
+	}
+
+	/* Seeking to the end gives the size of block devices too. */
+	if ((size = lseek(noise->fd, 0, SEEK_END)) == -1) {
+		ret = errno;
+		lprintf(cfg, ret, 0, "noise: %s", noise->target);
+		return (ret);
+	}
+	if (noise->span == 0 || noise->span > (uint64_t)size)
+		noise->span = (uint64_t)size;
+	if (noise->span < noise->io_size) {
+		lprintf(cfg, EINVAL, 0,
+		    "noise: %s: smaller than noise_io_size", noise->target);
+		return (EINVAL);
+	}
+	return (0);
+}
+
+/*
+ * noise_active --
+ *	Return if a noise thread does I/O in the current period, and if not, the
+ * microseconds until the next period.
+ */
+static bool
+noise_active(NOISE *noise, u_int id, uint64_t *waitp)
+{
+	struct timespec now;
+	uint64_t now_us;
+
+	*waitp = 0;
+	if (noise->intensity == NULL || __wt_epoch(NULL, &now) != 0)
+		return (true);
+
+	now_us = (uint64_t)now.tv_sec * WT_MILLION +
+	    (uint64_t)now.tv_nsec / WT_THOUSAND;
+	if (id < noise->intensity[
+	    (now_us / noise->period_us) % noise->intensity_cnt])
+		return (true);
+	*waitp = noise->period_us - now_us % noise->period_us;
+	return (false);
+}
+
+/*
+ * noise_worker --
+ *	Do noise I/O while the thread is active in the profile.
+ */
+static void *
+noise_worker(void *arg)
+{
+	CONFIG *cfg;
+	NOISE *noise;
+	NOISE_THREAD *nt;
+	WT_RAND_STATE rnd;
+	wt_off_t offset;
+	ssize_t n;
+	uint64_t blocks, wait;
+	uint8_t *buf;
+	int ret;
+	bool is_read;
+
+	nt = arg;
+	noise = nt->noise;
+	cfg = noise->cfg;
+	buf = NULL;
+
+	if ((ret = __wt_random_init_seed(NULL, &rnd)) != 0) {
+		lprintf(cfg, ret, 0, "noise: random initialization");
+		goto err;
+	}
+	if ((ret = posix_memalign(
+	    (void **)&buf, NOISE_ALIGN, noise->io_size)) != 0) {
+		lprintf(cfg, ret, 0, "noise: buffer allocation");
+		goto err;
+	}
+	memset(buf, 'n', noise->io_size);
+
+	blocks = noise->span / noise->io_size;
+	while (noise->run) {
+		if (!noise_active(noise, nt->id, &wait)) {
+			__wt_sleep(0, wait);
+			continue;
+		}
+
+		offset = (wt_off_t)(((((uint64_t)__wt_random(&rnd) << 32) |
+		    __wt_random(&rnd)) % blocks) * noise->io_size);
+		is_read = __wt_random(&rnd) % 100 < noise->read_pct;
+		if (is_read)
+			n = pread(noise->fd, buf, noise->io_size, offset);
+		else
+			n = pwrite(noise->fd, buf, noise->io_size, offset);
+		if (n != (ssize_t)noise->io_size) {
+			ret = n == -1 ? errno : EIO;
+			lprintf(cfg, ret, 0, "noise: %s: %s failed",
+			    noise->target, is_read ? "read" : "write");
+			goto err;
+		}
+		(void)__wt_atomic_add64(&noise->ops, 1);
+		(void)__wt_atomic_add64(&noise->bytes, noise->io_size);
+	}
+
+	/* Notify our caller we failed and shut the system down. */
+	if (0) {
+err:		cfg->error = cfg->stop = 1;
+	}
+	free(buf);
+	free(nt);
+	return (NULL);
+}
+
+/*
+ * start_noise --
+ *	Start the background I/O noise threads, if configured.
+ */
+int
+start_noise(CONFIG *cfg)
+{
+	NOISE *noise;
+	NOISE_THREAD *nt;
+	size_t len;
+	uint32_t max;
+	uint8_t *buf;
+	u_int i;
+	int ret;
+	bool fill;
+
+	if (cfg->noise_threads == 0 && cfg->noise_profile[0] == '\0')
+		return (0);
+
+	cfg->noise = noise = dcalloc(1, sizeof(NOISE));
+	noise->cfg = cfg;
+	noise->fd = -1;
+	noise->io_size = cfg->noise_io_size;
+	noise->read_pct = cfg->noise_read_pct;
+	noise->span = (uint64_t)cfg->noise_span * WT_MEGABYTE;
+	noise->thread_cnt = cfg->noise_threads;
+	buf = NULL;
+
+	if (cfg->noise_profile[0] != '\0') {
+		if ((ret = noise_profile(cfg, noise, cfg->noise_profile)) != 0)
+			return (ret);
+		for (max = 0, i = 0; i < noise->intensity_cnt; ++i)
+			if (max < noise->intensity[i])
+				max = noise->intensity[i];
+		if (noise->thread_cnt == 0 || noise->thread_cnt > max)
+			noise->thread_cnt = max;
+	}
+	if (noise->io_size == 0 || noise->io_size % NOISE_ALIGN != 0 ||
+	    noise->read_pct > 100) {
+		lprintf(cfg, EINVAL, 0,
+		    "noise: the I/O size must be a non-zero multiple of %d and "
+		    "the read percentage at most 100", NOISE_ALIGN);
+		return (EINVAL);
+	}
+
+	/*
+	 * The target option wins over the profile's.  The default target is
+	 * a file in the home directory, on the same device as the database,
+	 * filled to the span.
+	 */
+	fill = false;
+	if (cfg->noise_target[0] != '\0') {
+		free(noise->target);
+		noise->target = dstrdup(cfg->noise_target);
+	} else if (noise->target == NULL) {
+		len = strlen(cfg->home) + strlen(NOISE_FILE) + 2;
+		noise->target = dmalloc(len);
+		snprintf(noise->target, len, "%s/%s", cfg->home, NOISE_FILE);
+		fill = true;
+	}
+	if (fill) {
+		if (noise->span == 0) {
+			lprintf(cfg, EINVAL, 0,
+			    "noise: noise_span is required for %s",
+			    noise->target);
+			return (EINVAL);
+		}
+		buf = dmalloc(noise->io_size);
+		memset(buf, 'n', noise->io_size);
+		ret = noise_fill(cfg, noise, buf);
+		free(buf);
+		if (ret != 0)
+			return (ret);
+	}
+	if ((ret = noise_open(cfg, noise)) != 0)
+		return (ret);
+
+	lprintf(cfg, 0, 1,
+	    "Starting %u noise thread(s): %s, %" PRIu32 "B I/Os, %" PRIu32
+	    "%% reads, over %" PRIu64 "MB%s",
+	    noise->thread_cnt, noise->target, noise->io_size, noise->read_pct,
+	    noise->span / WT_MEGABYTE,
+	    noise->intensity == NULL ? "" : ", following the noise profile");
+
+	if ((ret = __wt_epoch(NULL, &noise->start)) != 0) {
+		lprintf(cfg, ret, 0, "Get time call failed");
+		return (ret);
+	}
+	noise->run = true;
+	noise->threads = dcalloc(noise->thread_cnt, sizeof(pthread_t));
+	for (i = 0; i < noise->thread_cnt; ++i) {
+		nt = dcalloc(1, sizeof(NOISE_THREAD));
+		nt->noise = noise;
+		nt->id = i;
+		if ((ret = pthread_create(
+		    &noise->threads[i], NULL, noise_worker, nt)) != 0) {
+			lprintf(cfg, ret, 0, "Error creating noise thread");
+			free(nt);
+			return (ret);
+		}
+		++noise->thread_started;
+	}
+	return (0);
+}
+
+/*
+ * stop_noise --
+ *	Stop the background I/O noise threads and report the noise done.
+ */
+int
+stop_noise(CONFIG *cfg)
+{
+	struct timespec stop;
+	NOISE *noise;
+	uint64_t secs;
+	u_int i;
+	int ret, t_ret;
+
+	if ((noise = cfg->noise) == NULL)
+		return (0);
+
+	ret = 0;
+	noise->run = false;
+	for (i = 0; i < noise->thread_started; ++i)
+		if ((t_ret = pthread_join(noise->threads[i], NULL)) != 0) {
+			lprintf(cfg, t_ret, 0, "Error joining noise thread");
+			if (ret == 0)
+				ret = t_ret;
+		}
+
+	if (noise->thread_started != 0 && __wt_epoch(NULL, &stop) == 0) {
+		secs = WT_TIMEDIFF_SEC(stop, noise->start);
+		if (secs == 0)
+			secs = 1;
+		lprintf(cfg, 0, 1,
+		    "Executed %" PRIu64 " noise I/Os, %" PRIu64 "MB, %" PRIu64
+		    " I/Os/sec",
+		    noise->ops, noise->bytes / WT_MEGABYTE, noise->ops / secs);
+	}
+
+	if (noise->fd != -1 && close(noise->fd) != 0) {
+		t_ret = errno;
+		lprintf(cfg, t_ret, 0, "noise: %s", noise->target);
+		if (ret == 0)
+			ret = t_ret;
+	}
+	free(noise->threads);
+	free(noise->intensity);
+	free(noise->target);
+	free(noise);
+	cfg->noise = NULL;
+	return (ret);
+}
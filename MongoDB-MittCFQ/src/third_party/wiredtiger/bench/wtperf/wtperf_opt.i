@@ -134,6 +134,31 @@ DEF_OPT_AS_UINT32(max_latency, 0,
     "Requires sample_interval to be configured")
 DEF_OPT_AS_BOOL(max_latency_fatal, 0,
     "print warning (false) or abort (true) of max_latency failure.")
+DEF_OPT_AS_UINT32(noise_io_size, 1048576,
+    "bytes per background noise I/O, a multiple of 4096")
+DEF_OPT_AS_STRING(noise_profile, "",
+    "noise profile file, in the format of the noise injector's profiles: "
+    "each intensity value is the number of noise threads doing I/O during "
+    "that period, and the profile's io_size, read_pct, target and span "
+    "replace the noise_io_size, noise_read_pct, noise_target and noise_span "
+    "options, except that a noise_target option is always used.  Empty to "
+    "keep every noise thread doing I/O all the time")
+DEF_OPT_AS_UINT32(noise_read_pct, 100,
+    "percentage of background noise I/Os that are reads, the rest are "
+    "writes.  Writes to a block device are refused")
+DEF_OPT_AS_UINT32(noise_span, 1024,
+    "megabytes of the noise target to spread background noise I/O over, "
+    "0 for the whole target")
+DEF_OPT_AS_STRING(noise_target, "",
+    "file or block device for background noise I/O.  Empty to use a file "
+    "named noise.img in the home directory, so the noise hits the same "
+    "device as the database; the file is created and filled to noise_span "
+    "megabytes if needed")
+DEF_OPT_AS_UINT32(noise_threads, 0,
+    "number of background noise threads doing direct I/O during the "
+    "workload phase, each keeping one I/O outstanding; 0 to disable.  With "
+    "a noise profile, the number of threads is the profile's highest "
+    "intensity, capped by this option when it's set")
 DEF_OPT_AS_UINT32(pareto, 0, "use pareto distribution for random numbers. Zero "
     "to disable, otherwise a percentage indicating how aggressive the "
     "distribution should be.")
@@ -147,6 +172,12 @@ DEF_OPT_AS_UINT32(random_range, 0,
     "insert operations")
 DEF_OPT_AS_BOOL(random_value, 0, "generate random content for the value")
 DEF_OPT_AS_BOOL(range_partition, 0, "partition data by range (vs hash)")
+DEF_OPT_AS_UINT32(read_deadline, 0,
+    "bound the page reads of each read operation with "
+    "WT_SESSION::set_read_deadline, in microseconds; 0 to disable.  Reads "
+    "rejected with WT_READ_BUSY are counted separately, and the latency of "
+    "every read is measured and reported in percentiles, split between "
+    "admitted and rejected reads")
 DEF_OPT_AS_UINT32(read_range, 0, "scan a range of keys after each search")
 DEF_OPT_AS_BOOL(readonly, 0,
     "reopen the connection between populate and workload phases in readonly "
@@ -225,6 +225,13 @@ file_config = format_meta + [
         data, that is, the limit is applied before any block compression
         is done''',
         min='512B', max='512MB'),
+    Config('leaf_search_prefix', 'false', r'''
+        when a row-store leaf page is read into memory, build an array of
+        fixed-size key prefixes used to narrow the binary search of the
+        page's keys, at a cost of 8 bytes of cache per key.  Ignored for
+        objects with a custom collator or Huffman-encoded keys, and for
+        pages with overflow keys''',
+        type='boolean'),
     Config('leaf_value_max', '0', r'''
         the largest value stored in a leaf node, in bytes.  If set, values
         larger than the specified size are stored as overflow items (which
@@ -380,6 +387,28 @@ connection_runtime_config = [
                 both log_size and wait to set an upper bound for checkpoints;
                 setting this value above 0 configures periodic checkpoints''',
             min='0', max='2GB'),
+        Config('pace_read_latency', '0', r'''
+            target latency in microseconds for application reads while a
+                periodic checkpoint writes dirty pages.  If non-zero, the
+                checkpoint server spreads its writes over the \c wait
+                interval, slowing down while application reads take longer
+                than the target and speeding up while they don't.  The
+                writes always finish within 80 percent of the interval, and
+                pacing stops once the cache is \c eviction_dirty_target
+                percent dirty.  A paced checkpoint holds the checkpoint lock
+                for as long as it runs, so operations that wait for the lock,
+                such as WT_SESSION::drop with \c checkpoint_wait,
+                WT_SESSION::rename and WT_SESSION::verify, wait for the whole
+                paced checkpoint.  Has no effect unless \c wait is also
+                set''',
+            min='0', max='10000000'),
+        Config('threads', '0', r'''
+            the number of threads that reconcile dirty leaf pages in parallel
+                while a checkpoint writes a file.  If 0, the thread doing
+                the checkpoint reconciles every page itself.  Each
+                checkpoint thread uses a session from the configured
+                session_max''',
+            min='0', max='64'),
         Config('wait', '0', r'''
             seconds to wait between each checkpoint; setting this value
             above 0 configures periodic checkpoints''',
@@ -459,6 +488,19 @@ connection_runtime_config = [
     Config('lsm_merge', 'true', r'''
         merge LSM chunks where possible (deprecated)''',
         type='boolean', undoc=True),
+    Config('readahead', '', r'''
+        configure background threads that read leaf pages into the cache
+        ahead of cursors scanning row-store files. Each readahead thread
+        uses a session from the configured session_max''',
+        type='category', subconfig=[
+        Config('pages', '0', r'''
+            the number of leaf pages to read ahead of a scanning cursor, or
+            0 to disable readahead''',
+            min='0', max='256'),
+        Config('threads', '2', r'''
+            the number of readahead threads''',
+            min='1', max='20'),
+        ]),
     Config('shared_cache', '', r'''
         shared cache configuration options. A database should configure
         either a cache_size or a shared_cache not both. Enabling a
@@ -638,6 +680,22 @@ wiredtiger_open_common =\
     connection_runtime_config +\
     wiredtiger_open_log_configuration +\
     wiredtiger_open_statistics_log_configuration + [
+    Config('block_cache', '', r'''
+        configure a cache of blocks read from data files, held as they are
+        on disk, that is, compressed and encrypted.  Pages read into the
+        cache are copied from the block cache instead of read from the file.
+        Intended for use with <code>"direct_io=[data]"</code>, to cache
+        compressed blocks in a fixed amount of memory instead of the
+        system's buffer cache.  Memory mapped files are not cached''',
+        type='category', subconfig=[
+        Config('hashsize', '32768', r'''
+            number of buckets in the block cache's hash table''',
+            min='512', max='4194304'),
+        Config('size', '0', r'''
+            maximum memory to allocate for the block cache, or 0 to disable
+            the block cache''',
+            min='0', max='10TB'),
+        ]),
     Config('buffer_alignment', '-1', r'''
         in-memory alignment (in bytes) for buffers used for I/O.  The
         default value of -1 indicates a platform-specific alignment value
@@ -944,6 +1002,14 @@ methods = {
         ignore the encodings for the key and value, manage data as if
         the formats were \c "u".  See @ref cursor_raw for details''',
         type='boolean'),
+    Config('read_once', 'false', r'''
+        the cursor is used to scan an object once, for example for a
+        backup. Pages the cursor reads into the cache are queued to be
+        evicted first, and pages already in the cache are not made more
+        recent, so a scan of an object larger than the cache does not
+        evict the working set. Leaf-page readahead is not done for the
+        cursor''',
+        type='boolean'),
     Config('readonly', 'false', r'''
         only query operations are supported by this cursor. An error is
         returned if a modification is attempted using the cursor.  The
@@ -58,6 +58,14 @@ errors = [
         more than the configured cache size to complete. The operation
         may be retried; if a transaction is in progress, it should be
         rolled back and the operation retried in a new transaction.'''),
+    Error('WT_READ_BUSY', -31808,
+        'read rejected by the I/O scheduler', '''
+        This error is only generated when a read deadline has been set
+        with WT_SESSION::set_read_deadline, and the operating system's
+        I/O scheduler predicts that a page read required by the
+        operation would not complete within that deadline.  No page was
+        read.  The operation may be retried, possibly against another
+        copy of the data.'''),
 ]
 
 # Update the #defines in the wiredtiger.in file.
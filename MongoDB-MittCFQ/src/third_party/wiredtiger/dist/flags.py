@@ -22,6 +22,7 @@ flags = {
         'LOG_SYNC_ENABLED',
     ],
     'page_read' : [
+        'READ_AHEAD',
         'READ_CACHE',
         'READ_COMPACT',
         'READ_NOTFOUND_OK',
@@ -131,6 +132,7 @@ flags = {
         'SESSION_NO_LOGGING',
         'SESSION_NO_SCHEMA_LOCK',
         'SESSION_QUIET_CORRUPT_FILE',
+        'SESSION_READ_DEADLINE',
         'SESSION_SERVER_ASYNC',
     ],
 }
@@ -161,9 +161,27 @@ connection_stats = [
     BlockStat('block_byte_read', 'bytes read', 'size'),
     BlockStat('block_byte_write', 'bytes written', 'size'),
     BlockStat('block_byte_write_checkpoint', 'bytes written for checkpoint', 'size'),
+    BlockStat('block_cache_blocks', 'block cache blocks', 'no_clear,no_scale'),
+    BlockStat('block_cache_byte_hit', 'block cache bytes read from the cache', 'size'),
+    BlockStat('block_cache_bytes', 'block cache bytes', 'no_clear,no_scale,size'),
+    BlockStat('block_cache_bytes_max', 'block cache maximum bytes configured', 'no_clear,no_scale,size'),
+    BlockStat('block_cache_evict', 'block cache blocks evicted'),
+    BlockStat('block_cache_hit', 'block cache hits'),
+    BlockStat('block_cache_insert', 'block cache blocks inserted'),
+    BlockStat('block_cache_miss', 'block cache misses'),
     BlockStat('block_map_read', 'mapped blocks read'),
     BlockStat('block_preload', 'blocks pre-loaded'),
     BlockStat('block_read', 'blocks read'),
+    BlockStat('block_read_latency_gt262144', 'block read latency histogram (bucket 8) - 262144us+'),
+    BlockStat('block_read_latency_lt1024', 'block read latency histogram (bucket 3) - 256-1023us'),
+    BlockStat('block_read_latency_lt16384', 'block read latency histogram (bucket 5) - 4096-16383us'),
+    BlockStat('block_read_latency_lt256', 'block read latency histogram (bucket 2) - 64-255us'),
+    BlockStat('block_read_latency_lt262144', 'block read latency histogram (bucket 7) - 65536-262143us'),
+    BlockStat('block_read_latency_lt4096', 'block read latency histogram (bucket 4) - 1024-4095us'),
+    BlockStat('block_read_latency_lt64', 'block read latency histogram (bucket 1) - 0-63us'),
+    BlockStat('block_read_latency_lt65536', 'block read latency histogram (bucket 6) - 16384-65535us'),
+    BlockStat('block_read_latency_total', 'block read latency total (usecs)'),
+    BlockStat('block_read_busy', 'blocks read rejected by the I/O scheduler'),
     BlockStat('block_write', 'blocks written'),
 
     ##########################################
@@ -224,6 +242,10 @@ connection_stats = [
     CacheStat('cache_pages_inuse', 'pages currently held in the cache', 'no_clear,no_scale'),
     CacheStat('cache_pages_requested', 'pages requested from the cache'),
     CacheStat('cache_read', 'pages read into cache'),
+    CacheStat('cache_read_ahead', 'pages read into cache by readahead'),
+    CacheStat('cache_read_ahead_cache_full', 'readahead requests stopped by cache pressure'),
+    CacheStat('cache_read_ahead_queue_full', 'readahead requests dropped because the queue was full'),
+    CacheStat('cache_read_ahead_queued', 'readahead requests queued'),
     CacheStat('cache_read_lookaside', 'pages read into cache requiring lookaside entries'),
     CacheStat('cache_read_overflow', 'overflow pages read into cache'),
     CacheStat('cache_write', 'pages written from cache'),
@@ -301,9 +323,15 @@ connection_stats = [
     TxnStat('txn_checkpoint_fsync_post', 'transaction fsync calls for checkpoint after allocating the transaction ID'),
     TxnStat('txn_checkpoint_fsync_post_duration', 'transaction fsync duration for checkpoint after allocating the transaction ID (usecs)', 'no_clear,no_scale'),
     TxnStat('txn_checkpoint_generation', 'transaction checkpoint generation', 'no_clear,no_scale'),
+    TxnStat('txn_checkpoint_pace_deadline', 'transaction checkpoint pacing rate raised to meet the deadline'),
+    TxnStat('txn_checkpoint_pace_delay', 'transaction checkpoint pacing delay (usecs)'),
+    TxnStat('txn_checkpoint_pace_dirty', 'transaction checkpoint pacing stopped by dirty cache'),
+    TxnStat('txn_checkpoint_pace_rate', 'transaction checkpoint pacing target rate (bytes per second)', 'no_clear,no_scale'),
+    TxnStat('txn_checkpoint_pace_read_latency', 'transaction checkpoint pacing application read latency (usecs)', 'no_clear,no_scale'),
     TxnStat('txn_checkpoint_running', 'transaction checkpoint currently running', 'no_clear,no_scale'),
     TxnStat('txn_checkpoint_scrub_target', 'transaction checkpoint scrub dirty target', 'no_clear,no_scale'),
     TxnStat('txn_checkpoint_scrub_time', 'transaction checkpoint scrub time (msecs)', 'no_clear,no_scale'),
+    TxnStat('txn_checkpoint_threads_pages', 'transaction checkpoint pages reconciled by checkpoint threads'),
     TxnStat('txn_checkpoint_time_max', 'transaction checkpoint max time (msecs)', 'no_clear,no_scale'),
     TxnStat('txn_checkpoint_time_min', 'transaction checkpoint min time (msecs)', 'no_clear,no_scale'),
     TxnStat('txn_checkpoint_time_recent', 'transaction checkpoint most recent time (msecs)', 'no_clear,no_scale'),
@@ -466,6 +494,15 @@ dsrc_stats = [
     BlockStat('block_magic', 'file magic number', 'max_aggregate,no_scale'),
     BlockStat('block_major', 'file major version number', 'max_aggregate,no_scale'),
     BlockStat('block_minor', 'minor version number', 'max_aggregate,no_scale'),
+    BlockStat('block_read_latency_gt262144', 'block read latency histogram (bucket 8) - 262144us+'),
+    BlockStat('block_read_latency_lt1024', 'block read latency histogram (bucket 3) - 256-1023us'),
+    BlockStat('block_read_latency_lt16384', 'block read latency histogram (bucket 5) - 4096-16383us'),
+    BlockStat('block_read_latency_lt256', 'block read latency histogram (bucket 2) - 64-255us'),
+    BlockStat('block_read_latency_lt262144', 'block read latency histogram (bucket 7) - 65536-262143us'),
+    BlockStat('block_read_latency_lt4096', 'block read latency histogram (bucket 4) - 1024-4095us'),
+    BlockStat('block_read_latency_lt64', 'block read latency histogram (bucket 1) - 0-63us'),
+    BlockStat('block_read_latency_lt65536', 'block read latency histogram (bucket 6) - 16384-65535us'),
+    BlockStat('block_read_latency_total', 'block read latency total (usecs)'),
     BlockStat('block_reuse_bytes', 'file bytes available for reuse', 'no_scale,size'),
     BlockStat('block_size', 'file size in bytes', 'no_scale,size'),
 
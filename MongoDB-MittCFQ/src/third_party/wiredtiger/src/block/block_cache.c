@@ -0,0 +1,318 @@
+/*-
+ * Copyright (c) 2014-2016 MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * The block cache holds blocks as they were read from the file, that is,
+ * compressed and encrypted, with their checksums verified.  It sits below the
+ * page cache: a page evicted from the page cache and read back in is copied
+ * from the block cache rather than from the file.  With direct I/O configured
+ * for data files, this replaces the system's buffer cache with one of known
+ * size, without the double caching of uncompressed pages in the page cache and
+ * compressed blocks in the buffer cache.
+ *
+ * Blocks are found by their block handle and address cookie: the offset, size
+ * and checksum.  Space in a file is reused, but a block written to the same
+ * offset has a different checksum: unless the block's data is checksummed,
+ * the checksum covers the page header with its write generation, which is
+ * never reused.
+ *
+ * Eviction is a clock: a block is marked when it's read from the cache, and an
+ * eviction pass over a bucket clears the marks, discarding blocks that weren't
+ * marked since the last pass.  Blocks are cached unmarked, so blocks read only
+ * once (for example by a scan) are the first to go.
+ */
+
+/*
+ * __blkcache_bucket --
+ *	Return the hash bucket for a block.
+ */
+static inline uint32_t
+__blkcache_bucket(WT_BLKCACHE *blkcache, WT_BLOCK *block, wt_off_t offset)
+{
+	uint64_t key[2];
+
+	key[0] = block->blkcache_id;
+	key[1] = (uint64_t)offset;
+	return ((uint32_t)
+	    (__wt_hash_city64(key, sizeof(key)) % blkcache->hash_size));
+}
+
+/*
+ * __blkcache_search --
+ *	Search a locked hash bucket for a block.
+ */
+static inline WT_BLKCACHE_ITEM *
+__blkcache_search(WT_BLKCACHE *blkcache, uint32_t bucket,
+    WT_BLOCK *block, wt_off_t offset, uint32_t size, uint32_t checksum)
+{
+	WT_BLKCACHE_ITEM *item;
+
+	TAILQ_FOREACH(item, &blkcache->hash[bucket], hashq)
+		if (item->block_id == block->blkcache_id &&
+		    item->offset == offset && item->size == size &&
+		    item->checksum == checksum)
+			return (item);
+	return (NULL);
+}
+
+/*
+ * __blkcache_evict --
+ *	Discard blocks until the cache is back within its size.
+ */
+static void
+__blkcache_evict(WT_SESSION_IMPL *session)
+{
+	TAILQ_HEAD(__wt_blkcache_evictq, __wt_blkcache_item) evictq;
+	WT_BLKCACHE *blkcache;
+	WT_BLKCACHE_ITEM *item, *next;
+	WT_SPINLOCK *lock;
+	uint64_t bytes, blocks;
+	uint32_t bucket, i;
+
+	blkcache = &S2C(session)->blkcache;
+
+	/*
+	 * Threads reading blocks in share the work, each sweeping the next
+	 * bucket.  Twice around is enough: the first pass clears every mark.
+	 */
+	for (i = 0; i < 2 * blkcache->hash_size &&
+	    blkcache->bytes_inuse > blkcache->bytes_max; ++i) {
+		bucket = __wt_atomic_addv32(&blkcache->evict_bucket, 1) %
+		    blkcache->hash_size;
+		if (TAILQ_EMPTY(&blkcache->hash[bucket]))
+			continue;
+
+		TAILQ_INIT(&evictq);
+		bytes = blocks = 0;
+		lock = &blkcache->hash_lock[bucket % WT_BLKCACHE_LOCKS];
+		__wt_spin_lock(session, lock);
+		TAILQ_FOREACH_SAFE(item, &blkcache->hash[bucket], hashq, next) {
+			if (item->referenced) {
+				item->referenced = false;
+				continue;
+			}
+			TAILQ_REMOVE(&blkcache->hash[bucket], item, hashq);
+			TAILQ_INSERT_HEAD(&evictq, item, hashq);
+			bytes += sizeof(WT_BLKCACHE_ITEM) + item->size;
+			++blocks;
+		}
+		__wt_spin_unlock(session, lock);
+
+		if (blocks == 0)
+			continue;
+		while ((item = TAILQ_FIRST(&evictq)) != NULL) {
+			TAILQ_REMOVE(&evictq, item, hashq);
+			__wt_free(session, item);
+		}
+		(void)__wt_atomic_subv64(&blkcache->bytes_inuse, bytes);
+		(void)__wt_atomic_subv64(&blkcache->blocks_inuse, blocks);
+		WT_STAT_FAST_CONN_INCRV(session, block_cache_evict, blocks);
+	}
+}
+
+/*
+ * __wt_blkcache_get --
+ *	Copy a block from the block cache into a buffer, if it's there.
+ */
+int
+__wt_blkcache_get(WT_SESSION_IMPL *session, WT_BLOCK *block,
+    wt_off_t offset, uint32_t size, uint32_t checksum,
+    WT_ITEM *buf, bool *foundp)
+{
+	WT_BLKCACHE *blkcache;
+	WT_BLKCACHE_ITEM *item;
+	WT_SPINLOCK *lock;
+	uint32_t bucket;
+
+	*foundp = false;
+
+	blkcache = &S2C(session)->blkcache;
+	if (blkcache->bytes_max == 0)
+		return (0);
+
+	bucket = __blkcache_bucket(blkcache, block, offset);
+	lock = &blkcache->hash_lock[bucket % WT_BLKCACHE_LOCKS];
+
+	/*
+	 * The block is copied out with the bucket locked, so it can't be
+	 * evicted underneath us: if the buffer has to grow, do that without
+	 * the lock held and search again.
+	 */
+	for (;;) {
+		__wt_spin_lock(session, lock);
+		item = __blkcache_search(
+		    blkcache, bucket, block, offset, size, checksum);
+		if (item == NULL || buf->memsize >= size)
+			break;
+		__wt_spin_unlock(session, lock);
+
+		WT_RET(__wt_buf_init(session, buf, size));
+	}
+	if (item != NULL) {
+		item->referenced = true;
+		memcpy(buf->mem, WT_BLKCACHE_ITEM_DATA(item), size);
+		buf->data = buf->mem;
+		buf->size = size;
+	}
+	__wt_spin_unlock(session, lock);
+
+	if (item == NULL) {
+		WT_STAT_FAST_CONN_INCR(session, block_cache_miss);
+		return (0);
+	}
+
+	WT_STAT_FAST_CONN_INCR(session, block_cache_hit);
+	WT_STAT_FAST_CONN_INCRV(session, block_cache_byte_hit, size);
+	*foundp = true;
+	return (0);
+}
+
+/*
+ * __wt_blkcache_put --
+ *	Add a block just read from the file to the block cache.
+ */
+int
+__wt_blkcache_put(WT_SESSION_IMPL *session, WT_BLOCK *block,
+    wt_off_t offset, uint32_t size, uint32_t checksum, const WT_ITEM *buf)
+{
+	WT_BLKCACHE *blkcache;
+	WT_BLKCACHE_ITEM *item;
+	WT_SPINLOCK *lock;
+	uint32_t bucket;
+	bool exists;
+
+	blkcache = &S2C(session)->blkcache;
+	if (blkcache->bytes_max == 0)
+		return (0);
+
+	/* A block that doesn't fit would only empty the cache. */
+	if (sizeof(WT_BLKCACHE_ITEM) + size > blkcache->bytes_max)
+		return (0);
+
+	WT_RET(__wt_malloc(session, sizeof(WT_BLKCACHE_ITEM) + size, &item));
+	item->block_id = block->blkcache_id;
+	item->offset = offset;
+	item->size = size;
+	item->checksum = checksum;
+	item->referenced = false;
+	memcpy(WT_BLKCACHE_ITEM_DATA(item), buf->data, size);
+
+	/* Another thread may have read the same block at the same time. */
+	bucket = __blkcache_bucket(blkcache, block, offset);
+	lock = &blkcache->hash_lock[bucket % WT_BLKCACHE_LOCKS];
+	__wt_spin_lock(session, lock);
+	exists = __blkcache_search(
+	    blkcache, bucket, block, offset, size, checksum) != NULL;
+	if (!exists)
+		TAILQ_INSERT_HEAD(&blkcache->hash[bucket], item, hashq);
+	__wt_spin_unlock(session, lock);
+
+	if (exists) {
+		__wt_free(session, item);
+		return (0);
+	}
+
+	(void)__wt_atomic_addv64(
+	    &blkcache->bytes_inuse, sizeof(WT_BLKCACHE_ITEM) + size);
+	(void)__wt_atomic_addv64(&blkcache->blocks_inuse, 1);
+	WT_STAT_FAST_CONN_INCR(session, block_cache_insert);
+
+	if (blkcache->bytes_inuse > blkcache->bytes_max)
+		__blkcache_evict(session);
+	return (0);
+}
+
+/*
+ * __wt_blkcache_stats_update --
+ *	Update the block cache statistics for return to the application.
+ */
+void
+__wt_blkcache_stats_update(WT_SESSION_IMPL *session)
+{
+	WT_BLKCACHE *blkcache;
+	WT_CONNECTION_STATS **stats;
+
+	blkcache = &S2C(session)->blkcache;
+	stats = S2C(session)->stats;
+
+	WT_STAT_SET(session, stats, block_cache_bytes_max, blkcache->bytes_max);
+	WT_STAT_SET(session, stats, block_cache_bytes, blkcache->bytes_inuse);
+	WT_STAT_SET(session, stats, block_cache_blocks, blkcache->blocks_inuse);
+}
+
+/*
+ * __wt_blkcache_config --
+ *	Configure the block cache and allocate its hash table.
+ */
+int
+__wt_blkcache_config(WT_SESSION_IMPL *session, const char *cfg[])
+{
+	WT_BLKCACHE *blkcache;
+	WT_CONFIG_ITEM cval;
+	uint32_t i;
+
+	blkcache = &S2C(session)->blkcache;
+
+	/* There's nothing to read in an in-memory database. */
+	if (F_ISSET(S2C(session), WT_CONN_IN_MEMORY))
+		return (0);
+
+	WT_RET(__wt_config_gets(session, cfg, "block_cache.size", &cval));
+	if (cval.val == 0)
+		return (0);
+	blkcache->bytes_max = (uint64_t)cval.val;
+
+	WT_RET(__wt_config_gets(session, cfg, "block_cache.hashsize", &cval));
+	blkcache->hash_size = (uint32_t)cval.val;
+
+	WT_RET(__wt_calloc_def(session, blkcache->hash_size, &blkcache->hash));
+	for (i = 0; i < blkcache->hash_size; ++i)
+		TAILQ_INIT(&blkcache->hash[i]);
+
+	WT_RET(__wt_calloc_def(
+	    session, WT_BLKCACHE_LOCKS, &blkcache->hash_lock));
+	WT_CACHE_LINE_ALIGNMENT_VERIFY(session, blkcache->hash_lock);
+	for (i = 0; i < WT_BLKCACHE_LOCKS; ++i)
+		WT_RET(__wt_spin_init(
+		    session, &blkcache->hash_lock[i], "block cache"));
+
+	return (0);
+}
+
+/*
+ * __wt_blkcache_destroy --
+ *	Discard the block cache.
+ */
+void
+__wt_blkcache_destroy(WT_SESSION_IMPL *session)
+{
+	WT_BLKCACHE *blkcache;
+	WT_BLKCACHE_ITEM *item;
+	uint32_t i;
+
+	blkcache = &S2C(session)->blkcache;
+
+	if (blkcache->hash != NULL)
+		for (i = 0; i < blkcache->hash_size; ++i)
+			while ((item =
+			    TAILQ_FIRST(&blkcache->hash[i])) != NULL) {
+				TAILQ_REMOVE(&blkcache->hash[i], item, hashq);
+				__wt_free(session, item);
+			}
+	__wt_free(session, blkcache->hash);
+
+	if (blkcache->hash_lock != NULL)
+		for (i = 0; i < WT_BLKCACHE_LOCKS; ++i)
+			__wt_spin_destroy(session, &blkcache->hash_lock[i]);
+	__wt_free(session, blkcache->hash_lock);
+
+	blkcache->bytes_max = blkcache->bytes_inuse = 0;
+	blkcache->blocks_inuse = 0;
+}
@@ -177,6 +177,7 @@ __wt_block_open(WT_SESSION_IMPL *session,
 	block->ref = 1;
 	block->name_hash = hash;
 	block->allocsize = allocsize;
+	block->blkcache_id = __wt_atomic_addv64(&conn->blkcache.block_id, 1);
 	WT_CONN_BLOCK_INSERT(conn, block, bucket);
 
 	WT_ERR(__wt_strdup(session, filename, &block->name));
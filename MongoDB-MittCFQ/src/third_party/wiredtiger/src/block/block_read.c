@@ -66,7 +66,7 @@ __wt_bm_read(WT_BM *bm, WT_SESSION_IMPL *session,
 	WT_FILE_HANDLE *handle;
 	wt_off_t offset;
 	uint32_t checksum, size;
-	bool mapped;
+	bool found, mapped;
 
 	WT_UNUSED(addr_size);
 	block = bm->block;
@@ -99,10 +99,25 @@ __wt_bm_read(WT_BM *bm, WT_SESSION_IMPL *session,
 	WT_RET(__wt_block_misplaced(
 	    session, block, "read", offset, size, bm->is_live));
 #endif
+	/*
+	 * Check the block cache: verify reads every block once, don't let it
+	 * flush the cache.
+	 */
+	if (!block->verify) {
+		WT_RET(__wt_blkcache_get(
+		    session, block, offset, size, checksum, buf, &found));
+		if (found)
+			return (0);
+	}
+
 	/* Read the block. */
 	WT_RET(
 	    __wt_block_read_off(session, block, buf, offset, size, checksum));
 
+	if (!block->verify)
+		WT_RET(__wt_blkcache_put(
+		    session, block, offset, size, checksum, buf));
+
 	/* Optionally discard blocks from the system's buffer cache. */
 	WT_RET(__wt_block_discard(session, block, (size_t)size));
 
@@ -148,6 +163,45 @@ __wt_block_read_off_blind(
 }
 #endif
 
+/*
+ * WT_BLOCK_READ_LATENCY_INCR --
+ *	Count a read in the connection's or the file's read latency histogram,
+ *	the buckets are powers of 4 microseconds.
+ */
+#define	WT_BLOCK_READ_LATENCY_INCR(session, stats, usecs) do {		\
+	if ((usecs) < 64)						\
+		WT_STAT_FAST_INCR(session, stats, block_read_latency_lt64);\
+	else if ((usecs) < 256)						\
+		WT_STAT_FAST_INCR(session, stats, block_read_latency_lt256);\
+	else if ((usecs) < 1024)					\
+		WT_STAT_FAST_INCR(session, stats, block_read_latency_lt1024);\
+	else if ((usecs) < 4096)					\
+		WT_STAT_FAST_INCR(session, stats, block_read_latency_lt4096);\
+	else if ((usecs) < 16384)					\
+		WT_STAT_FAST_INCR(session, stats, block_read_latency_lt16384);\
+	else if ((usecs) < 65536)					\
+		WT_STAT_FAST_INCR(session, stats, block_read_latency_lt65536);\
+	else if ((usecs) < 262144)					\
+		WT_STAT_FAST_INCR(session, stats, block_read_latency_lt262144);\
+	else								\
+		WT_STAT_FAST_INCR(session, stats, block_read_latency_gt262144);\
+	WT_STAT_FAST_INCRV(session, stats, block_read_latency_total, usecs);\
+} while (0)
+
+/*
+ * __block_read_latency --
+ *	Record how long a block read took, for the connection and for the file
+ *	being read, so a slow disk can be traced to the objects it holds.
+ */
+static inline void
+__block_read_latency(WT_SESSION_IMPL *session, uint64_t usecs)
+{
+	WT_BLOCK_READ_LATENCY_INCR(session, S2C(session)->stats, usecs);
+	if (session->dhandle != NULL)
+		WT_BLOCK_READ_LATENCY_INCR(
+		    session, session->dhandle->stats, usecs);
+}
+
 /*
  * __wt_block_read_off --
  *	Read an addr/size pair referenced block into a buffer.
@@ -156,8 +210,12 @@ int
 __wt_block_read_off(WT_SESSION_IMPL *session, WT_BLOCK *block,
     WT_ITEM *buf, wt_off_t offset, uint32_t size, uint32_t checksum)
 {
+	struct timespec start, stop;
 	WT_BLOCK_HEADER *blk, swap;
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
 	size_t bufsize;
+	uint64_t usecs;
 	uint32_t page_checksum;
 
 	__wt_verbose(session, WT_VERB_READ,
@@ -183,7 +241,27 @@ __wt_block_read_off(WT_SESSION_IMPL *session, WT_BLOCK *block,
 		bufsize = WT_MAX(size, buf->memsize + 10);
 	}
 	WT_RET(__wt_buf_init(session, buf, bufsize));
-	WT_RET(__wt_read(session, block->fh, offset, size, buf->mem));
+
+	/*
+	 * Account for the read in the session, so applications can tell how
+	 * much of an operation's time went to I/O.
+	 */
+	WT_RET(__wt_epoch(session, &start));
+	ret = __wt_read(session, block->fh, offset, size, buf->mem);
+	WT_TRET(__wt_epoch(session, &stop));
+	usecs = WT_TIMEDIFF_US(stop, start);
+	++session->read_count;
+	session->read_time_us += usecs;
+	if (!F_ISSET(session, WT_SESSION_INTERNAL)) {
+		conn = S2C(session);
+		(void)__wt_atomic_add64(&conn->app_read_count, 1);
+		(void)__wt_atomic_add64(&conn->app_read_usecs, usecs);
+	}
+	if (ret == WT_READ_BUSY)
+		++session->read_busy;
+	WT_RET(ret);
+	__block_read_latency(session, usecs);
+	session->read_bytes += size;
 	buf->size = size;
 
 	/*
@@ -522,6 +522,9 @@ __wt_btcur_iterate_setup(WT_CURSOR_BTREE *cbt)
 	/* Clear the count of deleted items on the page. */
 	cbt->page_deleted_count = 0;
 
+	/* A repositioned cursor isn't scanning (yet). */
+	cbt->readahead_leaves = 0;
+
 	/* Clear saved iteration cursor position information. */
 	cbt->cip_saved = NULL;
 	cbt->rip_saved = NULL;
@@ -594,6 +597,13 @@ __wt_btcur_next(WT_CURSOR_BTREE *cbt, bool truncating)
 	if (truncating)
 		LF_SET(WT_READ_TRUNCATE);
 
+	/*
+	 * A read-once scan reads pages in at the oldest read generation, so
+	 * eviction takes them first, and doesn't make cached pages younger.
+	 */
+	if (F_ISSET(cbt, WT_CBT_READ_ONCE))
+		LF_SET(WT_READ_NO_GEN | WT_READ_WONT_NEED);
+
 	WT_RET(__cursor_func_init(cbt, false));
 
 	/*
@@ -672,6 +682,10 @@ __wt_btcur_next(WT_CURSOR_BTREE *cbt, bool truncating)
 		WT_ERR_TEST(cbt->ref == NULL, WT_NOTFOUND);
 	}
 
+	/* If the cursor moved to a new leaf page, consider reading ahead. */
+	if (ret == 0 && newpage)
+		__wt_readahead_scan(session, cbt, false);
+
 #ifdef HAVE_DIAGNOSTIC
 	if (ret == 0)
 		WT_ERR(__wt_cursor_key_order_check(session, cbt, true));
@@ -358,6 +358,9 @@ __free_page_row_leaf(WT_SESSION_IMPL *session, WT_PAGE *page)
 		    page, copy, &ikey, NULL, NULL, NULL);
 		__wt_free(session, ikey);
 	}
+
+	/* Free the search prefixes. */
+	__wt_free(session, page->pg_row_prefix);
 }
 
 /*
@@ -246,6 +246,12 @@ __btree_conf(WT_SESSION_IMPL *session, WT_CKPT *ckpt)
 
 		WT_RET(__wt_config_gets(session, cfg, "key_gap", &cval));
 		btree->key_gap = (uint32_t)cval.val;
+
+		/* Search prefixes compare bytes, not the collation order. */
+		WT_RET(__wt_config_gets(
+		    session, cfg, "leaf_search_prefix", &cval));
+		btree->leaf_search_prefix =
+		    cval.val != 0 && btree->collator == NULL;
 	}
 
 	/* Column-store: check for fixed-size data. */
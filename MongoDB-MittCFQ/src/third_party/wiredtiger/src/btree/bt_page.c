@@ -12,9 +12,10 @@ static void __inmem_col_fix(WT_SESSION_IMPL *, WT_PAGE *);
 static void __inmem_col_int(WT_SESSION_IMPL *, WT_PAGE *);
 static int  __inmem_col_var(WT_SESSION_IMPL *, WT_PAGE *, uint64_t, size_t *);
 static int  __inmem_row_int(WT_SESSION_IMPL *, WT_PAGE *, size_t *);
-static int  __inmem_row_leaf(WT_SESSION_IMPL *, WT_PAGE *);
+static int  __inmem_row_leaf(WT_SESSION_IMPL *, WT_PAGE *, size_t *);
 static int  __inmem_row_leaf_entries(
 	WT_SESSION_IMPL *, const WT_PAGE_HEADER *, uint32_t *);
+static int  __inmem_row_leaf_prefix(WT_SESSION_IMPL *, WT_PAGE *, size_t *);
 
 /*
  * __wt_page_alloc --
@@ -212,7 +213,7 @@ __wt_page_inmem(WT_SESSION_IMPL *session, WT_REF *ref,
 		WT_ERR(__inmem_row_int(session, page, &size));
 		break;
 	case WT_PAGE_ROW_LEAF:
-		WT_ERR(__inmem_row_leaf(session, page));
+		WT_ERR(__inmem_row_leaf(session, page, &size));
 		break;
 	WT_ILLEGAL_VALUE_ERR(session);
 	}
@@ -555,7 +556,7 @@ __inmem_row_leaf_entries(
  *	Build in-memory index for row-store leaf pages.
  */
 static int
-__inmem_row_leaf(WT_SESSION_IMPL *session, WT_PAGE *page)
+__inmem_row_leaf(WT_SESSION_IMPL *session, WT_PAGE *page, size_t *sizep)
 {
 	WT_BTREE *btree;
 	WT_CELL *cell;
@@ -606,7 +607,109 @@ __inmem_row_leaf(WT_SESSION_IMPL *session, WT_PAGE *page)
 
 	/*
 	 * We do not currently instantiate keys on leaf pages when the page is
-	 * loaded, they're instantiated on demand.
+	 * loaded, they're instantiated on demand.  Search prefixes don't need
+	 * the keys instantiated, build them if configured.
 	 */
+	if (btree->leaf_search_prefix &&
+	    btree->huffman_key == NULL && page->pg_row_entries > 1)
+		WT_RET(__inmem_row_leaf_prefix(session, page, sizep));
+
+	return (0);
+}
+
+/*
+ * __inmem_row_leaf_key --
+ *	Build the next key on a row-store leaf page from its cell and the key
+ * before it.
+ */
+static inline int
+__inmem_row_leaf_key(
+    WT_SESSION_IMPL *session, WT_CELL_UNPACK *unpack, WT_ITEM *key)
+{
+	WT_ASSERT(session, unpack->prefix <= key->size);
+
+	key->size = unpack->prefix;
+	WT_RET(__wt_buf_grow(session, key, unpack->prefix + unpack->size));
+	memcpy((uint8_t *)key->mem + unpack->prefix,
+	    unpack->data, unpack->size);
+	key->size += unpack->size;
 	return (0);
 }
+
+/*
+ * __inmem_row_leaf_prefix --
+ *	Build the search prefixes for a row-store leaf page.
+ */
+static int
+__inmem_row_leaf_prefix(WT_SESSION_IMPL *session, WT_PAGE *page, size_t *sizep)
+{
+	WT_BTREE *btree;
+	WT_CELL *cell;
+	WT_CELL_UNPACK *unpack, _unpack;
+	WT_DECL_ITEM(first);
+	WT_DECL_ITEM(key);
+	WT_DECL_RET;
+	size_t size, skip;
+	uint64_t *prefix;
+	uint32_t entries, i, slot;
+	const uint8_t *a, *b;
+
+	btree = S2BT(session);
+	unpack = &_unpack;
+	entries = page->pg_row_entries;
+	prefix = NULL;
+
+	WT_RET(__wt_scr_alloc(session, 0, &first));
+	WT_ERR(__wt_scr_alloc(session, 0, &key));
+
+	/*
+	 * The keys are sorted, so the bytes all of them share are the bytes
+	 * the first and last keys share.  Overflow keys aren't worth reading
+	 * for their prefixes, pages with overflow keys go without.
+	 */
+	slot = 0;
+	WT_CELL_FOREACH(btree, page->dsk, cell, unpack, i) {
+		__wt_cell_unpack(cell, unpack);
+		if (unpack->type == WT_CELL_KEY_OVFL)
+			goto err;
+		if (unpack->type != WT_CELL_KEY)
+			continue;
+		WT_ERR(__inmem_row_leaf_key(session, unpack, key));
+		if (slot++ == 0)
+			WT_ERR(__wt_buf_set(
+			    session, first, key->data, key->size));
+	}
+	WT_ASSERT(session, slot == entries);
+
+	a = first->data;
+	b = key->data;
+	for (skip = 0; skip < WT_MIN(first->size, key->size) &&
+	    a[skip] == b[skip]; ++skip)
+		;
+
+	/* The shared bytes are stored after the prefixes. */
+	size = entries * sizeof(uint64_t) + skip;
+	WT_ERR(__wt_malloc(session, size, &prefix));
+	memcpy(prefix + entries, first->data, skip);
+
+	key->size = 0;
+	slot = 0;
+	WT_CELL_FOREACH(btree, page->dsk, cell, unpack, i) {
+		__wt_cell_unpack(cell, unpack);
+		if (unpack->type != WT_CELL_KEY)
+			continue;
+		WT_ERR(__inmem_row_leaf_key(session, unpack, key));
+		prefix[slot++] =
+		    __wt_row_leaf_prefix(key->data, key->size, skip);
+	}
+
+	page->pg_row_prefix_skip = (uint32_t)skip;
+	page->pg_row_prefix = prefix;
+	prefix = NULL;
+	*sizep += size;
+
+err:	__wt_free(session, prefix);
+	__wt_scr_free(session, &first);
+	__wt_scr_free(session, &key);
+	return (ret);
+}
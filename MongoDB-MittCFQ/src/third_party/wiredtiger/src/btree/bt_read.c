@@ -399,9 +399,14 @@ __page_read(WT_SESSION_IMPL *session, WT_REF *ref)
 
 	/*
 	 * There's an address, read or map the backing disk page and build an
-	 * in-memory version of the page.
+	 * in-memory version of the page.  If the session has a read deadline,
+	 * the read is bounded by it and may fail with WT_READ_BUSY.
 	 */
-	WT_ERR(__wt_bt_read(session, &tmp, addr, addr_size));
+	if (session->read_deadline_us >= 0)
+		F_SET(session, WT_SESSION_READ_DEADLINE);
+	ret = __wt_bt_read(session, &tmp, addr, addr_size);
+	F_CLR(session, WT_SESSION_READ_DEADLINE);
+	WT_ERR(ret);
 	WT_ERR(__wt_page_inmem(session, ref, tmp.data, tmp.memsize,
 	    WT_DATA_IN_ITEM(&tmp) ?
 	    WT_PAGE_DISK_ALLOC : WT_PAGE_DISK_MAPPED, &page));
@@ -506,6 +511,9 @@ __wt_page_in_func(WT_SESSION_IMPL *session, WT_REF *ref, uint32_t flags
 				WT_RET(__wt_cache_eviction_check(
 				    session, 1, NULL));
 			WT_RET(__page_read(session, ref));
+			if (LF_ISSET(WT_READ_AHEAD))
+				WT_STAT_FAST_CONN_INCR(
+				    session, cache_read_ahead);
 
 			/*
 			 * If configured to not trash the cache, leave the page
@@ -8,6 +8,224 @@
 
 #include "wt_internal.h"
 
+/*
+ * Checkpoint leaf reconciliation:
+ *
+ * With checkpoint threads configured, the checkpoint's tree walk hands dirty
+ * leaf pages to the threads in batches rather than reconciling them itself.
+ * Each page in a batch is pinned with a hazard pointer held by the
+ * checkpointing session, so it can't go anywhere until the batch completes.
+ * The threads reconcile with a copy of the checkpoint's snapshot, the pages
+ * are independent: the page lock serializes reconciliation of a page, parent
+ * pages are only marked dirty (which is done atomically), and the block
+ * manager serializes allocation with its own lock.  The walk returns internal
+ * pages after their children, so the checkpoint finishes the batch before
+ * reconciling an internal page, and the parent sees its children's results.
+ */
+
+/*
+ * __sync_rec_pop --
+ *	Take the next page from the checkpoint's batch.
+ */
+static WT_REF *
+__sync_rec_pop(WT_SESSION_IMPL *session,
+    WT_SESSION_IMPL **ckpt_sessionp, WT_DATA_HANDLE **dhandlep)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_REF *ref;
+
+	conn = S2C(session);
+	ref = NULL;
+
+	if (conn->ckpt_rec_next == conn->ckpt_rec_count)
+		return (NULL);
+
+	__wt_spin_lock(session, &conn->ckpt_rec_lock);
+	if (conn->ckpt_rec_next < conn->ckpt_rec_count) {
+		ref = conn->ckpt_rec_batch[conn->ckpt_rec_next++];
+		if (ckpt_sessionp != NULL)
+			*ckpt_sessionp = conn->ckpt_rec_session;
+		if (dhandlep != NULL)
+			*dhandlep = conn->ckpt_rec_dhandle;
+	}
+	__wt_spin_unlock(session, &conn->ckpt_rec_lock);
+
+	return (ref);
+}
+
+/*
+ * __sync_rec_done --
+ *	Note a page in the batch has been reconciled.
+ */
+static void
+__sync_rec_done(WT_SESSION_IMPL *session, int error)
+{
+	WT_CONNECTION_IMPL *conn;
+	bool last;
+
+	conn = S2C(session);
+
+	__wt_spin_lock(session, &conn->ckpt_rec_lock);
+	if (error != 0 && conn->ckpt_rec_ret == 0)
+		conn->ckpt_rec_ret = error;
+	last = ++conn->ckpt_rec_done == conn->ckpt_rec_count;
+	__wt_spin_unlock(session, &conn->ckpt_rec_lock);
+
+	if (last)
+		__wt_cond_signal(session, conn->ckpt_rec_cond);
+}
+
+/*
+ * __sync_rec_thread_page --
+ *	Reconcile a leaf page for a checkpoint in a checkpoint thread.
+ */
+static int
+__sync_rec_thread_page(WT_SESSION_IMPL *session,
+    WT_SESSION_IMPL *ckpt_session, WT_DATA_HANDLE *dhandle, WT_REF *ref)
+{
+	WT_DECL_RET;
+	WT_TXN *ckpt_txn, *txn;
+
+	ckpt_txn = &ckpt_session->txn;
+	txn = &session->txn;
+
+	/*
+	 * Take a copy of the checkpoint's snapshot: the checkpoint is waiting
+	 * for the batch, its transaction can't change underneath us.  There's
+	 * no need to publish anything, the checkpoint's snapshot keeps the
+	 * updates we read from being discarded.
+	 */
+	txn->isolation = ckpt_txn->isolation;
+	if (F_ISSET(ckpt_txn, WT_TXN_HAS_SNAPSHOT)) {
+		txn->snap_min = ckpt_txn->snap_min;
+		txn->snap_max = ckpt_txn->snap_max;
+		if ((txn->snapshot_count = ckpt_txn->snapshot_count) != 0)
+			memcpy(txn->snapshot, ckpt_txn->snapshot,
+			    ckpt_txn->snapshot_count *
+			    sizeof(*ckpt_txn->snapshot));
+		F_SET(txn, WT_TXN_HAS_SNAPSHOT);
+
+		/* The snapshot array no longer holds a scan. */
+		txn->snapshot_current = WT_TXN_NONE;
+	}
+
+	WT_WITH_DHANDLE(session, dhandle,
+	    ret = __wt_reconcile(session, ref, NULL, WT_CHECKPOINTING));
+
+	F_CLR(txn, WT_TXN_HAS_SNAPSHOT);
+	txn->isolation = session->isolation;
+
+	if (ret == 0)
+		WT_STAT_FAST_CONN_INCR(session, txn_checkpoint_threads_pages);
+	return (ret);
+}
+
+/*
+ * __wt_sync_thread_run --
+ *	Entry function for a checkpoint thread.
+ */
+int
+__wt_sync_thread_run(WT_SESSION_IMPL *session, WT_THREAD *thread)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DATA_HANDLE *dhandle;
+	WT_DECL_RET;
+	WT_REF *ref;
+	WT_SESSION_IMPL *ckpt_session;
+
+	conn = S2C(session);
+
+	while (F_ISSET(thread, WT_THREAD_RUN)) {
+		if ((ref = __sync_rec_pop(
+		    session, &ckpt_session, &dhandle)) == NULL) {
+			__wt_cond_wait(
+			    session, conn->ckpt_threads.wait_cond, 100000);
+			continue;
+		}
+
+		/* Errors are returned to the checkpoint. */
+		ret = __sync_rec_thread_page(
+		    session, ckpt_session, dhandle, ref);
+		__sync_rec_done(session, ret);
+		if (ret == WT_PANIC)
+			return (ret);
+	}
+
+	return (0);
+}
+
+/*
+ * __sync_rec_wait --
+ *	Finish the checkpoint's batch of leaf pages and release them.
+ */
+static int
+__sync_rec_wait(WT_SESSION_IMPL *session, uint32_t flags)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_REF *ref;
+	uint32_t i;
+
+	conn = S2C(session);
+
+	if (conn->ckpt_rec_count == 0)
+		return (0);
+
+	/*
+	 * Help with the batch rather than waiting: the threads may be busy
+	 * elsewhere, or reconfigured away.
+	 */
+	while ((ref = __sync_rec_pop(session, NULL, NULL)) != NULL)
+		__sync_rec_done(session,
+		    __wt_reconcile(session, ref, NULL, WT_CHECKPOINTING));
+	while (conn->ckpt_rec_done < conn->ckpt_rec_count)
+		__wt_cond_wait(session, conn->ckpt_rec_cond, 10000);
+
+	ret = conn->ckpt_rec_ret;
+	for (i = 0; i < conn->ckpt_rec_count; ++i) {
+		WT_TRET(__wt_page_release(
+		    session, conn->ckpt_rec_batch[i], flags));
+		conn->ckpt_rec_batch[i] = NULL;
+	}
+
+	__wt_spin_lock(session, &conn->ckpt_rec_lock);
+	conn->ckpt_rec_count = conn->ckpt_rec_next = conn->ckpt_rec_done = 0;
+	conn->ckpt_rec_ret = 0;
+	__wt_spin_unlock(session, &conn->ckpt_rec_lock);
+
+	return (ret);
+}
+
+/*
+ * __sync_rec_push --
+ *	Add a leaf page to the checkpoint's batch.
+ */
+static int
+__sync_rec_push(WT_SESSION_IMPL *session, WT_REF *ref, uint32_t flags)
+{
+	WT_CONNECTION_IMPL *conn;
+	uint32_t count, max;
+
+	conn = S2C(session);
+
+	/*
+	 * Pin the page for the batch, the tree walk is about to release its
+	 * hazard pointer.
+	 */
+	WT_RET(__wt_page_in(session, ref, flags));
+
+	__wt_spin_lock(session, &conn->ckpt_rec_lock);
+	conn->ckpt_rec_batch[conn->ckpt_rec_count] = ref;
+	count = ++conn->ckpt_rec_count;
+	__wt_spin_unlock(session, &conn->ckpt_rec_lock);
+
+	__wt_cond_signal(session, conn->ckpt_threads.wait_cond);
+
+	/* Hazard pointers are limited, don't use more than half of them. */
+	max = WT_MIN(WT_CKPT_REC_BATCH, conn->hazard_max / 2);
+	return (count < max ? 0 : __sync_rec_wait(session, flags));
+}
+
 /*
  * __sync_file --
  *	Flush pages for a specific file.
@@ -24,12 +242,14 @@ __sync_file(WT_SESSION_IMPL *session, WT_CACHE_OP syncop)
 	WT_REF *walk;
 	WT_TXN *txn;
 	uint64_t internal_bytes, internal_pages, leaf_bytes, leaf_pages;
-	uint64_t oldest_id, saved_snap_min;
+	uint64_t oldest_id, page_bytes, saved_snap_min;
 	uint32_t flags;
+	bool parallel;
 
 	conn = S2C(session);
 	btree = S2BT(session);
 	walk = NULL;
+	parallel = false;
 	txn = &session->txn;
 	saved_snap_min = WT_SESSION_TXN_STATE(session)->snap_min;
 	flags = WT_READ_CACHE | WT_READ_NO_GEN;
@@ -142,6 +362,20 @@ __sync_file(WT_SESSION_IMPL *session, WT_CACHE_OP syncop)
 
 		WT_PUBLISH(btree->checkpointing, WT_CKPT_RUNNING);
 
+		/*
+		 * Hand the leaf pages to the checkpoint threads if they're
+		 * configured and no other checkpoint is using them.  Not for
+		 * the metadata, it holds the checkpoint's own updates, which
+		 * only the checkpoint may write.
+		 */
+		if (conn->ckpt_threads_running && conn->ckpt_threads_cfg != 0 &&
+		    !WT_IS_METADATA(session, session->dhandle) &&
+		    __wt_atomic_cas_ptr(
+		    &conn->ckpt_rec_session, NULL, session)) {
+			conn->ckpt_rec_dhandle = session->dhandle;
+			parallel = true;
+		}
+
 		/* Write all dirty in-cache pages. */
 		flags |= WT_READ_NO_EVICT;
 		for (walk = NULL;;) {
@@ -187,16 +421,32 @@ __sync_file(WT_SESSION_IMPL *session, WT_CACHE_OP syncop)
 				continue;
 			}
 
+			page_bytes = page->memory_footprint;
 			if (WT_PAGE_IS_INTERNAL(page)) {
-				internal_bytes += page->memory_footprint;
+				internal_bytes += page_bytes;
 				++internal_pages;
 			} else {
-				leaf_bytes += page->memory_footprint;
+				leaf_bytes += page_bytes;
 				++leaf_pages;
 			}
-			WT_ERR(__wt_reconcile(
-			    session, walk, NULL, WT_CHECKPOINTING));
+
+			/*
+			 * Internal pages follow their children in the walk,
+			 * finish any batch before writing one.
+			 */
+			if (parallel && !WT_PAGE_IS_INTERNAL(page) &&
+			    !__wt_ref_is_root(walk))
+				WT_ERR(__sync_rec_push(session, walk, flags));
+			else {
+				if (parallel)
+					WT_ERR(__sync_rec_wait(session, flags));
+				WT_ERR(__wt_reconcile(
+				    session, walk, NULL, WT_CHECKPOINTING));
+			}
+			WT_ERR(__wt_checkpoint_pace(session, page_bytes));
 		}
+		if (parallel)
+			WT_ERR(__sync_rec_wait(session, flags));
 		break;
 	case WT_SYNC_CLOSE:
 	case WT_SYNC_DISCARD:
@@ -217,9 +467,13 @@ __sync_file(WT_SESSION_IMPL *session, WT_CACHE_OP syncop)
 		    WT_TIMEDIFF_MS(end, start));
 	}
 
-err:	/* On error, clear any left-over tree walk. */
+err:	/* On error, clear any left-over tree walk and batch. */
 	if (walk != NULL)
 		WT_TRET(__wt_page_release(session, walk, flags));
+	if (parallel) {
+		WT_TRET(__sync_rec_wait(session, flags));
+		WT_PUBLISH(conn->ckpt_rec_session, NULL);
+	}
 
 	/*
 	 * If we got a snapshot in order to write pages, and there was no
@@ -199,6 +199,74 @@ __check_leaf_key_range(WT_SESSION_IMPL *session,
 	return (0);
 }
 
+/*
+ * __search_leaf_prefix --
+ *	Narrow the binary search of a row-store leaf page to the keys with the
+ * search key's prefix.
+ */
+static inline void
+__search_leaf_prefix(WT_PAGE *page,
+    WT_ITEM *srch_key, uint32_t *basep, uint32_t *limitp, size_t *skipp)
+{
+	const uint64_t *prefix;
+	uint64_t v;
+	uint32_t entries, half, lower, n, upper;
+	size_t skip;
+	int cmp;
+
+	prefix = page->pg_row_prefix;
+	entries = page->pg_row_entries;
+	skip = page->pg_row_prefix_skip;
+
+	/*
+	 * A search key without the bytes all of the page's keys share sorts
+	 * before or after all of them.
+	 */
+	cmp = memcmp(srch_key->data,
+	    prefix + entries, WT_MIN(skip, srch_key->size));
+	if (cmp == 0 && srch_key->size < skip)
+		cmp = -1;
+	if (cmp != 0) {
+		*basep = cmp < 0 ? 0 : entries;
+		*limitp = 0;
+		*skipp = 0;
+		return;
+	}
+
+	/*
+	 * Find the first prefix not less than the search key's: keys before it
+	 * are smaller than the search key.
+	 */
+	v = __wt_row_leaf_prefix(srch_key->data, srch_key->size, skip);
+	for (lower = 0, n = entries; lower < n;) {
+		half = lower + ((n - lower) >> 1);
+		if (prefix[half] < v)
+			lower = half + 1;
+		else
+			n = half;
+	}
+
+	/*
+	 * Find the first prefix greater than the search key's: keys from it on
+	 * are larger than the search key.  Usually few keys share the search
+	 * key's prefix, gallop forward, then search what's left.
+	 */
+	for (upper = lower, half = 1;
+	    upper < entries && prefix[upper] <= v; half <<= 1)
+		upper += half;
+	for (n = WT_MIN(upper, entries), upper -= half >> 1; upper < n;) {
+		half = upper + ((n - upper) >> 1);
+		if (prefix[half] <= v)
+			upper = half + 1;
+		else
+			n = half;
+	}
+
+	*basep = lower;
+	*limitp = upper - lower;
+	*skipp = skip;
+}
+
 /*
  * __wt_row_search --
  *	Search a row-store tree for a specific key.
@@ -512,6 +580,11 @@ leaf_only:
 	 */
 	base = 0;
 	limit = page->pg_row_entries;
+	if (page->pg_row_prefix != NULL) {
+		__search_leaf_prefix(page, srch_key, &base, &limit, &match);
+		skiplow = WT_MAX(skiplow, match);
+		skiphigh = WT_MAX(skiphigh, match);
+	}
 	if (collator == NULL && srch_key->size <= WT_COMPARE_SHORT_MAXLEN)
 		for (; limit != 0; limit >>= 1) {
 			indx = base + (limit >> 1);
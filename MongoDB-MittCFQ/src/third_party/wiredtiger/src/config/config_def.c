@@ -42,6 +42,10 @@ static const WT_CONFIG_CHECK
 static const WT_CONFIG_CHECK
     confchk_wiredtiger_open_checkpoint_subconfigs[] = {
 	{ "log_size", "int", NULL, "min=0,max=2GB", NULL, 0 },
+	{ "pace_read_latency", "int",
+	    NULL, "min=0,max=10000000",
+	    NULL, 0 },
+	{ "threads", "int", NULL, "min=0,max=64", NULL, 0 },
 	{ "wait", "int", NULL, "min=0,max=100000", NULL, 0 },
 	{ NULL, NULL, NULL, NULL, NULL, 0 }
 };
@@ -80,6 +84,13 @@ static const WT_CONFIG_CHECK
 	{ NULL, NULL, NULL, NULL, NULL, 0 }
 };
 
+static const WT_CONFIG_CHECK
+    confchk_wiredtiger_open_readahead_subconfigs[] = {
+	{ "pages", "int", NULL, "min=0,max=256", NULL, 0 },
+	{ "threads", "int", NULL, "min=1,max=20", NULL, 0 },
+	{ NULL, NULL, NULL, NULL, NULL, 0 }
+};
+
 static const WT_CONFIG_CHECK
     confchk_wiredtiger_open_shared_cache_subconfigs[] = {
 	{ "chunk", "int", NULL, "min=1MB,max=10TB", NULL, 0 },
@@ -108,7 +119,7 @@ static const WT_CONFIG_CHECK confchk_WT_CONNECTION_reconfigure[] = {
 	{ "cache_size", "int", NULL, "min=1MB,max=10TB", NULL, 0 },
 	{ "checkpoint", "category",
 	    NULL, NULL,
-	    confchk_wiredtiger_open_checkpoint_subconfigs, 2 },
+	    confchk_wiredtiger_open_checkpoint_subconfigs, 4 },
 	{ "error_prefix", "string", NULL, NULL, NULL, 0 },
 	{ "eviction", "category",
 	    NULL, NULL,
@@ -134,6 +145,9 @@ static const WT_CONFIG_CHECK confchk_WT_CONNECTION_reconfigure[] = {
 	    NULL, NULL,
 	    confchk_wiredtiger_open_lsm_manager_subconfigs, 2 },
 	{ "lsm_merge", "boolean", NULL, NULL, NULL, 0 },
+	{ "readahead", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_readahead_subconfigs, 2 },
 	{ "shared_cache", "category",
 	    NULL, NULL,
 	    confchk_wiredtiger_open_shared_cache_subconfigs, 5 },
@@ -260,6 +274,7 @@ static const WT_CONFIG_CHECK confchk_WT_SESSION_create[] = {
 	{ "leaf_page_max", "int",
 	    NULL, "min=512B,max=512MB",
 	    NULL, 0 },
+	{ "leaf_search_prefix", "boolean", NULL, NULL, NULL, 0 },
 	{ "leaf_value_max", "int", NULL, "min=0", NULL, 0 },
 	{ "log", "category",
 	    NULL, NULL,
@@ -328,6 +343,7 @@ static const WT_CONFIG_CHECK confchk_WT_SESSION_open_cursor[] = {
 	{ "next_random_sample_size", "string", NULL, NULL, NULL, 0 },
 	{ "overwrite", "boolean", NULL, NULL, NULL, 0 },
 	{ "raw", "boolean", NULL, NULL, NULL, 0 },
+	{ "read_once", "boolean", NULL, NULL, NULL, 0 },
 	{ "readonly", "boolean", NULL, NULL, NULL, 0 },
 	{ "skip_sort_check", "boolean", NULL, NULL, NULL, 0 },
 	{ "statistics", "list",
@@ -426,6 +442,7 @@ static const WT_CONFIG_CHECK confchk_file_config[] = {
 	{ "leaf_page_max", "int",
 	    NULL, "min=512B,max=512MB",
 	    NULL, 0 },
+	{ "leaf_search_prefix", "boolean", NULL, NULL, NULL, 0 },
 	{ "leaf_value_max", "int", NULL, "min=0", NULL, 0 },
 	{ "log", "category",
 	    NULL, NULL,
@@ -484,6 +501,7 @@ static const WT_CONFIG_CHECK confchk_file_meta[] = {
 	{ "leaf_page_max", "int",
 	    NULL, "min=512B,max=512MB",
 	    NULL, 0 },
+	{ "leaf_search_prefix", "boolean", NULL, NULL, NULL, 0 },
 	{ "leaf_value_max", "int", NULL, "min=0", NULL, 0 },
 	{ "log", "category",
 	    NULL, NULL,
@@ -558,6 +576,7 @@ static const WT_CONFIG_CHECK confchk_lsm_meta[] = {
 	{ "leaf_page_max", "int",
 	    NULL, "min=512B,max=512MB",
 	    NULL, 0 },
+	{ "leaf_search_prefix", "boolean", NULL, NULL, NULL, 0 },
 	{ "leaf_value_max", "int", NULL, "min=0", NULL, 0 },
 	{ "log", "category",
 	    NULL, NULL,
@@ -594,6 +613,13 @@ static const WT_CONFIG_CHECK confchk_table_meta[] = {
 	{ NULL, NULL, NULL, NULL, NULL, 0 }
 };
 
+static const WT_CONFIG_CHECK
+    confchk_wiredtiger_open_block_cache_subconfigs[] = {
+	{ "hashsize", "int", NULL, "min=512,max=4194304", NULL, 0 },
+	{ "size", "int", NULL, "min=0,max=10TB", NULL, 0 },
+	{ NULL, NULL, NULL, NULL, NULL, 0 }
+};
+
 static const WT_CONFIG_CHECK
     confchk_wiredtiger_open_encryption_subconfigs[] = {
 	{ "keyid", "string", NULL, NULL, NULL, 0 },
@@ -641,12 +667,15 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open[] = {
 	{ "async", "category",
 	    NULL, NULL,
 	    confchk_wiredtiger_open_async_subconfigs, 3 },
+	{ "block_cache", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_block_cache_subconfigs, 2 },
 	{ "buffer_alignment", "int", NULL, "min=-1,max=1MB", NULL, 0 },
 	{ "cache_overhead", "int", NULL, "min=0,max=30", NULL, 0 },
 	{ "cache_size", "int", NULL, "min=1MB,max=10TB", NULL, 0 },
 	{ "checkpoint", "category",
 	    NULL, NULL,
-	    confchk_wiredtiger_open_checkpoint_subconfigs, 2 },
+	    confchk_wiredtiger_open_checkpoint_subconfigs, 4 },
 	{ "checkpoint_sync", "boolean", NULL, NULL, NULL, 0 },
 	{ "config_base", "boolean", NULL, NULL, NULL, 0 },
 	{ "create", "boolean", NULL, NULL, NULL, 0 },
@@ -690,6 +719,9 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open[] = {
 	{ "lsm_merge", "boolean", NULL, NULL, NULL, 0 },
 	{ "mmap", "boolean", NULL, NULL, NULL, 0 },
 	{ "multiprocess", "boolean", NULL, NULL, NULL, 0 },
+	{ "readahead", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_readahead_subconfigs, 2 },
 	{ "readonly", "boolean", NULL, NULL, NULL, 0 },
 	{ "session_max", "int", NULL, "min=1", NULL, 0 },
 	{ "session_scratch_max", "int", NULL, NULL, NULL, 0 },
@@ -725,12 +757,15 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_all[] = {
 	{ "async", "category",
 	    NULL, NULL,
 	    confchk_wiredtiger_open_async_subconfigs, 3 },
+	{ "block_cache", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_block_cache_subconfigs, 2 },
 	{ "buffer_alignment", "int", NULL, "min=-1,max=1MB", NULL, 0 },
 	{ "cache_overhead", "int", NULL, "min=0,max=30", NULL, 0 },
 	{ "cache_size", "int", NULL, "min=1MB,max=10TB", NULL, 0 },
 	{ "checkpoint", "category",
 	    NULL, NULL,
-	    confchk_wiredtiger_open_checkpoint_subconfigs, 2 },
+	    confchk_wiredtiger_open_checkpoint_subconfigs, 4 },
 	{ "checkpoint_sync", "boolean", NULL, NULL, NULL, 0 },
 	{ "config_base", "boolean", NULL, NULL, NULL, 0 },
 	{ "create", "boolean", NULL, NULL, NULL, 0 },
@@ -774,6 +809,9 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_all[] = {
 	{ "lsm_merge", "boolean", NULL, NULL, NULL, 0 },
 	{ "mmap", "boolean", NULL, NULL, NULL, 0 },
 	{ "multiprocess", "boolean", NULL, NULL, NULL, 0 },
+	{ "readahead", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_readahead_subconfigs, 2 },
 	{ "readonly", "boolean", NULL, NULL, NULL, 0 },
 	{ "session_max", "int", NULL, "min=1", NULL, 0 },
 	{ "session_scratch_max", "int", NULL, NULL, NULL, 0 },
@@ -810,12 +848,15 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_basecfg[] = {
 	{ "async", "category",
 	    NULL, NULL,
 	    confchk_wiredtiger_open_async_subconfigs, 3 },
+	{ "block_cache", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_block_cache_subconfigs, 2 },
 	{ "buffer_alignment", "int", NULL, "min=-1,max=1MB", NULL, 0 },
 	{ "cache_overhead", "int", NULL, "min=0,max=30", NULL, 0 },
 	{ "cache_size", "int", NULL, "min=1MB,max=10TB", NULL, 0 },
 	{ "checkpoint", "category",
 	    NULL, NULL,
-	    confchk_wiredtiger_open_checkpoint_subconfigs, 2 },
+	    confchk_wiredtiger_open_checkpoint_subconfigs, 4 },
 	{ "checkpoint_sync", "boolean", NULL, NULL, NULL, 0 },
 	{ "direct_io", "list",
 	    NULL, "choices=[\"checkpoint\",\"data\",\"log\"]",
@@ -855,6 +896,9 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_basecfg[] = {
 	{ "lsm_merge", "boolean", NULL, NULL, NULL, 0 },
 	{ "mmap", "boolean", NULL, NULL, NULL, 0 },
 	{ "multiprocess", "boolean", NULL, NULL, NULL, 0 },
+	{ "readahead", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_readahead_subconfigs, 2 },
 	{ "readonly", "boolean", NULL, NULL, NULL, 0 },
 	{ "session_max", "int", NULL, "min=1", NULL, 0 },
 	{ "session_scratch_max", "int", NULL, NULL, NULL, 0 },
@@ -889,12 +933,15 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_usercfg[] = {
 	{ "async", "category",
 	    NULL, NULL,
 	    confchk_wiredtiger_open_async_subconfigs, 3 },
+	{ "block_cache", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_block_cache_subconfigs, 2 },
 	{ "buffer_alignment", "int", NULL, "min=-1,max=1MB", NULL, 0 },
 	{ "cache_overhead", "int", NULL, "min=0,max=30", NULL, 0 },
 	{ "cache_size", "int", NULL, "min=1MB,max=10TB", NULL, 0 },
 	{ "checkpoint", "category",
 	    NULL, NULL,
-	    confchk_wiredtiger_open_checkpoint_subconfigs, 2 },
+	    confchk_wiredtiger_open_checkpoint_subconfigs, 4 },
 	{ "checkpoint_sync", "boolean", NULL, NULL, NULL, 0 },
 	{ "direct_io", "list",
 	    NULL, "choices=[\"checkpoint\",\"data\",\"log\"]",
@@ -934,6 +981,9 @@ static const WT_CONFIG_CHECK confchk_wiredtiger_open_usercfg[] = {
 	{ "lsm_merge", "boolean", NULL, NULL, NULL, 0 },
 	{ "mmap", "boolean", NULL, NULL, NULL, 0 },
 	{ "multiprocess", "boolean", NULL, NULL, NULL, 0 },
+	{ "readahead", "category",
+	    NULL, NULL,
+	    confchk_wiredtiger_open_readahead_subconfigs, 2 },
 	{ "readonly", "boolean", NULL, NULL, NULL, 0 },
 	{ "session_max", "int", NULL, "min=1", NULL, 0 },
 	{ "session_scratch_max", "int", NULL, NULL, NULL, 0 },
@@ -1003,18 +1053,19 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	},
 	{ "WT_CONNECTION.reconfigure",
 	  "async=(enabled=false,ops_max=1024,threads=2),cache_overhead=8,"
-	  "cache_size=100MB,checkpoint=(log_size=0,wait=0),error_prefix=,"
-	  "eviction=(threads_max=1,threads_min=1),"
-	  "eviction_checkpoint_target=15,eviction_dirty_target=5,"
-	  "eviction_dirty_trigger=20,eviction_target=80,eviction_trigger=95"
-	  ",file_manager=(close_handle_minimum=250,close_idle_time=30,"
+	  "cache_size=100MB,checkpoint=(log_size=0,pace_read_latency=0,"
+	  "threads=0,wait=0),error_prefix=,eviction=(threads_max=1,"
+	  "threads_min=1),eviction_checkpoint_target=15,"
+	  "eviction_dirty_target=5,eviction_dirty_trigger=20,"
+	  "eviction_target=80,eviction_trigger=95,"
+	  "file_manager=(close_handle_minimum=250,close_idle_time=30,"
 	  "close_scan_interval=10),log=(archive=true,prealloc=true,"
 	  "zero_fill=false),lsm_manager=(merge=true,worker_thread_max=4),"
-	  "lsm_merge=true,shared_cache=(chunk=10MB,name=,quota=0,reserve=0,"
-	  "size=500MB),statistics=none,statistics_log=(json=false,"
-	  "on_close=false,sources=,timestamp=\"%b %d %H:%M:%S\",wait=0),"
-	  "verbose=",
-	  confchk_WT_CONNECTION_reconfigure, 19
+	  "lsm_merge=true,readahead=(pages=0,threads=2),"
+	  "shared_cache=(chunk=10MB,name=,quota=0,reserve=0,size=500MB),"
+	  "statistics=none,statistics_log=(json=false,on_close=false,"
+	  "sources=,timestamp=\"%b %d %H:%M:%S\",wait=0),verbose=",
+	  confchk_WT_CONNECTION_reconfigure, 20
 	},
 	{ "WT_CONNECTION.set_file_system",
 	  "",
@@ -1056,15 +1107,15 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	  "huffman_value=,immutable=false,internal_item_max=0,"
 	  "internal_key_max=0,internal_key_truncate=true,"
 	  "internal_page_max=4KB,key_format=u,key_gap=10,leaf_item_max=0,"
-	  "leaf_key_max=0,leaf_page_max=32KB,leaf_value_max=0,"
-	  "log=(enabled=true),lsm=(auto_throttle=true,bloom=true,"
-	  "bloom_bit_count=16,bloom_config=,bloom_hash_count=8,"
+	  "leaf_key_max=0,leaf_page_max=32KB,leaf_search_prefix=false,"
+	  "leaf_value_max=0,log=(enabled=true),lsm=(auto_throttle=true,"
+	  "bloom=true,bloom_bit_count=16,bloom_config=,bloom_hash_count=8,"
 	  "bloom_oldest=false,chunk_count_limit=0,chunk_max=5GB,"
 	  "chunk_size=10MB,merge_max=15,merge_min=0),memory_page_max=5MB,"
 	  "os_cache_dirty_max=0,os_cache_max=0,prefix_compression=false,"
 	  "prefix_compression_min=4,source=,split_deepen_min_child=0,"
 	  "split_deepen_per_child=0,split_pct=75,type=file,value_format=u",
-	  confchk_WT_SESSION_create, 40
+	  confchk_WT_SESSION_create, 41
 	},
 	{ "WT_SESSION.drop",
 	  "checkpoint_wait=true,force=false,lock_wait=true,"
@@ -1087,9 +1138,9 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	{ "WT_SESSION.open_cursor",
 	  "append=false,bulk=false,checkpoint=,checkpoint_wait=true,dump=,"
 	  "next_random=false,next_random_sample_size=0,overwrite=true,"
-	  "raw=false,readonly=false,skip_sort_check=false,statistics=,"
-	  "target=",
-	  confchk_WT_SESSION_open_cursor, 13
+	  "raw=false,read_once=false,readonly=false,skip_sort_check=false,"
+	  "statistics=,target=",
+	  confchk_WT_SESSION_open_cursor, 14
 	},
 	{ "WT_SESSION.rebalance",
 	  "",
@@ -1151,12 +1202,12 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	  "format=btree,huffman_key=,huffman_value=,internal_item_max=0,"
 	  "internal_key_max=0,internal_key_truncate=true,"
 	  "internal_page_max=4KB,key_format=u,key_gap=10,leaf_item_max=0,"
-	  "leaf_key_max=0,leaf_page_max=32KB,leaf_value_max=0,"
-	  "log=(enabled=true),memory_page_max=5MB,os_cache_dirty_max=0,"
-	  "os_cache_max=0,prefix_compression=false,prefix_compression_min=4"
-	  ",split_deepen_min_child=0,split_deepen_per_child=0,split_pct=75,"
-	  "value_format=u",
-	  confchk_file_config, 33
+	  "leaf_key_max=0,leaf_page_max=32KB,leaf_search_prefix=false,"
+	  "leaf_value_max=0,log=(enabled=true),memory_page_max=5MB,"
+	  "os_cache_dirty_max=0,os_cache_max=0,prefix_compression=false,"
+	  "prefix_compression_min=4,split_deepen_min_child=0,"
+	  "split_deepen_per_child=0,split_pct=75,value_format=u",
+	  confchk_file_config, 34
 	},
 	{ "file.meta",
 	  "allocation_size=4KB,app_metadata=,block_allocation=best,"
@@ -1166,12 +1217,12 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	  ",huffman_value=,id=,internal_item_max=0,internal_key_max=0,"
 	  "internal_key_truncate=true,internal_page_max=4KB,key_format=u,"
 	  "key_gap=10,leaf_item_max=0,leaf_key_max=0,leaf_page_max=32KB,"
-	  "leaf_value_max=0,log=(enabled=true),memory_page_max=5MB,"
-	  "os_cache_dirty_max=0,os_cache_max=0,prefix_compression=false,"
-	  "prefix_compression_min=4,split_deepen_min_child=0,"
-	  "split_deepen_per_child=0,split_pct=75,value_format=u,"
-	  "version=(major=0,minor=0)",
-	  confchk_file_meta, 37
+	  "leaf_search_prefix=false,leaf_value_max=0,log=(enabled=true),"
+	  "memory_page_max=5MB,os_cache_dirty_max=0,os_cache_max=0,"
+	  "prefix_compression=false,prefix_compression_min=4,"
+	  "split_deepen_min_child=0,split_deepen_per_child=0,split_pct=75,"
+	  "value_format=u,version=(major=0,minor=0)",
+	  confchk_file_meta, 38
 	},
 	{ "index.meta",
 	  "app_metadata=,collator=,columns=,extractor=,immutable=false,"
@@ -1186,15 +1237,16 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	  "internal_item_max=0,internal_key_max=0,"
 	  "internal_key_truncate=true,internal_page_max=4KB,key_format=u,"
 	  "key_gap=10,last=,leaf_item_max=0,leaf_key_max=0,"
-	  "leaf_page_max=32KB,leaf_value_max=0,log=(enabled=true),"
-	  "lsm=(auto_throttle=true,bloom=true,bloom_bit_count=16,"
-	  "bloom_config=,bloom_hash_count=8,bloom_oldest=false,"
-	  "chunk_count_limit=0,chunk_max=5GB,chunk_size=10MB,merge_max=15,"
-	  "merge_min=0),memory_page_max=5MB,old_chunks=,"
-	  "os_cache_dirty_max=0,os_cache_max=0,prefix_compression=false,"
-	  "prefix_compression_min=4,split_deepen_min_child=0,"
-	  "split_deepen_per_child=0,split_pct=75,value_format=u",
-	  confchk_lsm_meta, 37
+	  "leaf_page_max=32KB,leaf_search_prefix=false,leaf_value_max=0,"
+	  "log=(enabled=true),lsm=(auto_throttle=true,bloom=true,"
+	  "bloom_bit_count=16,bloom_config=,bloom_hash_count=8,"
+	  "bloom_oldest=false,chunk_count_limit=0,chunk_max=5GB,"
+	  "chunk_size=10MB,merge_max=15,merge_min=0),memory_page_max=5MB,"
+	  "old_chunks=,os_cache_dirty_max=0,os_cache_max=0,"
+	  "prefix_compression=false,prefix_compression_min=4,"
+	  "split_deepen_min_child=0,split_deepen_per_child=0,split_pct=75,"
+	  "value_format=u",
+	  confchk_lsm_meta, 38
 	},
 	{ "table.meta",
 	  "app_metadata=,colgroups=,collator=,columns=,key_format=u,"
@@ -1202,92 +1254,100 @@ static const WT_CONFIG_ENTRY config_entries[] = {
 	  confchk_table_meta, 6
 	},
 	{ "wiredtiger_open",
-	  "async=(enabled=false,ops_max=1024,threads=2),buffer_alignment=-1"
-	  ",cache_overhead=8,cache_size=100MB,checkpoint=(log_size=0,"
-	  "wait=0),checkpoint_sync=true,config_base=true,create=false,"
-	  "direct_io=,encryption=(keyid=,name=,secretkey=),error_prefix=,"
-	  "eviction=(threads_max=1,threads_min=1),"
-	  "eviction_checkpoint_target=15,eviction_dirty_target=5,"
-	  "eviction_dirty_trigger=20,eviction_target=80,eviction_trigger=95"
-	  ",exclusive=false,extensions=,file_extend=,"
-	  "file_manager=(close_handle_minimum=250,close_idle_time=30,"
-	  "close_scan_interval=10),hazard_max=1000,in_memory=false,"
-	  "log=(archive=true,compressor=,enabled=false,file_max=100MB,"
-	  "path=\".\",prealloc=true,recover=on,zero_fill=false),"
-	  "lsm_manager=(merge=true,worker_thread_max=4),lsm_merge=true,"
-	  "mmap=true,multiprocess=false,readonly=false,session_max=100,"
+	  "async=(enabled=false,ops_max=1024,threads=2),"
+	  "block_cache=(hashsize=32768,size=0),buffer_alignment=-1,"
+	  "cache_overhead=8,cache_size=100MB,checkpoint=(log_size=0,"
+	  "pace_read_latency=0,threads=0,wait=0),checkpoint_sync=true,"
+	  "config_base=true,create=false,direct_io=,encryption=(keyid=,"
+	  "name=,secretkey=),error_prefix=,eviction=(threads_max=1,"
+	  "threads_min=1),eviction_checkpoint_target=15,"
+	  "eviction_dirty_target=5,eviction_dirty_trigger=20,"
+	  "eviction_target=80,eviction_trigger=95,exclusive=false,"
+	  "extensions=,file_extend=,file_manager=(close_handle_minimum=250,"
+	  "close_idle_time=30,close_scan_interval=10),hazard_max=1000,"
+	  "in_memory=false,log=(archive=true,compressor=,enabled=false,"
+	  "file_max=100MB,path=\".\",prealloc=true,recover=on,"
+	  "zero_fill=false),lsm_manager=(merge=true,worker_thread_max=4),"
+	  "lsm_merge=true,mmap=true,multiprocess=false,readahead=(pages=0,"
+	  "threads=2),readonly=false,session_max=100,"
 	  "session_scratch_max=2MB,shared_cache=(chunk=10MB,name=,quota=0,"
 	  "reserve=0,size=500MB),statistics=none,statistics_log=(json=false"
 	  ",on_close=false,path=\".\",sources=,timestamp=\"%b %d %H:%M:%S\""
 	  ",wait=0),transaction_sync=(enabled=false,method=fsync),"
 	  "use_environment=true,use_environment_priv=false,verbose=,"
 	  "write_through=",
-	  confchk_wiredtiger_open, 39
+	  confchk_wiredtiger_open, 41
 	},
 	{ "wiredtiger_open_all",
-	  "async=(enabled=false,ops_max=1024,threads=2),buffer_alignment=-1"
-	  ",cache_overhead=8,cache_size=100MB,checkpoint=(log_size=0,"
-	  "wait=0),checkpoint_sync=true,config_base=true,create=false,"
-	  "direct_io=,encryption=(keyid=,name=,secretkey=),error_prefix=,"
-	  "eviction=(threads_max=1,threads_min=1),"
-	  "eviction_checkpoint_target=15,eviction_dirty_target=5,"
-	  "eviction_dirty_trigger=20,eviction_target=80,eviction_trigger=95"
-	  ",exclusive=false,extensions=,file_extend=,"
-	  "file_manager=(close_handle_minimum=250,close_idle_time=30,"
-	  "close_scan_interval=10),hazard_max=1000,in_memory=false,"
-	  "log=(archive=true,compressor=,enabled=false,file_max=100MB,"
-	  "path=\".\",prealloc=true,recover=on,zero_fill=false),"
-	  "lsm_manager=(merge=true,worker_thread_max=4),lsm_merge=true,"
-	  "mmap=true,multiprocess=false,readonly=false,session_max=100,"
+	  "async=(enabled=false,ops_max=1024,threads=2),"
+	  "block_cache=(hashsize=32768,size=0),buffer_alignment=-1,"
+	  "cache_overhead=8,cache_size=100MB,checkpoint=(log_size=0,"
+	  "pace_read_latency=0,threads=0,wait=0),checkpoint_sync=true,"
+	  "config_base=true,create=false,direct_io=,encryption=(keyid=,"
+	  "name=,secretkey=),error_prefix=,eviction=(threads_max=1,"
+	  "threads_min=1),eviction_checkpoint_target=15,"
+	  "eviction_dirty_target=5,eviction_dirty_trigger=20,"
+	  "eviction_target=80,eviction_trigger=95,exclusive=false,"
+	  "extensions=,file_extend=,file_manager=(close_handle_minimum=250,"
+	  "close_idle_time=30,close_scan_interval=10),hazard_max=1000,"
+	  "in_memory=false,log=(archive=true,compressor=,enabled=false,"
+	  "file_max=100MB,path=\".\",prealloc=true,recover=on,"
+	  "zero_fill=false),lsm_manager=(merge=true,worker_thread_max=4),"
+	  "lsm_merge=true,mmap=true,multiprocess=false,readahead=(pages=0,"
+	  "threads=2),readonly=false,session_max=100,"
 	  "session_scratch_max=2MB,shared_cache=(chunk=10MB,name=,quota=0,"
 	  "reserve=0,size=500MB),statistics=none,statistics_log=(json=false"
 	  ",on_close=false,path=\".\",sources=,timestamp=\"%b %d %H:%M:%S\""
 	  ",wait=0),transaction_sync=(enabled=false,method=fsync),"
 	  "use_environment=true,use_environment_priv=false,verbose=,"
 	  "version=(major=0,minor=0),write_through=",
-	  confchk_wiredtiger_open_all, 40
+	  confchk_wiredtiger_open_all, 42
 	},
 	{ "wiredtiger_open_basecfg",
-	  "async=(enabled=false,ops_max=1024,threads=2),buffer_alignment=-1"
-	  ",cache_overhead=8,cache_size=100MB,checkpoint=(log_size=0,"
-	  "wait=0),checkpoint_sync=true,direct_io=,encryption=(keyid=,name="
-	  ",secretkey=),error_prefix=,eviction=(threads_max=1,"
-	  "threads_min=1),eviction_checkpoint_target=15,"
-	  "eviction_dirty_target=5,eviction_dirty_trigger=20,"
-	  "eviction_target=80,eviction_trigger=95,extensions=,file_extend=,"
-	  "file_manager=(close_handle_minimum=250,close_idle_time=30,"
-	  "close_scan_interval=10),hazard_max=1000,log=(archive=true,"
-	  "compressor=,enabled=false,file_max=100MB,path=\".\","
-	  "prealloc=true,recover=on,zero_fill=false),"
+	  "async=(enabled=false,ops_max=1024,threads=2),"
+	  "block_cache=(hashsize=32768,size=0),buffer_alignment=-1,"
+	  "cache_overhead=8,cache_size=100MB,checkpoint=(log_size=0,"
+	  "pace_read_latency=0,threads=0,wait=0),checkpoint_sync=true,"
+	  "direct_io=,encryption=(keyid=,name=,secretkey=),error_prefix=,"
+	  "eviction=(threads_max=1,threads_min=1),"
+	  "eviction_checkpoint_target=15,eviction_dirty_target=5,"
+	  "eviction_dirty_trigger=20,eviction_target=80,eviction_trigger=95"
+	  ",extensions=,file_extend=,file_manager=(close_handle_minimum=250"
+	  ",close_idle_time=30,close_scan_interval=10),hazard_max=1000,"
+	  "log=(archive=true,compressor=,enabled=false,file_max=100MB,"
+	  "path=\".\",prealloc=true,recover=on,zero_fill=false),"
 	  "lsm_manager=(merge=true,worker_thread_max=4),lsm_merge=true,"
-	  "mmap=true,multiprocess=false,readonly=false,session_max=100,"
-	  "session_scratch_max=2MB,shared_cache=(chunk=10MB,name=,quota=0,"
-	  "reserve=0,size=500MB),statistics=none,statistics_log=(json=false"
-	  ",on_close=false,path=\".\",sources=,timestamp=\"%b %d %H:%M:%S\""
-	  ",wait=0),transaction_sync=(enabled=false,method=fsync),verbose=,"
+	  "mmap=true,multiprocess=false,readahead=(pages=0,threads=2),"
+	  "readonly=false,session_max=100,session_scratch_max=2MB,"
+	  "shared_cache=(chunk=10MB,name=,quota=0,reserve=0,size=500MB),"
+	  "statistics=none,statistics_log=(json=false,on_close=false,"
+	  "path=\".\",sources=,timestamp=\"%b %d %H:%M:%S\",wait=0),"
+	  "transaction_sync=(enabled=false,method=fsync),verbose=,"
 	  "version=(major=0,minor=0),write_through=",
-	  confchk_wiredtiger_open_basecfg, 34
+	  confchk_wiredtiger_open_basecfg, 36
 	},
 	{ "wiredtiger_open_usercfg",
-	  "async=(enabled=false,ops_max=1024,threads=2),buffer_alignment=-1"
-	  ",cache_overhead=8,cache_size=100MB,checkpoint=(log_size=0,"
-	  "wait=0),checkpoint_sync=true,direct_io=,encryption=(keyid=,name="
-	  ",secretkey=),error_prefix=,eviction=(threads_max=1,"
-	  "threads_min=1),eviction_checkpoint_target=15,"
-	  "eviction_dirty_target=5,eviction_dirty_trigger=20,"
-	  "eviction_target=80,eviction_trigger=95,extensions=,file_extend=,"
-	  "file_manager=(close_handle_minimum=250,close_idle_time=30,"
-	  "close_scan_interval=10),hazard_max=1000,log=(archive=true,"
-	  "compressor=,enabled=false,file_max=100MB,path=\".\","
-	  "prealloc=true,recover=on,zero_fill=false),"
+	  "async=(enabled=false,ops_max=1024,threads=2),"
+	  "block_cache=(hashsize=32768,size=0),buffer_alignment=-1,"
+	  "cache_overhead=8,cache_size=100MB,checkpoint=(log_size=0,"
+	  "pace_read_latency=0,threads=0,wait=0),checkpoint_sync=true,"
+	  "direct_io=,encryption=(keyid=,name=,secretkey=),error_prefix=,"
+	  "eviction=(threads_max=1,threads_min=1),"
+	  "eviction_checkpoint_target=15,eviction_dirty_target=5,"
+	  "eviction_dirty_trigger=20,eviction_target=80,eviction_trigger=95"
+	  ",extensions=,file_extend=,file_manager=(close_handle_minimum=250"
+	  ",close_idle_time=30,close_scan_interval=10),hazard_max=1000,"
+	  "log=(archive=true,compressor=,enabled=false,file_max=100MB,"
+	  "path=\".\",prealloc=true,recover=on,zero_fill=false),"
 	  "lsm_manager=(merge=true,worker_thread_max=4),lsm_merge=true,"
-	  "mmap=true,multiprocess=false,readonly=false,session_max=100,"
-	  "session_scratch_max=2MB,shared_cache=(chunk=10MB,name=,quota=0,"
-	  "reserve=0,size=500MB),statistics=none,statistics_log=(json=false"
-	  ",on_close=false,path=\".\",sources=,timestamp=\"%b %d %H:%M:%S\""
-	  ",wait=0),transaction_sync=(enabled=false,method=fsync),verbose=,"
+	  "mmap=true,multiprocess=false,readahead=(pages=0,threads=2),"
+	  "readonly=false,session_max=100,session_scratch_max=2MB,"
+	  "shared_cache=(chunk=10MB,name=,quota=0,reserve=0,size=500MB),"
+	  "statistics=none,statistics_log=(json=false,on_close=false,"
+	  "path=\".\",sources=,timestamp=\"%b %d %H:%M:%S\",wait=0),"
+	  "transaction_sync=(enabled=false,method=fsync),verbose=,"
 	  "write_through=",
-	  confchk_wiredtiger_open_usercfg, 33
+	  confchk_wiredtiger_open_usercfg, 35
 	},
 	{ NULL, NULL, NULL, 0 }
 };
@@ -40,6 +40,8 @@ __wt_wiredtiger_error(int error)
 		return ("WT_RUN_RECOVERY: recovery must be run to continue");
 	case WT_CACHE_FULL:
 		return ("WT_CACHE_FULL: operation would overflow cache");
+	case WT_READ_BUSY:
+		return ("WT_READ_BUSY: read rejected by the I/O scheduler");
 	}
 
 	/*
@@ -1085,8 +1085,10 @@ __conn_reconfigure(WT_CONNECTION *wt_conn, const char *config)
 	WT_ERR(__wt_async_reconfig(session, cfg));
 	WT_ERR(__wt_cache_config(session, true, cfg));
 	WT_ERR(__wt_checkpoint_server_create(session, cfg));
+	WT_ERR(__wt_checkpoint_threads_config(session, cfg, true));
 	WT_ERR(__wt_logmgr_reconfig(session, cfg));
 	WT_ERR(__wt_lsm_manager_reconfig(session, cfg));
+	WT_ERR(__wt_readahead_config(session, cfg, true));
 	WT_ERR(__wt_statlog_create(session, cfg));
 	WT_ERR(__wt_sweep_config(session, cfg));
 	WT_ERR(__wt_verbose_config(session, cfg));
@@ -2264,7 +2266,10 @@ wiredtiger_open(const char *home, WT_EVENT_HANDLER *event_handler,
 	conn->mmap = cval.val != 0;
 
 	WT_ERR(__conn_statistics_config(session, cfg));
+	WT_ERR(__wt_blkcache_config(session, cfg));
+	WT_ERR(__wt_checkpoint_threads_config(session, cfg, false));
 	WT_ERR(__wt_lsm_manager_config(session, cfg));
+	WT_ERR(__wt_readahead_config(session, cfg, false));
 	WT_ERR(__wt_sweep_config(session, cfg));
 
 	/* Initialize the OS page size for mmap */
@@ -10,6 +10,19 @@
 
 static int __ckpt_server_start(WT_CONNECTION_IMPL *);
 
+/*
+ * Paced checkpoint writes have to finish within this percentage of the wait
+ * interval, the write rate is adjusted this often, and a single delay is never
+ * longer than this.
+ */
+#define	WT_CKPT_PACE_BUDGET	80
+#define	WT_CKPT_PACE_SAMPLE	(100 * WT_THOUSAND)
+#define	WT_CKPT_PACE_SLEEP_MAX	(100 * WT_THOUSAND)
+
+/* Bounds on the target write rate, in bytes per second. */
+#define	WT_CKPT_PACE_RATE_MIN	WT_MEGABYTE
+#define	WT_CKPT_PACE_RATE_MAX	(10 * (uint64_t)WT_GIGABYTE)
+
 /*
  * __ckpt_server_config --
  *	Parse and setup the checkpoint server options.
@@ -30,6 +43,10 @@ __ckpt_server_config(WT_SESSION_IMPL *session, const char **cfg, bool *startp)
 	WT_RET(__wt_config_gets(session, cfg, "checkpoint.log_size", &cval));
 	conn->ckpt_logsize = (wt_off_t)cval.val;
 
+	WT_RET(__wt_config_gets(
+	    session, cfg, "checkpoint.pace_read_latency", &cval));
+	conn->ckpt_pace_read_latency = (uint64_t)cval.val;
+
 	/*
 	 * The checkpoint configuration requires a wait time and/or a log size,
 	 * if neither is set, we're not running at all. Checkpoints based on log
@@ -73,6 +90,7 @@ __ckpt_server(void *arg)
 	WT_DECL_RET;
 	WT_SESSION *wt_session;
 	WT_SESSION_IMPL *session;
+	uint64_t wait;
 
 	session = arg;
 	conn = S2C(session);
@@ -84,8 +102,15 @@ __ckpt_server(void *arg)
 		 * Wait...
 		 * NOTE: If the user only configured logsize, then usecs
 		 * will be 0 and this wait won't return until signalled.
+		 *
+		 * Paced writes are deliberately spread over the interval,
+		 * don't let them push the next checkpoint back.
 		 */
-		__wt_cond_wait(session, conn->ckpt_cond, conn->ckpt_usecs);
+		wait = conn->ckpt_usecs;
+		if (wait != 0)
+			wait -= WT_MIN(conn->ckpt_pace_usecs,
+			    wait * WT_CKPT_PACE_BUDGET / 100);
+		__wt_cond_wait(session, conn->ckpt_cond, wait);
 
 		/* Checkpoint the database. */
 		WT_ERR(wt_session->checkpoint(wt_session, NULL));
@@ -219,6 +244,7 @@ __wt_checkpoint_server_destroy(WT_SESSION_IMPL *session)
 	conn->ckpt_tid_set = false;
 	conn->ckpt_cond = NULL;
 	conn->ckpt_usecs = 0;
+	conn->ckpt_pace_usecs = 0;
 
 	return (ret);
 }
@@ -239,3 +265,291 @@ __wt_checkpoint_signal(WT_SESSION_IMPL *session, wt_off_t logsize)
 		conn->ckpt_signalled = true;
 	}
 }
+
+/*
+ * __ckpt_pace_adjust --
+ *	Adjust the target rate for paced checkpoint writes.
+ */
+static void
+__ckpt_pace_adjust(WT_SESSION_IMPL *session, struct timespec *now)
+{
+	WT_CONNECTION_IMPL *conn;
+	uint64_t elapsed, floor, latency, left, rate, reads, usecs;
+
+	conn = S2C(session);
+	rate = conn->ckpt_pace_rate;
+
+	/*
+	 * Back off sharply while application reads are slower than the target,
+	 * speed up gradually while they're not, or while nothing is reading.
+	 */
+	reads = conn->app_read_count - conn->ckpt_pace_reads;
+	usecs = conn->app_read_usecs - conn->ckpt_pace_read_usecs;
+	conn->ckpt_pace_reads += reads;
+	conn->ckpt_pace_read_usecs += usecs;
+	conn->ckpt_pace_sample = *now;
+
+	latency = reads == 0 ? 0 : usecs / reads;
+	WT_STAT_FAST_CONN_SET(
+	    session, txn_checkpoint_pace_read_latency, latency);
+	if (latency > conn->ckpt_pace_read_latency)
+		rate /= 2;
+	else
+		rate += rate / 4;
+	rate = WT_MIN(
+	    WT_MAX(rate, WT_CKPT_PACE_RATE_MIN), WT_CKPT_PACE_RATE_MAX);
+
+	/*
+	 * Whatever the reads look like, write fast enough to finish within the
+	 * budget.  Once the budget is spent, stop pacing altogether.
+	 */
+	elapsed = WT_TIMEDIFF_US(*now, conn->ckpt_pace_start);
+	if (elapsed >= conn->ckpt_pace_budget) {
+		WT_STAT_FAST_CONN_INCR(session, txn_checkpoint_pace_deadline);
+		conn->ckpt_pacing = false;
+		return;
+	}
+	left = conn->ckpt_pace_bytes > conn->ckpt_pace_written ?
+	    conn->ckpt_pace_bytes - conn->ckpt_pace_written : 0;
+	floor = left * WT_MILLION / (conn->ckpt_pace_budget - elapsed);
+	if (rate < floor) {
+		WT_STAT_FAST_CONN_INCR(session, txn_checkpoint_pace_deadline);
+		rate = WT_MIN(floor, WT_CKPT_PACE_RATE_MAX);
+	}
+
+	conn->ckpt_pace_rate = rate;
+	WT_STAT_FAST_CONN_SET(session, txn_checkpoint_pace_rate, rate);
+}
+
+/*
+ * __ckpt_pace_dirty --
+ *	Return if the cache holds enough dirty data for eviction to want to
+ *	write it.
+ */
+static bool
+__ckpt_pace_dirty(WT_SESSION_IMPL *session)
+{
+	WT_CACHE *cache;
+	WT_CONNECTION_IMPL *conn;
+
+	conn = S2C(session);
+	cache = conn->cache;
+
+	return (__wt_cache_dirty_leaf_inuse(cache) >=
+	    (conn->cache_size * cache->eviction_dirty_target) / 100);
+}
+
+/*
+ * __wt_checkpoint_pace_start --
+ *	Start pacing the writes of a periodic checkpoint, if configured.
+ */
+int
+__wt_checkpoint_pace_start(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+
+	conn = S2C(session);
+	conn->ckpt_pacing = false;
+	conn->ckpt_pace_usecs = 0;
+
+	/*
+	 * Only checkpoints done by the checkpoint server have an interval to
+	 * spread their writes over, anyone else asking for a checkpoint is
+	 * waiting for it.
+	 */
+	if (conn->ckpt_pace_read_latency == 0 ||
+	    conn->ckpt_usecs == 0 || session != conn->ckpt_session)
+		return (0);
+
+	WT_RET(__wt_epoch(session, &conn->ckpt_pace_start));
+	conn->ckpt_pace_last = conn->ckpt_pace_sample = conn->ckpt_pace_start;
+	conn->ckpt_pace_budget = conn->ckpt_usecs * WT_CKPT_PACE_BUDGET / 100;
+	conn->ckpt_pace_reads = conn->app_read_count;
+	conn->ckpt_pace_read_usecs = conn->app_read_usecs;
+
+	/*
+	 * Start out spreading the dirty bytes in the cache evenly over the
+	 * budget.  Pages dirtied after the checkpoint started are counted but
+	 * not written, which only makes the estimate err on the fast side.
+	 */
+	conn->ckpt_pace_bytes = __wt_cache_dirty_inuse(conn->cache);
+	conn->ckpt_pace_written = 0;
+	conn->ckpt_pace_rate = WT_MIN(WT_MAX(
+	    conn->ckpt_pace_bytes * WT_MILLION / conn->ckpt_pace_budget,
+	    WT_CKPT_PACE_RATE_MIN), WT_CKPT_PACE_RATE_MAX);
+	WT_STAT_FAST_CONN_SET(
+	    session, txn_checkpoint_pace_rate, conn->ckpt_pace_rate);
+
+	conn->ckpt_pacing = true;
+	return (0);
+}
+
+/*
+ * __wt_checkpoint_pace --
+ *	Delay a paced checkpoint after writing a page, to hold it to the target
+ *	write rate.
+ */
+int
+__wt_checkpoint_pace(WT_SESSION_IMPL *session, uint64_t bytes)
+{
+	struct timespec now;
+	WT_CONNECTION_IMPL *conn;
+	uint64_t delay, since, want;
+
+	conn = S2C(session);
+
+	if (!conn->ckpt_pacing || session != conn->ckpt_session)
+		return (0);
+
+	/* The server is shutting down: finish as quickly as possible. */
+	if (!F_ISSET(conn, WT_CONN_SERVER_CHECKPOINT)) {
+		conn->ckpt_pacing = false;
+		return (0);
+	}
+
+	/*
+	 * Eviction can't write dirty pages of the file being checkpointed, and
+	 * the checkpoint's snapshot keeps updates from being discarded. Once
+	 * dirty data reaches the eviction target, a sleeping checkpoint holds
+	 * up eviction: stop pacing and finish.
+	 */
+	if (__ckpt_pace_dirty(session)) {
+		WT_STAT_FAST_CONN_INCR(session, txn_checkpoint_pace_dirty);
+		conn->ckpt_pacing = false;
+		return (0);
+	}
+
+	conn->ckpt_pace_written += bytes;
+
+	WT_RET(__wt_epoch(session, &now));
+	if (WT_TIMEDIFF_US(now, conn->ckpt_pace_sample) >=
+	    WT_CKPT_PACE_SAMPLE) {
+		__ckpt_pace_adjust(session, &now);
+		if (!conn->ckpt_pacing)
+			return (0);
+	}
+
+	/*
+	 * Sleep for however long the bytes should take at the target rate,
+	 * less the time it took to write them.
+	 */
+	want = bytes * WT_MILLION / conn->ckpt_pace_rate;
+	since = WT_TIMEDIFF_US(now, conn->ckpt_pace_last);
+	if (want > since) {
+		delay = WT_MIN(want - since, WT_CKPT_PACE_SLEEP_MAX);
+		__wt_sleep(0, delay);
+		WT_STAT_FAST_CONN_INCRV(
+		    session, txn_checkpoint_pace_delay, delay);
+		WT_RET(__wt_epoch(session, &now));
+	}
+	conn->ckpt_pace_last = now;
+	return (0);
+}
+
+/*
+ * __wt_checkpoint_pace_end --
+ *	Finish pacing a checkpoint's writes.
+ */
+int
+__wt_checkpoint_pace_end(WT_SESSION_IMPL *session)
+{
+	struct timespec now;
+	WT_CONNECTION_IMPL *conn;
+
+	conn = S2C(session);
+
+	if (conn->ckpt_pace_budget == 0 || session != conn->ckpt_session)
+		return (0);
+
+	/* Remember how long the writes took, the server waits less for it. */
+	WT_RET(__wt_epoch(session, &now));
+	conn->ckpt_pace_usecs = WT_TIMEDIFF_US(now, conn->ckpt_pace_start);
+	conn->ckpt_pacing = false;
+	conn->ckpt_pace_budget = 0;
+	return (0);
+}
+
+/*
+ * __wt_checkpoint_threads_config --
+ *	Configure the checkpoint threads, starting or resizing them on
+ *	reconfiguration.
+ */
+int
+__wt_checkpoint_threads_config(
+    WT_SESSION_IMPL *session, const char *cfg[], bool reconfig)
+{
+	WT_CONFIG_ITEM cval;
+	WT_CONNECTION_IMPL *conn;
+
+	conn = S2C(session);
+
+	WT_RET(__wt_config_gets(session, cfg, "checkpoint.threads", &cval));
+	conn->ckpt_threads_cfg = (uint32_t)cval.val;
+
+	/* At open, the threads are started with the other server threads. */
+	if (!reconfig)
+		return (0);
+
+	/*
+	 * A checkpoint may be using the threads: they're resized rather than
+	 * destroyed, a checkpoint left without threads reconciles its pages
+	 * itself.
+	 */
+	if (conn->ckpt_threads_running)
+		return (__wt_thread_group_resize(session,
+		    &conn->ckpt_threads, conn->ckpt_threads_cfg,
+		    conn->ckpt_threads_cfg, WT_THREAD_PANIC_FAIL));
+	return (__wt_checkpoint_threads_create(session));
+}
+
+/*
+ * __wt_checkpoint_threads_create --
+ *	Start the checkpoint threads, if configured.
+ */
+int
+__wt_checkpoint_threads_create(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+
+	conn = S2C(session);
+
+	/* There are no checkpoints in an in-memory database. */
+	if (conn->ckpt_threads_cfg == 0 || conn->ckpt_threads_running ||
+	    F_ISSET(conn, WT_CONN_IN_MEMORY))
+		return (0);
+
+	if (conn->ckpt_rec_cond == NULL)
+		WT_RET(__wt_cond_alloc(session,
+		    "checkpoint reconcile", false, &conn->ckpt_rec_cond));
+	WT_RET(__wt_thread_group_create(session, &conn->ckpt_threads,
+	    "checkpoint-reconcile", conn->ckpt_threads_cfg,
+	    conn->ckpt_threads_cfg, WT_THREAD_PANIC_FAIL,
+	    __wt_sync_thread_run));
+
+	WT_PUBLISH(conn->ckpt_threads_running, true);
+	return (0);
+}
+
+/*
+ * __wt_checkpoint_threads_destroy --
+ *	Stop the checkpoint threads.
+ */
+int
+__wt_checkpoint_threads_destroy(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+
+	conn = S2C(session);
+
+	if (conn->ckpt_threads_running) {
+		conn->ckpt_threads_running = false;
+
+		__wt_writelock(session, conn->ckpt_threads.lock);
+		WT_TRET(__wt_thread_group_destroy(
+		    session, &conn->ckpt_threads));
+	}
+	WT_TRET(__wt_cond_destroy(session, &conn->ckpt_rec_cond));
+
+	return (ret);
+}
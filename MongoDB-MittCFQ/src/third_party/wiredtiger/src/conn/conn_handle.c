@@ -53,6 +53,8 @@ __wt_connection_init(WT_CONNECTION_IMPL *conn)
 	/* Locks. */
 	WT_RET(__wt_spin_init(session, &conn->api_lock, "api"));
 	WT_RET(__wt_spin_init(session, &conn->checkpoint_lock, "checkpoint"));
+	WT_RET(__wt_spin_init(
+	    session, &conn->ckpt_rec_lock, "checkpoint reconcile"));
 	WT_RET(__wt_spin_init(session, &conn->dhandle_lock, "data handle"));
 	WT_RET(__wt_spin_init(session, &conn->encryptor_lock, "encryptor"));
 	WT_RET(__wt_spin_init(session, &conn->fh_lock, "file list"));
@@ -60,6 +62,7 @@ __wt_connection_init(WT_CONNECTION_IMPL *conn)
 	    &conn->hot_backup_lock, "hot backup"));
 	WT_RET(__wt_spin_init(session, &conn->las_lock, "lookaside table"));
 	WT_RET(__wt_spin_init(session, &conn->metadata_lock, "metadata"));
+	WT_RET(__wt_spin_init(session, &conn->readahead_lock, "readahead"));
 	WT_RET(__wt_spin_init(session, &conn->reconfig_lock, "reconfigure"));
 	WT_RET(__wt_spin_init(session, &conn->schema_lock, "schema"));
 	WT_RET(__wt_spin_init(session, &conn->table_lock, "table creation"));
@@ -135,12 +138,14 @@ __wt_connection_destroy(WT_CONNECTION_IMPL *conn)
 	__wt_spin_destroy(session, &conn->api_lock);
 	__wt_spin_destroy(session, &conn->block_lock);
 	__wt_spin_destroy(session, &conn->checkpoint_lock);
+	__wt_spin_destroy(session, &conn->ckpt_rec_lock);
 	__wt_spin_destroy(session, &conn->dhandle_lock);
 	__wt_spin_destroy(session, &conn->encryptor_lock);
 	__wt_spin_destroy(session, &conn->fh_lock);
 	__wt_rwlock_destroy(session, &conn->hot_backup_lock);
 	__wt_spin_destroy(session, &conn->las_lock);
 	__wt_spin_destroy(session, &conn->metadata_lock);
+	__wt_spin_destroy(session, &conn->readahead_lock);
 	__wt_spin_destroy(session, &conn->reconfig_lock);
 	__wt_spin_destroy(session, &conn->schema_lock);
 	__wt_spin_destroy(session, &conn->table_lock);
@@ -112,11 +112,13 @@ __wt_connection_close(WT_CONNECTION_IMPL *conn)
 	F_CLR(conn, WT_CONN_SERVER_RUN);
 	WT_TRET(__wt_async_destroy(session));
 	WT_TRET(__wt_lsm_manager_destroy(session));
+	WT_TRET(__wt_readahead_destroy(session));
 	WT_TRET(__wt_sweep_destroy(session));
 
 	F_SET(conn, WT_CONN_CLOSING);
 
 	WT_TRET(__wt_checkpoint_server_destroy(session));
+	WT_TRET(__wt_checkpoint_threads_destroy(session));
 	WT_TRET(__wt_statlog_destroy(session, true));
 	WT_TRET(__wt_evict_destroy(session));
 
@@ -155,6 +157,7 @@ __wt_connection_close(WT_CONNECTION_IMPL *conn)
 
 	/* Discard the cache. */
 	WT_TRET(__wt_cache_destroy(session));
+	__wt_blkcache_destroy(session);
 
 	/* Discard transaction state. */
 	__wt_txn_global_destroy(session);
@@ -252,9 +255,15 @@ __wt_connection_workers(WT_SESSION_IMPL *session, const char *cfg[])
 	/* Start the handle sweep thread. */
 	WT_RET(__wt_sweep_create(session));
 
+	/* Start the optional readahead threads. */
+	WT_RET(__wt_readahead_create(session));
+
 	/* Start the optional async threads. */
 	WT_RET(__wt_async_create(session, cfg));
 
+	/* Start the optional checkpoint reconciliation threads. */
+	WT_RET(__wt_checkpoint_threads_create(session));
+
 	/* Start the optional checkpoint thread. */
 	WT_RET(__wt_checkpoint_server_create(session, cfg));
 
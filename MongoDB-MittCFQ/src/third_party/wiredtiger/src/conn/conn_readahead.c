@@ -0,0 +1,373 @@
+/*-
+ * Copyright (c) 2014-2016 MongoDB, Inc.
+ * Copyright (c) 2008-2014 WiredTiger, Inc.
+ *	All rights reserved.
+ *
+ * See the file LICENSE for redistribution information.
+ */
+
+#include "wt_internal.h"
+
+/*
+ * A cursor has to move through this many leaf pages in a row before we
+ * decide it is scanning and start reading ahead of it.
+ */
+#define	WT_READAHEAD_SCAN_MIN	2
+
+/*
+ * __readahead_req_free --
+ *	Discard a readahead request.
+ */
+static void
+__readahead_req_free(WT_SESSION_IMPL *session, WT_READAHEAD_REQ **reqp)
+{
+	WT_READAHEAD_REQ *req;
+
+	if ((req = *reqp) == NULL)
+		return;
+
+	__wt_free(session, req->uri);
+	__wt_buf_free(session, &req->key);
+	__wt_free(session, *reqp);
+}
+
+/*
+ * __readahead_pop --
+ *	Take the oldest request off the queue.
+ */
+static WT_READAHEAD_REQ *
+__readahead_pop(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_READAHEAD_REQ *req;
+
+	conn = S2C(session);
+	req = NULL;
+
+	if (conn->readahead_count == 0)
+		return (NULL);
+
+	__wt_spin_lock(session, &conn->readahead_lock);
+	if (conn->readahead_count > 0) {
+		req = conn->readahead_queue[conn->readahead_head];
+		conn->readahead_queue[conn->readahead_head] = NULL;
+		conn->readahead_head =
+		    (conn->readahead_head + 1) % WT_READAHEAD_QUEUE_MAX;
+		--conn->readahead_count;
+	}
+	__wt_spin_unlock(session, &conn->readahead_lock);
+
+	return (req);
+}
+
+/*
+ * __readahead_push --
+ *	Queue a request to read ahead of a cursor positioned on the given key.
+ */
+static int
+__readahead_push(WT_SESSION_IMPL *session,
+    WT_DATA_HANDLE *dhandle, const WT_ITEM *key, bool prev)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_READAHEAD_REQ *req;
+
+	conn = S2C(session);
+
+	/*
+	 * The request names the file rather than holding the data handle: the
+	 * readahead thread opens its own cursor, so a file closed or dropped
+	 * in the meantime is no concern of ours.
+	 */
+	WT_RET(__wt_calloc_one(session, &req));
+	WT_ERR(__wt_strdup(session, dhandle->name, &req->uri));
+	WT_ERR(__wt_buf_set(session, &req->key, key->data, key->size));
+	req->prev = prev;
+
+	__wt_spin_lock(session, &conn->readahead_lock);
+	if (conn->readahead_count < WT_READAHEAD_QUEUE_MAX) {
+		conn->readahead_queue[(conn->readahead_head +
+		    conn->readahead_count) % WT_READAHEAD_QUEUE_MAX] = req;
+		++conn->readahead_count;
+		req = NULL;
+	}
+	__wt_spin_unlock(session, &conn->readahead_lock);
+
+	if (req == NULL) {
+		WT_STAT_FAST_CONN_INCR(session, cache_read_ahead_queued);
+		__wt_cond_signal(session, conn->readahead_threads.wait_cond);
+		return (0);
+	}
+
+	/* The threads are behind: drop the request, the scan reads inline. */
+	WT_STAT_FAST_CONN_INCR(session, cache_read_ahead_queue_full);
+
+err:	__readahead_req_free(session, &req);
+	return (ret);
+}
+
+/*
+ * __readahead_cache_full --
+ *	Return if reading more pages would push the cache toward eviction.
+ */
+static bool
+__readahead_cache_full(WT_SESSION_IMPL *session)
+{
+	WT_CACHE *cache;
+	WT_CONNECTION_IMPL *conn;
+
+	conn = S2C(session);
+	cache = conn->cache;
+
+	/*
+	 * Stay below the eviction target: pages read ahead must not cost the
+	 * application threads eviction work, or evict the pages the scan is
+	 * about to read.
+	 */
+	return (__wt_cache_bytes_inuse(cache) >=
+	    (conn->cache_size * cache->eviction_target) / 100);
+}
+
+/*
+ * __readahead_walk --
+ *	Read the leaf pages following the request's key into the cache.
+ */
+static int
+__readahead_walk(
+    WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, WT_READAHEAD_REQ *req)
+{
+	WT_DECL_RET;
+	WT_REF *ref;
+	uint32_t flags, i;
+
+	/*
+	 * Don't wait for pages other threads are reading, and don't do any
+	 * eviction work, the point is to stay out of everyone's way.
+	 */
+	flags = WT_READ_AHEAD |
+	    WT_READ_NO_EVICT | WT_READ_NO_WAIT | WT_READ_SKIP_INTL;
+	if (req->prev)
+		LF_SET(WT_READ_PREV);
+
+	WT_WITH_PAGE_INDEX(session,
+	    ret = __wt_row_search(session, &req->key, NULL, cbt, false));
+	WT_RET(ret);
+
+	/* Take over the leaf page the search pinned, the walk releases it. */
+	ref = cbt->ref;
+	cbt->ref = NULL;
+
+	for (i = 0; i < S2C(session)->readahead_pages && ref != NULL; ++i) {
+		if (__readahead_cache_full(session)) {
+			WT_STAT_FAST_CONN_INCR(
+			    session, cache_read_ahead_cache_full);
+			break;
+		}
+		WT_ERR(__wt_tree_walk(session, &ref, flags));
+	}
+
+err:	if (ref != NULL)
+		WT_TRET(__wt_page_release(session, ref, 0));
+	return (ret);
+}
+
+/*
+ * __readahead_run --
+ *	Service a readahead request.
+ */
+static int
+__readahead_run(WT_SESSION_IMPL *session, WT_READAHEAD_REQ *req)
+{
+	WT_CURSOR *cursor;
+	WT_CURSOR_BTREE *cbt;
+	WT_DECL_RET;
+	const char *cfg[] = {
+	    WT_CONFIG_BASE(session, WT_SESSION_open_cursor), NULL };
+
+	WT_RET(__wt_open_cursor(session, req->uri, NULL, cfg, &cursor));
+	cbt = (WT_CURSOR_BTREE *)cursor;
+
+	WT_WITH_BTREE(session, cbt->btree,
+	    ret = __readahead_walk(session, cbt, req));
+
+	WT_TRET(cursor->close(cursor));
+	return (ret);
+}
+
+/*
+ * __wt_readahead_thread_run --
+ *	Entry function for a readahead thread.
+ */
+int
+__wt_readahead_thread_run(WT_SESSION_IMPL *session, WT_THREAD *thread)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_READAHEAD_REQ *req;
+
+	conn = S2C(session);
+
+	while (F_ISSET(thread, WT_THREAD_RUN)) {
+		if ((req = __readahead_pop(session)) == NULL) {
+			__wt_cond_wait(
+			    session, conn->readahead_threads.wait_cond, 100000);
+			continue;
+		}
+
+		ret = __readahead_run(session, req);
+
+		/*
+		 * Readahead is advisory: the file may have been dropped or be
+		 * locked for an exclusive operation, or the key may be gone.
+		 */
+		if (ret == EBUSY || ret == ENOENT || ret == WT_NOTFOUND)
+			ret = 0;
+		if (ret != 0 && ret != WT_PANIC) {
+			__wt_err(session, ret,
+			    "readahead of %s failed, continuing", req->uri);
+			ret = 0;
+		}
+		__readahead_req_free(session, &req);
+		WT_RET(ret);
+	}
+
+	return (0);
+}
+
+/*
+ * __wt_readahead_scan --
+ *	Note a cursor moving to a new leaf page, and queue a readahead request
+ *	if it looks like a scan.
+ */
+void
+__wt_readahead_scan(WT_SESSION_IMPL *session, WT_CURSOR_BTREE *cbt, bool prev)
+{
+	WT_BTREE *btree;
+	WT_CONNECTION_IMPL *conn;
+	uint32_t pages;
+
+	conn = S2C(session);
+	btree = cbt->btree;
+
+	if ((pages = conn->readahead_pages) == 0 || !conn->readahead_running)
+		return;
+
+	/*
+	 * Row-store files only, and not the files WiredTiger scans itself or
+	 * checkpoint handles, which a cursor opened by name can't reach.
+	 */
+	if (btree->type != BTREE_ROW ||
+	    F_ISSET(btree, WT_BTREE_IN_MEMORY | WT_BTREE_LOOKASIDE) ||
+	    WT_IS_METADATA(session, btree->dhandle) ||
+	    btree->dhandle->checkpoint != NULL)
+		return;
+
+	/*
+	 * Not for read-once scans: they discard each page as they leave it, and
+	 * the readahead search starts from the scan's position, so it would
+	 * read the page just discarded back into the cache.
+	 */
+	if (F_ISSET(cbt, WT_CBT_READ_ONCE))
+		return;
+
+	if (cbt->readahead_prev != prev) {
+		cbt->readahead_prev = prev;
+		cbt->readahead_leaves = 0;
+	}
+
+	/*
+	 * Once the cursor has crossed enough leaf pages to count as a scan,
+	 * queue a request each time it has consumed half of the pages read
+	 * ahead of it, so the readahead stays in front of the cursor.
+	 */
+	if (++cbt->readahead_leaves < WT_READAHEAD_SCAN_MIN)
+		return;
+	if ((cbt->readahead_leaves - WT_READAHEAD_SCAN_MIN) %
+	    WT_MAX(pages / 2, 1) != 0)
+		return;
+
+	/* Errors are ignored, the scan reads the pages itself. */
+	(void)__readahead_push(session, btree->dhandle, &cbt->iface.key, prev);
+}
+
+/*
+ * __wt_readahead_config --
+ *	Configure readahead, starting or resizing the threads on
+ *	reconfiguration.
+ */
+int
+__wt_readahead_config(
+    WT_SESSION_IMPL *session, const char *cfg[], bool reconfig)
+{
+	WT_CONFIG_ITEM cval;
+	WT_CONNECTION_IMPL *conn;
+
+	conn = S2C(session);
+
+	WT_RET(__wt_config_gets(session, cfg, "readahead.pages", &cval));
+	conn->readahead_pages = (uint32_t)cval.val;
+	WT_RET(__wt_config_gets(session, cfg, "readahead.threads", &cval));
+	conn->readahead_threads_cfg = (uint32_t)cval.val;
+
+	/* There's nothing to read in an in-memory database. */
+	if (F_ISSET(conn, WT_CONN_IN_MEMORY))
+		conn->readahead_pages = 0;
+
+	/* At open, the threads are started with the other server threads. */
+	if (!reconfig)
+		return (0);
+
+	if (conn->readahead_running)
+		return (__wt_thread_group_resize(session,
+		    &conn->readahead_threads, conn->readahead_threads_cfg,
+		    conn->readahead_threads_cfg, 0));
+	return (__wt_readahead_create(session));
+}
+
+/*
+ * __wt_readahead_create --
+ *	Start the readahead threads, if readahead is configured.
+ */
+int
+__wt_readahead_create(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+
+	conn = S2C(session);
+
+	if (conn->readahead_pages == 0 || conn->readahead_running)
+		return (0);
+
+	WT_RET(__wt_thread_group_create(session, &conn->readahead_threads,
+	    "readahead-server", conn->readahead_threads_cfg,
+	    conn->readahead_threads_cfg, 0, __wt_readahead_thread_run));
+
+	WT_PUBLISH(conn->readahead_running, true);
+	return (0);
+}
+
+/*
+ * __wt_readahead_destroy --
+ *	Stop the readahead threads and discard any queued requests.
+ */
+int
+__wt_readahead_destroy(WT_SESSION_IMPL *session)
+{
+	WT_CONNECTION_IMPL *conn;
+	WT_DECL_RET;
+	WT_READAHEAD_REQ *req;
+
+	conn = S2C(session);
+
+	if (!conn->readahead_running)
+		return (0);
+	conn->readahead_running = false;
+
+	__wt_writelock(session, conn->readahead_threads.lock);
+	WT_TRET(__wt_thread_group_destroy(session, &conn->readahead_threads));
+
+	while ((req = __readahead_pop(session)) != NULL)
+		__readahead_req_free(session, &req);
+
+	return (ret);
+}
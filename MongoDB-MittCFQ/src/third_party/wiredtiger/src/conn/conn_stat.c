@@ -74,6 +74,7 @@ __wt_conn_stat_init(WT_SESSION_IMPL *session)
 	stats = conn->stats;
 
 	__wt_async_stats_update(session);
+	__wt_blkcache_stats_update(session);
 	__wt_cache_stats_update(session);
 	__wt_las_stats_update(session);
 	__wt_txn_stats_update(session);
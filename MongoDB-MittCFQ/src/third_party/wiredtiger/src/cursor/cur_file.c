@@ -482,6 +482,11 @@ __curfile_create(WT_SESSION_IMPL *session,
 			cbt->next_random_sample_size = (u_int)cval.val;
 	}
 
+	/* Scans that shouldn't displace the cache's working set. */
+	WT_ERR(__wt_config_gets_def(session, cfg, "read_once", 0, &cval));
+	if (cval.val != 0)
+		F_SET(cbt, WT_CBT_READ_ONCE);
+
 	/* Underlying btree initialization. */
 	__wt_btcur_open(cbt);
 
@@ -36,7 +36,8 @@
 		if (F_ISSET(&(s)->txn, WT_TXN_RUNNING) &&		\
 		    (ret) != 0 &&					\
 		    (ret) != WT_NOTFOUND &&				\
-		    (ret) != WT_DUPLICATE_KEY)				\
+		    (ret) != WT_DUPLICATE_KEY &&			\
+		    (ret) != WT_READ_BUSY)				\
 			F_SET(&(s)->txn, WT_TXN_ERROR);			\
 	}								\
 } while (0)
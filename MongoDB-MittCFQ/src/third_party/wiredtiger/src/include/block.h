@@ -237,6 +237,8 @@ struct __wt_block {
 
 	u_int	 block_header;		/* Header length */
 
+	uint64_t blkcache_id;		/* Block cache ID */
+
 	/*
 	 * There is only a single checkpoint in a file that can be written.  The
 	 * information could logically live in the WT_BM structure, but then we
@@ -271,6 +273,53 @@ struct __wt_block {
 	uint8_t   *fragckpt;		/* Per-checkpoint frag tracking list */
 };
 
+/*
+ * WT_BLKCACHE_ITEM --
+ *	A block in the block cache, followed by its data.
+ */
+struct __wt_blkcache_item {
+	TAILQ_ENTRY(__wt_blkcache_item) hashq;	/* Hash bucket list */
+
+	uint64_t block_id;		/* Block handle's cache ID */
+	wt_off_t offset;		/* Address cookie */
+	uint32_t size;
+	uint32_t checksum;
+
+	volatile bool referenced;	/* Read since the last eviction pass */
+};
+#define	WT_BLKCACHE_ITEM_DATA(item)					\
+	((uint8_t *)(item) + sizeof(WT_BLKCACHE_ITEM))
+
+/*
+ * WT_BLKCACHE --
+ *	A cache of blocks in their on-disk format, read in place of the file.
+ */
+struct __wt_blkcache {
+	uint64_t bytes_max;		/* Configured size, 0 if disabled */
+	volatile uint64_t bytes_inuse;	/* Bytes cached, with overhead */
+	volatile uint64_t blocks_inuse;	/* Blocks cached */
+
+	/*
+	 * Each block handle takes a new ID when it's created, so blocks left
+	 * in the cache by a closed, dropped or re-created file can't be found
+	 * again: they are evicted like any other unused block.
+	 */
+	volatile uint64_t block_id;	/* Next block handle ID */
+
+	uint32_t hash_size;		/* Number of hash buckets */
+	TAILQ_HEAD(__wt_blkcache_hash, __wt_blkcache_item) *hash;
+
+	/*
+	 * The buckets share a set of spin locks, they are only held to search
+	 * or change a bucket's list.  Use a prime number of locks, as for the
+	 * btree page locks.
+	 */
+#define	WT_BLKCACHE_LOCKS	257
+	WT_SPINLOCK *hash_lock;
+
+	volatile uint32_t evict_bucket;	/* Next bucket for eviction to sweep */
+};
+
 /*
  * WT_BLOCK_DESC --
  *	The file's description.
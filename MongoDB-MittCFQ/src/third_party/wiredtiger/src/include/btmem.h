@@ -519,11 +519,24 @@ struct __wt_page {
 		struct {
 			WT_ROW *d;		/* Key/value pairs */
 			uint32_t entries;	/* Entries */
+
+			/*
+			 * Optional search prefixes: for each key, the 8 bytes
+			 * following the bytes all of the page's keys share, as
+			 * a big-endian integer padded with zeroes; the shared
+			 * bytes follow the array.
+			 */
+			uint32_t prefix_skip;	/* Shared bytes */
+			uint64_t *prefix;	/* Search prefixes */
 		} row;
 #undef	pg_row_d
 #define	pg_row_d	u.row.d
 #undef	pg_row_entries
 #define	pg_row_entries	u.row.entries
+#undef	pg_row_prefix_skip
+#define	pg_row_prefix_skip	u.row.prefix_skip
+#undef	pg_row_prefix
+#define	pg_row_prefix	u.row.prefix
 
 		/* Fixed-length column-store leaf page. */
 		struct {
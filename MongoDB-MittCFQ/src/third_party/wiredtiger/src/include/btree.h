@@ -81,6 +81,7 @@ struct __wt_btree {
 	uint32_t id;			/* File ID, for logging */
 
 	uint32_t key_gap;		/* Row-store prefix key gap */
+	bool	 leaf_search_prefix;	/* Leaf page search prefixes */
 
 	uint32_t allocsize;		/* Allocation size */
 	uint32_t maxintlpage;		/* Internal page max size */
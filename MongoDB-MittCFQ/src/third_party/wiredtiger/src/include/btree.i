@@ -910,6 +910,26 @@ __wt_row_leaf_value_set(WT_PAGE *page, WT_ROW *rip, WT_CELL_UNPACK *unpack)
 	WT_ROW_KEY_SET(rip, v);
 }
 
+/*
+ * __wt_row_leaf_prefix --
+ *	Return a key's row-store leaf page search prefix: the 8 bytes after
+ * the bytes skipped, as a big-endian integer padded with zeroes.  Prefixes
+ * compare as the keys do, except that keys with equal prefixes may differ.
+ */
+static inline uint64_t
+__wt_row_leaf_prefix(const void *data, size_t size, size_t skip)
+{
+	const uint8_t *p;
+	uint64_t v;
+	size_t i;
+
+	p = (const uint8_t *)data + skip;
+	size = size > skip ? WT_MIN(size - skip, 8) : 0;
+	for (v = 0, i = 0; i < 8; ++i)
+		v = (v << 8) | (i < size ? p[i] : 0);
+	return (v);
+}
+
 /*
  * __wt_row_leaf_key --
  *	Set a buffer to reference a row-store leaf page key as cheaply as
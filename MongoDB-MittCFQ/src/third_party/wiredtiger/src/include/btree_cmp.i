@@ -31,6 +31,7 @@ static inline int
 __wt_lex_compare(const WT_ITEM *user_item, const WT_ITEM *tree_item)
 {
 	size_t len, usz, tsz;
+	uint64_t tword, uword;
 	const uint8_t *userp, *treep;
 
 	usz = user_item->size;
@@ -41,8 +42,8 @@ __wt_lex_compare(const WT_ITEM *user_item, const WT_ITEM *tree_item)
 	treep = tree_item->data;
 
 #ifdef HAVE_X86INTRIN_H
-	/* Use vector instructions if we'll execute at least 2 of them. */
-	if (len >= WT_VECTOR_SIZE * 2) {
+	/* Use vector instructions if we'll execute at least 1 of them. */
+	if (len >= WT_VECTOR_SIZE) {
 		size_t remain;
 		__m128i res_eq, u, t;
 
@@ -72,9 +73,16 @@ __wt_lex_compare(const WT_ITEM *user_item, const WT_ITEM *tree_item)
 	}
 #endif
 	/*
-	 * Use the non-vectorized version for the remaining bytes and for the
-	 * small key sizes.
+	 * Compare a word at a time to find the word that differs, then use
+	 * the non-vectorized version for the differing and remaining bytes.
 	 */
+	for (; len >= sizeof(uint64_t); len -= sizeof(uint64_t),
+	    userp += sizeof(uint64_t), treep += sizeof(uint64_t)) {
+		memcpy(&uword, userp, sizeof(uint64_t));
+		memcpy(&tword, treep, sizeof(uint64_t));
+		if (uword != tword)
+			break;
+	}
 	for (; len > 0; --len, ++userp, ++treep)
 		if (*userp != *treep)
 			return (*userp < *treep ? -1 : 1);
@@ -117,6 +125,7 @@ __wt_lex_compare_skip(
     const WT_ITEM *user_item, const WT_ITEM *tree_item, size_t *matchp)
 {
 	size_t len, usz, tsz;
+	uint64_t tword, uword;
 	const uint8_t *userp, *treep;
 
 	usz = user_item->size;
@@ -127,8 +136,8 @@ __wt_lex_compare_skip(
 	treep = (const uint8_t *)tree_item->data + *matchp;
 
 #ifdef HAVE_X86INTRIN_H
-	/* Use vector instructions if we'll execute at least 2 of them. */
-	if (len >= WT_VECTOR_SIZE * 2) {
+	/* Use vector instructions if we'll execute at least 1 of them. */
+	if (len >= WT_VECTOR_SIZE) {
 		size_t remain;
 		__m128i res_eq, u, t;
 
@@ -160,9 +169,17 @@ __wt_lex_compare_skip(
 	}
 #endif
 	/*
-	 * Use the non-vectorized version for the remaining bytes and for the
-	 * small key sizes.
+	 * Compare a word at a time to find the word that differs, then use
+	 * the non-vectorized version for the differing and remaining bytes.
 	 */
+	for (; len >= sizeof(uint64_t); len -= sizeof(uint64_t),
+	    userp += sizeof(uint64_t), treep += sizeof(uint64_t),
+	    *matchp += sizeof(uint64_t)) {
+		memcpy(&uword, userp, sizeof(uint64_t));
+		memcpy(&tword, treep, sizeof(uint64_t));
+		if (uword != tword)
+			break;
+	}
 	for (; len > 0; --len, ++userp, ++treep, ++*matchp)
 		if (*userp != *treep)
 			return (*userp < *treep ? -1 : 1);
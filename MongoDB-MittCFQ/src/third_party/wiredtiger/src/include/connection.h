@@ -103,6 +103,16 @@ struct __wt_named_extractor {
 	TAILQ_ENTRY(__wt_named_extractor) q;	/* Linked list of extractors */
 };
 
+/*
+ * WT_READAHEAD_REQ --
+ *	A request to read leaf pages ahead of a scanning cursor.
+ */
+struct __wt_readahead_req {
+	char	*uri;			/* File being scanned */
+	WT_ITEM	 key;			/* Key the cursor reached */
+	bool	 prev;			/* Scanning backward */
+};
+
 /*
  * Allocate some additional slots for internal sessions so the user cannot
  * configure too few sessions for us to run.
@@ -266,6 +276,8 @@ struct __wt_connection_impl {
 					   configured or the current size
 					   within a cache pool). */
 
+	WT_BLKCACHE blkcache;		/* Block cache */
+
 	WT_TXN_GLOBAL txn_global;	/* Global transaction state */
 
 	WT_RWLOCK *hot_backup_lock;	/* Hot backup serialization */
@@ -285,6 +297,42 @@ struct __wt_connection_impl {
 	uint64_t  ckpt_time_recent;	/* Checkpoint time recent/total */
 	uint64_t  ckpt_time_total;
 
+					/* Checkpoint write pacing */
+	uint64_t  ckpt_pace_read_latency;/* Target read latency (usecs) */
+	bool	  ckpt_pacing;		/* Current checkpoint is paced */
+	struct timespec ckpt_pace_start;/* Paced writes started */
+	struct timespec ckpt_pace_last;	/* Last paced write */
+	struct timespec ckpt_pace_sample;/* Last read latency sample */
+	uint64_t  ckpt_pace_budget;	/* Time for the writes (usecs) */
+	uint64_t  ckpt_pace_bytes;	/* Bytes expected to be written */
+	uint64_t  ckpt_pace_written;	/* Bytes written so far */
+	uint64_t  ckpt_pace_rate;	/* Target rate (bytes per second) */
+	uint64_t  ckpt_pace_reads;	/* Read counters at last sample */
+	uint64_t  ckpt_pace_read_usecs;
+	uint64_t  ckpt_pace_usecs;	/* Last paced writes took (usecs) */
+
+					/* Checkpoint leaf reconciliation */
+#define	WT_CKPT_REC_BATCH	64	/* Leaf pages reconciled per batch */
+	WT_SPINLOCK	 ckpt_rec_lock;	/* Batch lock */
+	WT_REF		*ckpt_rec_batch[WT_CKPT_REC_BATCH];
+	uint32_t	 ckpt_rec_count;	/* Pages in the batch */
+	uint32_t	 ckpt_rec_next;		/* Next page to reconcile */
+	volatile uint32_t ckpt_rec_done;	/* Pages reconciled */
+	int		 ckpt_rec_ret;		/* First error in the batch */
+	WT_CONDVAR	*ckpt_rec_cond;		/* Batch complete */
+	WT_SESSION_IMPL *ckpt_rec_session;	/* Checkpointing session */
+	WT_DATA_HANDLE	*ckpt_rec_dhandle;	/* File being checkpointed */
+	bool		 ckpt_threads_running;	/* Threads started */
+	WT_THREAD_GROUP  ckpt_threads;
+	uint32_t	 ckpt_threads_cfg;	/* Checkpoint threads */
+
+	/*
+	 * Disk reads done by application threads, the latency checkpoint
+	 * pacing responds to.
+	 */
+	uint64_t  app_read_count;
+	uint64_t  app_read_usecs;
+
 #define	WT_CONN_STAT_ALL	0x01	/* "all" statistics configured */
 #define	WT_CONN_STAT_CLEAR	0x02	/* clear after gathering */
 #define	WT_CONN_STAT_FAST	0x04	/* "fast" statistics configured */
@@ -313,6 +361,16 @@ struct __wt_connection_impl {
 	uint32_t	 evict_threads_max;/* Max eviction threads */
 	uint32_t	 evict_threads_min;/* Min eviction threads */
 
+#define	WT_READAHEAD_QUEUE_MAX	64	/* Readahead requests queued */
+	WT_SPINLOCK	 readahead_lock;	/* Readahead queue lock */
+	WT_READAHEAD_REQ *readahead_queue[WT_READAHEAD_QUEUE_MAX];
+	uint32_t	 readahead_head;	/* Next request to run */
+	uint32_t	 readahead_count;	/* Requests in the queue */
+	uint32_t	 readahead_pages;	/* Leaf pages to read ahead */
+	bool		 readahead_running;	/* Readahead threads started */
+	WT_THREAD_GROUP  readahead_threads;
+	uint32_t	 readahead_threads_cfg;	/* Readahead threads */
+
 #define	WT_STATLOG_FILENAME	"WiredTigerStat.%d.%H"
 	WT_SESSION_IMPL *stat_session;	/* Statistics log session */
 	wt_thread_t	 stat_tid;	/* Statistics log thread */
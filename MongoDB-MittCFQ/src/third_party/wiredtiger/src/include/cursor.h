@@ -104,6 +104,9 @@ struct __wt_cursor_btree {
 
 	uint32_t page_deleted_count;	/* Deleted items on the page */
 
+	uint32_t readahead_leaves;	/* Leaf pages scanned in a row */
+	bool	 readahead_prev;	/* Direction of the scan */
+
 	uint64_t recno;			/* Record number */
 
 	/*
@@ -215,8 +218,9 @@ struct __wt_cursor_btree {
 #define	WT_CBT_ITERATE_PREV	0x08	/* Prev iteration configuration */
 #define	WT_CBT_NO_TXN   	0x10	/* Non-transactional cursor
 					   (e.g. on a checkpoint) */
-#define	WT_CBT_SEARCH_SMALLEST	0x20	/* Row-store: small-key insert list */
-#define	WT_CBT_VAR_ONPAGE_MATCH	0x40	/* Var-store: on-page recno match */
+#define	WT_CBT_READ_ONCE	0x20	/* Scan: don't keep pages cached */
+#define	WT_CBT_SEARCH_SMALLEST	0x40	/* Row-store: small-key insert list */
+#define	WT_CBT_VAR_ONPAGE_MATCH	0x80	/* Var-store: on-page recno match */
 
 #define	WT_CBT_POSITION_MASK		/* Flags associated with position */ \
 	(WT_CBT_ITERATE_APPEND | WT_CBT_ITERATE_NEXT | WT_CBT_ITERATE_PREV | \
@@ -37,19 +37,20 @@
 #define	WT_LOG_FLUSH					0x00000004
 #define	WT_LOG_FSYNC					0x00000008
 #define	WT_LOG_SYNC_ENABLED				0x00000010
-#define	WT_READ_CACHE					0x00000001
-#define	WT_READ_COMPACT					0x00000002
-#define	WT_READ_NOTFOUND_OK				0x00000004
-#define	WT_READ_NO_EMPTY				0x00000008
-#define	WT_READ_NO_EVICT				0x00000010
-#define	WT_READ_NO_GEN					0x00000020
-#define	WT_READ_NO_WAIT					0x00000040
-#define	WT_READ_PREV					0x00000080
-#define	WT_READ_RESTART_OK				0x00000100
-#define	WT_READ_SKIP_INTL				0x00000200
-#define	WT_READ_SKIP_LEAF				0x00000400
-#define	WT_READ_TRUNCATE				0x00000800
-#define	WT_READ_WONT_NEED				0x00001000
+#define	WT_READ_AHEAD					0x00000001
+#define	WT_READ_CACHE					0x00000002
+#define	WT_READ_COMPACT					0x00000004
+#define	WT_READ_NOTFOUND_OK				0x00000008
+#define	WT_READ_NO_EMPTY				0x00000010
+#define	WT_READ_NO_EVICT				0x00000020
+#define	WT_READ_NO_GEN					0x00000040
+#define	WT_READ_NO_WAIT					0x00000080
+#define	WT_READ_PREV					0x00000100
+#define	WT_READ_RESTART_OK				0x00000200
+#define	WT_READ_SKIP_INTL				0x00000400
+#define	WT_READ_SKIP_LEAF				0x00000800
+#define	WT_READ_TRUNCATE				0x00001000
+#define	WT_READ_WONT_NEED				0x00002000
 #define	WT_SESSION_CAN_WAIT				0x00000001
 #define	WT_SESSION_INTERNAL				0x00000002
 #define	WT_SESSION_LOCKED_CHECKPOINT			0x00000004
@@ -69,7 +70,8 @@
 #define	WT_SESSION_NO_LOGGING				0x00010000
 #define	WT_SESSION_NO_SCHEMA_LOCK			0x00020000
 #define	WT_SESSION_QUIET_CORRUPT_FILE			0x00040000
-#define	WT_SESSION_SERVER_ASYNC				0x00080000
+#define	WT_SESSION_READ_DEADLINE			0x00080000
+#define	WT_SESSION_SERVER_ASYNC				0x00100000
 #define	WT_TXN_LOG_CKPT_CLEANUP				0x00000001
 #define	WT_TXN_LOG_CKPT_PREPARE				0x00000002
 #define	WT_TXN_LOG_CKPT_START				0x00000004
@@ -119,6 +119,13 @@ struct WT_COMPILER_TYPE_ALIGN(WT_CACHE_LINE_ALIGNMENT) __wt_session_impl {
 	WT_ITEM err;			/* Error buffer */
 
 	WT_TXN_ISOLATION isolation;
+	int64_t	read_deadline_us;	/* Page read deadline, -1 if none */
+
+					/* Block reads done by this session */
+	uint64_t read_count;		/* Reads issued */
+	uint64_t read_bytes;		/* Bytes read */
+	uint64_t read_time_us;		/* Time blocked reading */
+	uint64_t read_busy;		/* Reads rejected with WT_READ_BUSY */
 	WT_TXN	txn;			/* Transaction state */
 	WT_LSN	bg_sync_lsn;		/* Background sync operation LSN. */
 	u_int	ncursors;		/* Count of active file cursors. */
@@ -268,8 +268,26 @@ struct __wt_connection_stats {
 	int64_t async_op_remove;
 	int64_t async_op_search;
 	int64_t async_op_update;
+	int64_t block_cache_blocks;
+	int64_t block_cache_evict;
+	int64_t block_cache_insert;
+	int64_t block_cache_bytes;
+	int64_t block_cache_byte_hit;
+	int64_t block_cache_hit;
+	int64_t block_cache_bytes_max;
+	int64_t block_cache_miss;
+	int64_t block_read_latency_lt64;
+	int64_t block_read_latency_lt256;
+	int64_t block_read_latency_lt1024;
+	int64_t block_read_latency_lt4096;
+	int64_t block_read_latency_lt16384;
+	int64_t block_read_latency_lt65536;
+	int64_t block_read_latency_lt262144;
+	int64_t block_read_latency_gt262144;
+	int64_t block_read_latency_total;
 	int64_t block_preload;
 	int64_t block_read;
+	int64_t block_read_busy;
 	int64_t block_write;
 	int64_t block_byte_read;
 	int64_t block_byte_write;
@@ -323,6 +341,7 @@ struct __wt_connection_stats {
 	int64_t cache_eviction_pages_queued_urgent;
 	int64_t cache_eviction_pages_queued_oldest;
 	int64_t cache_read;
+	int64_t cache_read_ahead;
 	int64_t cache_read_lookaside;
 	int64_t cache_pages_requested;
 	int64_t cache_eviction_pages_seen;
@@ -331,6 +350,9 @@ struct __wt_connection_stats {
 	int64_t cache_write;
 	int64_t cache_write_restore;
 	int64_t cache_overhead;
+	int64_t cache_read_ahead_queue_full;
+	int64_t cache_read_ahead_queued;
+	int64_t cache_read_ahead_cache_full;
 	int64_t cache_bytes_internal;
 	int64_t cache_bytes_leaf;
 	int64_t cache_bytes_dirty;
@@ -444,6 +466,12 @@ struct __wt_connection_stats {
 	int64_t txn_checkpoint_time_max;
 	int64_t txn_checkpoint_time_min;
 	int64_t txn_checkpoint_time_recent;
+	int64_t txn_checkpoint_pace_read_latency;
+	int64_t txn_checkpoint_pace_delay;
+	int64_t txn_checkpoint_pace_deadline;
+	int64_t txn_checkpoint_pace_dirty;
+	int64_t txn_checkpoint_pace_rate;
+	int64_t txn_checkpoint_threads_pages;
 	int64_t txn_checkpoint_scrub_target;
 	int64_t txn_checkpoint_scrub_time;
 	int64_t txn_checkpoint_time_total;
@@ -477,6 +505,15 @@ struct __wt_dsrc_stats {
 	int64_t lsm_merge_throttle;
 	int64_t bloom_size;
 	int64_t block_extension;
+	int64_t block_read_latency_lt64;
+	int64_t block_read_latency_lt256;
+	int64_t block_read_latency_lt1024;
+	int64_t block_read_latency_lt4096;
+	int64_t block_read_latency_lt16384;
+	int64_t block_read_latency_lt65536;
+	int64_t block_read_latency_lt262144;
+	int64_t block_read_latency_gt262144;
+	int64_t block_read_latency_total;
 	int64_t block_alloc;
 	int64_t block_free;
 	int64_t block_checkpoint_size;
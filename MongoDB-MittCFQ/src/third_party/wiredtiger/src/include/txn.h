@@ -73,6 +73,13 @@ struct __wt_txn_global {
 	WT_SPINLOCK id_lock;
 	volatile uint64_t current;	/* Current transaction ID. */
 
+	/*
+	 * Incremented each time a transaction ID is released by commit or
+	 * rollback: together with the current ID, tells whether the set of
+	 * running transactions may have changed.
+	 */
+	volatile uint64_t commit_gen;
+
 	/* The oldest running transaction ID (may race). */
 	volatile uint64_t last_running;
 
@@ -106,6 +113,14 @@ struct __wt_txn_global {
 	TAILQ_HEAD(__wt_nsnap_qh, __wt_named_snapshot) nsnaph;
 
 	WT_TXN_STATE *states;		/* Per-session transaction states */
+
+	/*
+	 * Per-session flags, set while the session may have a transaction ID
+	 * published in its state.  Packed densely so building a snapshot can
+	 * skip idle sessions a word at a time instead of reading each state's
+	 * cache line.
+	 */
+	uint8_t *states_active;
 };
 
 typedef enum __wt_txn_isolation {
@@ -173,6 +188,15 @@ struct __wt_txn {
 	uint32_t snapshot_count;
 	uint32_t txn_logsync;	/* Log sync configuration */
 
+	/*
+	 * The last snapshot built by scanning is reused until a transaction ID
+	 * is allocated or released: the global current ID and commit
+	 * generation it was built at, and the snap_min it published.
+	 */
+	uint64_t snapshot_current;
+	uint64_t snapshot_commit_gen;
+	uint64_t snapshot_pinned;
+
 	/* Array of modifications by this transaction. */
 	WT_TXN_OP      *mod;
 	size_t		mod_alloc;
@@ -355,6 +355,7 @@ __wt_txn_id_alloc(WT_SESSION_IMPL *session, bool publish)
 
 	if (publish) {
 		session->txn.id = id;
+		txn_global->states_active[session->id] = 1;
 		WT_PUBLISH(WT_SESSION_TXN_STATE(session)->id, id);
 	}
 
@@ -76,6 +76,10 @@ struct __wt_async_op_impl;
     typedef struct __wt_async_op_impl WT_ASYNC_OP_IMPL;
 struct __wt_async_worker_state;
     typedef struct __wt_async_worker_state WT_ASYNC_WORKER_STATE;
+struct __wt_blkcache;
+    typedef struct __wt_blkcache WT_BLKCACHE;
+struct __wt_blkcache_item;
+    typedef struct __wt_blkcache_item WT_BLKCACHE_ITEM;
 struct __wt_block;
     typedef struct __wt_block WT_BLOCK;
 struct __wt_block_ckpt;
@@ -262,6 +266,8 @@ struct __wt_page_modify;
     typedef struct __wt_page_modify WT_PAGE_MODIFY;
 struct __wt_process;
     typedef struct __wt_process WT_PROCESS;
+struct __wt_readahead_req;
+    typedef struct __wt_readahead_req WT_READAHEAD_REQ;
 struct __wt_ref;
     typedef struct __wt_ref WT_REF;
 struct __wt_row;
@@ -28,6 +28,16 @@
 
 #include "wt_internal.h"
 
+#if defined(__linux__)
+#include <sys/syscall.h>
+
+/*
+ * The MittCFQ kernel's deadline-bounded pread, taking the deadline in
+ * microseconds as a fifth argument.
+ */
+#define	WT_SYS_MZPREAD64	548
+#endif
+
 /*
  * __posix_sync --
  *	Underlying support function to flush a file descriptor.
@@ -366,6 +376,36 @@ __posix_file_lock(
 	WT_RET_MSG(session, ret, "%s: handle-lock: fcntl", file_handle->name);
 }
 
+/*
+ * __posix_deadline_pread --
+ *	Deadline-bounded pread: returns WT_READ_BUSY if the I/O scheduler
+ * rejects the read, falling back to pread if the kernel doesn't support
+ * deadline reads. The kernel fails a rejected read with EBUSY, or returns
+ * a short count if it read some pages before the rejected one; any other
+ * failure is returned through *nrp like a pread failure.
+ */
+static int
+__posix_deadline_pread(WT_SESSION_IMPL *session,
+    int fd, void *buf, size_t len, wt_off_t offset, ssize_t *nrp)
+{
+	ssize_t nr;
+
+#if defined(WT_SYS_MZPREAD64)
+	nr = syscall(WT_SYS_MZPREAD64,
+	    fd, buf, len, offset, (long)session->read_deadline_us);
+	if ((nr < 0 && errno == EBUSY) || (nr > 0 && (size_t)nr < len)) {
+		WT_STAT_FAST_CONN_INCR(session, block_read_busy);
+		return (WT_READ_BUSY);
+	}
+	if (nr < 0 && errno == ENOSYS)
+#else
+	WT_UNUSED(session);
+#endif
+		nr = pread(fd, buf, len, offset);
+	*nrp = nr;
+	return (0);
+}
+
 /*
  * __posix_file_read --
  *	POSIX pread.
@@ -395,7 +435,12 @@ __posix_file_read(WT_FILE_HANDLE *file_handle,
 	/* Break reads larger than 1GB into 1GB chunks. */
 	for (addr = buf; len > 0; addr += nr, len -= (size_t)nr, offset += nr) {
 		chunk = WT_MIN(len, WT_GIGABYTE);
-		if ((nr = pread(pfh->fd, addr, chunk, offset)) <= 0)
+		if (F_ISSET(session, WT_SESSION_READ_DEADLINE))
+			WT_RET(__posix_deadline_pread(
+			    session, pfh->fd, addr, chunk, offset, &nr));
+		else
+			nr = pread(pfh->fd, addr, chunk, offset);
+		if (nr <= 0)
 			WT_RET_MSG(session, nr == 0 ? WT_ERROR : __wt_errno(),
 			    "%s: handle-read: pread: failed to read %"
 			    WT_SIZET_FMT " bytes at offset %" PRIuMAX,
@@ -544,6 +544,7 @@ __rec_write_status(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_PAGE *page)
 {
 	WT_BTREE *btree;
 	WT_PAGE_MODIFY *mod;
+	uint64_t max_txn;
 
 	btree = S2BT(session);
 	mod = page->modify;
@@ -590,10 +591,17 @@ __rec_write_status(WT_SESSION_IMPL *session, WT_RECONCILE *r, WT_PAGE *page)
 		 * ID when doing a checkpoint. That's sufficient, we only care
 		 * about the maximum transaction ID of current updates in the
 		 * tree, and checkpoint visits every dirty page in the tree.
+		 * Checkpoint threads reconcile leaf pages concurrently, swap
+		 * the new maximum in.
 		 */
-		if (!F_ISSET(r, WT_EVICTING) &&
-		    WT_TXNID_LT(btree->rec_max_txn, r->max_txn))
-			btree->rec_max_txn = r->max_txn;
+		if (!F_ISSET(r, WT_EVICTING))
+			for (;;) {
+				max_txn = btree->rec_max_txn;
+				if (!WT_TXNID_LT(max_txn, r->max_txn) ||
+				    __wt_atomic_cas64(&btree->rec_max_txn,
+				    max_txn, r->max_txn))
+					break;
+			}
 
 		/*
 		 * The page only might be clean; if the write generation is
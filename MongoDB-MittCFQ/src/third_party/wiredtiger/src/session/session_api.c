@@ -1043,6 +1043,46 @@ __session_salvage_readonly(
 err:	API_END_RET(session, ret);
 }
 
+/*
+ * __session_set_read_deadline --
+ *	WT_SESSION->set_read_deadline method.
+ */
+static int
+__session_set_read_deadline(WT_SESSION *wt_session, int64_t deadline_us)
+{
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+
+	session = (WT_SESSION_IMPL *)wt_session;
+	SESSION_API_CALL_NOCONF(session, set_read_deadline);
+
+	session->read_deadline_us = deadline_us < 0 ? -1 : deadline_us;
+
+err:	API_END_RET(session, ret);
+}
+
+/*
+ * __session_get_read_stats --
+ *	WT_SESSION->get_read_stats method.
+ */
+static int
+__session_get_read_stats(WT_SESSION *wt_session, uint64_t *readsp,
+    uint64_t *bytesp, uint64_t *time_usp, uint64_t *busyp)
+{
+	WT_DECL_RET;
+	WT_SESSION_IMPL *session;
+
+	session = (WT_SESSION_IMPL *)wt_session;
+	SESSION_API_CALL_NOCONF(session, get_read_stats);
+
+	*readsp = session->read_count;
+	*bytesp = session->read_bytes;
+	*time_usp = session->read_time_us;
+	*busyp = session->read_busy;
+
+err:	API_END_RET(session, ret);
+}
+
 /*
  * __wt_session_range_truncate --
  *	Session handling of a range truncate.
@@ -1681,6 +1721,8 @@ __open_session(WT_CONNECTION_IMPL *conn,
 		__session_rename,
 		__session_reset,
 		__session_salvage,
+		__session_set_read_deadline,
+		__session_get_read_stats,
 		__session_truncate,
 		__session_upgrade,
 		__session_verify,
@@ -1708,6 +1750,8 @@ __open_session(WT_CONNECTION_IMPL *conn,
 		__session_rename_readonly,
 		__session_reset,
 		__session_salvage_readonly,
+		__session_set_read_deadline,
+		__session_get_read_stats,
 		__session_truncate_readonly,
 		__session_upgrade_readonly,
 		__session_verify,
@@ -1788,6 +1832,7 @@ __open_session(WT_CONNECTION_IMPL *conn,
 
 	/* Initialize transaction support: default to read-committed. */
 	session_ret->isolation = WT_ISO_READ_COMMITTED;
+	session_ret->read_deadline_us = -1;
 	WT_ERR(__wt_txn_init(session_ret));
 
 	/*
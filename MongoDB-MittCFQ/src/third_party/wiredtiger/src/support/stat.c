@@ -16,6 +16,15 @@ static const char * const __stats_dsrc_desc[] = {
 	"LSM: sleep for LSM merge throttle",
 	"LSM: total size of bloom filters",
 	"block-manager: allocations requiring file extension",
+	"block-manager: block read latency histogram (bucket 1) - 0-63us",
+	"block-manager: block read latency histogram (bucket 2) - 64-255us",
+	"block-manager: block read latency histogram (bucket 3) - 256-1023us",
+	"block-manager: block read latency histogram (bucket 4) - 1024-4095us",
+	"block-manager: block read latency histogram (bucket 5) - 4096-16383us",
+	"block-manager: block read latency histogram (bucket 6) - 16384-65535us",
+	"block-manager: block read latency histogram (bucket 7) - 65536-262143us",
+	"block-manager: block read latency histogram (bucket 8) - 262144us+",
+	"block-manager: block read latency total (usecs)",
 	"block-manager: blocks allocated",
 	"block-manager: blocks freed",
 	"block-manager: checkpoint size",
@@ -147,6 +156,15 @@ __wt_stat_dsrc_clear_single(WT_DSRC_STATS *stats)
 	stats->lsm_merge_throttle = 0;
 	stats->bloom_size = 0;
 	stats->block_extension = 0;
+	stats->block_read_latency_lt64 = 0;
+	stats->block_read_latency_lt256 = 0;
+	stats->block_read_latency_lt1024 = 0;
+	stats->block_read_latency_lt4096 = 0;
+	stats->block_read_latency_lt16384 = 0;
+	stats->block_read_latency_lt65536 = 0;
+	stats->block_read_latency_lt262144 = 0;
+	stats->block_read_latency_gt262144 = 0;
+	stats->block_read_latency_total = 0;
 	stats->block_alloc = 0;
 	stats->block_free = 0;
 	stats->block_checkpoint_size = 0;
@@ -264,6 +282,15 @@ __wt_stat_dsrc_aggregate_single(
 	to->lsm_merge_throttle += from->lsm_merge_throttle;
 	to->bloom_size += from->bloom_size;
 	to->block_extension += from->block_extension;
+	to->block_read_latency_lt64 += from->block_read_latency_lt64;
+	to->block_read_latency_lt256 += from->block_read_latency_lt256;
+	to->block_read_latency_lt1024 += from->block_read_latency_lt1024;
+	to->block_read_latency_lt4096 += from->block_read_latency_lt4096;
+	to->block_read_latency_lt16384 += from->block_read_latency_lt16384;
+	to->block_read_latency_lt65536 += from->block_read_latency_lt65536;
+	to->block_read_latency_lt262144 += from->block_read_latency_lt262144;
+	to->block_read_latency_gt262144 += from->block_read_latency_gt262144;
+	to->block_read_latency_total += from->block_read_latency_total;
 	to->block_alloc += from->block_alloc;
 	to->block_free += from->block_free;
 	to->block_checkpoint_size += from->block_checkpoint_size;
@@ -389,6 +416,24 @@ __wt_stat_dsrc_aggregate(
 	to->lsm_merge_throttle += WT_STAT_READ(from, lsm_merge_throttle);
 	to->bloom_size += WT_STAT_READ(from, bloom_size);
 	to->block_extension += WT_STAT_READ(from, block_extension);
+	to->block_read_latency_lt64 +=
+	    WT_STAT_READ(from, block_read_latency_lt64);
+	to->block_read_latency_lt256 +=
+	    WT_STAT_READ(from, block_read_latency_lt256);
+	to->block_read_latency_lt1024 +=
+	    WT_STAT_READ(from, block_read_latency_lt1024);
+	to->block_read_latency_lt4096 +=
+	    WT_STAT_READ(from, block_read_latency_lt4096);
+	to->block_read_latency_lt16384 +=
+	    WT_STAT_READ(from, block_read_latency_lt16384);
+	to->block_read_latency_lt65536 +=
+	    WT_STAT_READ(from, block_read_latency_lt65536);
+	to->block_read_latency_lt262144 +=
+	    WT_STAT_READ(from, block_read_latency_lt262144);
+	to->block_read_latency_gt262144 +=
+	    WT_STAT_READ(from, block_read_latency_gt262144);
+	to->block_read_latency_total +=
+	    WT_STAT_READ(from, block_read_latency_total);
 	to->block_alloc += WT_STAT_READ(from, block_alloc);
 	to->block_free += WT_STAT_READ(from, block_free);
 	to->block_checkpoint_size +=
@@ -541,8 +586,26 @@ static const char * const __stats_connection_desc[] = {
 	"async: total remove calls",
 	"async: total search calls",
 	"async: total update calls",
+	"block-manager: block cache blocks",
+	"block-manager: block cache blocks evicted",
+	"block-manager: block cache blocks inserted",
+	"block-manager: block cache bytes",
+	"block-manager: block cache bytes read from the cache",
+	"block-manager: block cache hits",
+	"block-manager: block cache maximum bytes configured",
+	"block-manager: block cache misses",
+	"block-manager: block read latency histogram (bucket 1) - 0-63us",
+	"block-manager: block read latency histogram (bucket 2) - 64-255us",
+	"block-manager: block read latency histogram (bucket 3) - 256-1023us",
+	"block-manager: block read latency histogram (bucket 4) - 1024-4095us",
+	"block-manager: block read latency histogram (bucket 5) - 4096-16383us",
+	"block-manager: block read latency histogram (bucket 6) - 16384-65535us",
+	"block-manager: block read latency histogram (bucket 7) - 65536-262143us",
+	"block-manager: block read latency histogram (bucket 8) - 262144us+",
+	"block-manager: block read latency total (usecs)",
 	"block-manager: blocks pre-loaded",
 	"block-manager: blocks read",
+	"block-manager: blocks read rejected by the I/O scheduler",
 	"block-manager: blocks written",
 	"block-manager: bytes read",
 	"block-manager: bytes written",
@@ -596,6 +659,7 @@ static const char * const __stats_connection_desc[] = {
 	"cache: pages queued for urgent eviction",
 	"cache: pages queued for urgent eviction during walk",
 	"cache: pages read into cache",
+	"cache: pages read into cache by readahead",
 	"cache: pages read into cache requiring lookaside entries",
 	"cache: pages requested from the cache",
 	"cache: pages seen by eviction walk",
@@ -604,6 +668,9 @@ static const char * const __stats_connection_desc[] = {
 	"cache: pages written from cache",
 	"cache: pages written requiring in-memory restoration",
 	"cache: percentage overhead",
+	"cache: readahead requests dropped because the queue was full",
+	"cache: readahead requests queued",
+	"cache: readahead requests stopped by cache pressure",
 	"cache: tracked bytes belonging to internal pages in the cache",
 	"cache: tracked bytes belonging to leaf pages in the cache",
 	"cache: tracked dirty bytes in the cache",
@@ -717,6 +784,12 @@ static const char * const __stats_connection_desc[] = {
 	"transaction: transaction checkpoint max time (msecs)",
 	"transaction: transaction checkpoint min time (msecs)",
 	"transaction: transaction checkpoint most recent time (msecs)",
+	"transaction: transaction checkpoint pacing application read latency (usecs)",
+	"transaction: transaction checkpoint pacing delay (usecs)",
+	"transaction: transaction checkpoint pacing rate raised to meet the deadline",
+	"transaction: transaction checkpoint pacing stopped by dirty cache",
+	"transaction: transaction checkpoint pacing target rate (bytes per second)",
+	"transaction: transaction checkpoint pages reconciled by checkpoint threads",
 	"transaction: transaction checkpoint scrub dirty target",
 	"transaction: transaction checkpoint scrub time (msecs)",
 	"transaction: transaction checkpoint total time (msecs)",
@@ -783,8 +856,26 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
 	stats->async_op_remove = 0;
 	stats->async_op_search = 0;
 	stats->async_op_update = 0;
+		/* not clearing block_cache_blocks */
+	stats->block_cache_evict = 0;
+	stats->block_cache_insert = 0;
+		/* not clearing block_cache_bytes */
+	stats->block_cache_byte_hit = 0;
+	stats->block_cache_hit = 0;
+		/* not clearing block_cache_bytes_max */
+	stats->block_cache_miss = 0;
+	stats->block_read_latency_lt64 = 0;
+	stats->block_read_latency_lt256 = 0;
+	stats->block_read_latency_lt1024 = 0;
+	stats->block_read_latency_lt4096 = 0;
+	stats->block_read_latency_lt16384 = 0;
+	stats->block_read_latency_lt65536 = 0;
+	stats->block_read_latency_lt262144 = 0;
+	stats->block_read_latency_gt262144 = 0;
+	stats->block_read_latency_total = 0;
 	stats->block_preload = 0;
 	stats->block_read = 0;
+	stats->block_read_busy = 0;
 	stats->block_write = 0;
 	stats->block_byte_read = 0;
 	stats->block_byte_write = 0;
@@ -838,6 +929,7 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
 	stats->cache_eviction_pages_queued_urgent = 0;
 	stats->cache_eviction_pages_queued_oldest = 0;
 	stats->cache_read = 0;
+	stats->cache_read_ahead = 0;
 	stats->cache_read_lookaside = 0;
 	stats->cache_pages_requested = 0;
 	stats->cache_eviction_pages_seen = 0;
@@ -846,6 +938,9 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
 	stats->cache_write = 0;
 	stats->cache_write_restore = 0;
 		/* not clearing cache_overhead */
+	stats->cache_read_ahead_queue_full = 0;
+	stats->cache_read_ahead_queued = 0;
+	stats->cache_read_ahead_cache_full = 0;
 		/* not clearing cache_bytes_internal */
 		/* not clearing cache_bytes_leaf */
 		/* not clearing cache_bytes_dirty */
@@ -959,6 +1054,12 @@ __wt_stat_connection_clear_single(WT_CONNECTION_STATS *stats)
 		/* not clearing txn_checkpoint_time_max */
 		/* not clearing txn_checkpoint_time_min */
 		/* not clearing txn_checkpoint_time_recent */
+		/* not clearing txn_checkpoint_pace_read_latency */
+	stats->txn_checkpoint_pace_delay = 0;
+	stats->txn_checkpoint_pace_deadline = 0;
+	stats->txn_checkpoint_pace_dirty = 0;
+		/* not clearing txn_checkpoint_pace_rate */
+	stats->txn_checkpoint_threads_pages = 0;
 		/* not clearing txn_checkpoint_scrub_target */
 		/* not clearing txn_checkpoint_scrub_time */
 		/* not clearing txn_checkpoint_time_total */
@@ -1017,8 +1118,36 @@ __wt_stat_connection_aggregate(
 	to->async_op_remove += WT_STAT_READ(from, async_op_remove);
 	to->async_op_search += WT_STAT_READ(from, async_op_search);
 	to->async_op_update += WT_STAT_READ(from, async_op_update);
+	to->block_cache_blocks += WT_STAT_READ(from, block_cache_blocks);
+	to->block_cache_evict += WT_STAT_READ(from, block_cache_evict);
+	to->block_cache_insert += WT_STAT_READ(from, block_cache_insert);
+	to->block_cache_bytes += WT_STAT_READ(from, block_cache_bytes);
+	to->block_cache_byte_hit += WT_STAT_READ(from, block_cache_byte_hit);
+	to->block_cache_hit += WT_STAT_READ(from, block_cache_hit);
+	to->block_cache_bytes_max +=
+	    WT_STAT_READ(from, block_cache_bytes_max);
+	to->block_cache_miss += WT_STAT_READ(from, block_cache_miss);
+	to->block_read_latency_lt64 +=
+	    WT_STAT_READ(from, block_read_latency_lt64);
+	to->block_read_latency_lt256 +=
+	    WT_STAT_READ(from, block_read_latency_lt256);
+	to->block_read_latency_lt1024 +=
+	    WT_STAT_READ(from, block_read_latency_lt1024);
+	to->block_read_latency_lt4096 +=
+	    WT_STAT_READ(from, block_read_latency_lt4096);
+	to->block_read_latency_lt16384 +=
+	    WT_STAT_READ(from, block_read_latency_lt16384);
+	to->block_read_latency_lt65536 +=
+	    WT_STAT_READ(from, block_read_latency_lt65536);
+	to->block_read_latency_lt262144 +=
+	    WT_STAT_READ(from, block_read_latency_lt262144);
+	to->block_read_latency_gt262144 +=
+	    WT_STAT_READ(from, block_read_latency_gt262144);
+	to->block_read_latency_total +=
+	    WT_STAT_READ(from, block_read_latency_total);
 	to->block_preload += WT_STAT_READ(from, block_preload);
 	to->block_read += WT_STAT_READ(from, block_read);
+	to->block_read_busy += WT_STAT_READ(from, block_read_busy);
 	to->block_write += WT_STAT_READ(from, block_write);
 	to->block_byte_read += WT_STAT_READ(from, block_byte_read);
 	to->block_byte_write += WT_STAT_READ(from, block_byte_write);
@@ -1102,6 +1231,7 @@ __wt_stat_connection_aggregate(
 	to->cache_eviction_pages_queued_oldest +=
 	    WT_STAT_READ(from, cache_eviction_pages_queued_oldest);
 	to->cache_read += WT_STAT_READ(from, cache_read);
+	to->cache_read_ahead += WT_STAT_READ(from, cache_read_ahead);
 	to->cache_read_lookaside += WT_STAT_READ(from, cache_read_lookaside);
 	to->cache_pages_requested +=
 	    WT_STAT_READ(from, cache_pages_requested);
@@ -1112,6 +1242,12 @@ __wt_stat_connection_aggregate(
 	to->cache_write += WT_STAT_READ(from, cache_write);
 	to->cache_write_restore += WT_STAT_READ(from, cache_write_restore);
 	to->cache_overhead += WT_STAT_READ(from, cache_overhead);
+	to->cache_read_ahead_queue_full +=
+	    WT_STAT_READ(from, cache_read_ahead_queue_full);
+	to->cache_read_ahead_queued +=
+	    WT_STAT_READ(from, cache_read_ahead_queued);
+	to->cache_read_ahead_cache_full +=
+	    WT_STAT_READ(from, cache_read_ahead_cache_full);
 	to->cache_bytes_internal += WT_STAT_READ(from, cache_bytes_internal);
 	to->cache_bytes_leaf += WT_STAT_READ(from, cache_bytes_leaf);
 	to->cache_bytes_dirty += WT_STAT_READ(from, cache_bytes_dirty);
@@ -1255,6 +1391,18 @@ __wt_stat_connection_aggregate(
 	    WT_STAT_READ(from, txn_checkpoint_time_min);
 	to->txn_checkpoint_time_recent +=
 	    WT_STAT_READ(from, txn_checkpoint_time_recent);
+	to->txn_checkpoint_pace_read_latency +=
+	    WT_STAT_READ(from, txn_checkpoint_pace_read_latency);
+	to->txn_checkpoint_pace_delay +=
+	    WT_STAT_READ(from, txn_checkpoint_pace_delay);
+	to->txn_checkpoint_pace_deadline +=
+	    WT_STAT_READ(from, txn_checkpoint_pace_deadline);
+	to->txn_checkpoint_pace_dirty +=
+	    WT_STAT_READ(from, txn_checkpoint_pace_dirty);
+	to->txn_checkpoint_pace_rate +=
+	    WT_STAT_READ(from, txn_checkpoint_pace_rate);
+	to->txn_checkpoint_threads_pages +=
+	    WT_STAT_READ(from, txn_checkpoint_threads_pages);
 	to->txn_checkpoint_scrub_target +=
 	    WT_STAT_READ(from, txn_checkpoint_scrub_target);
 	to->txn_checkpoint_scrub_time +=
@@ -116,9 +116,9 @@ __wt_txn_get_snapshot(WT_SESSION_IMPL *session)
 	WT_TXN *txn;
 	WT_TXN_GLOBAL *txn_global;
 	WT_TXN_STATE *s, *txn_state;
-	uint64_t current_id, id;
+	uint64_t active, commit_gen, current_id, id;
 	uint64_t prev_oldest_id, snap_min;
-	uint32_t i, n, session_cnt;
+	uint32_t i, j, n, session_cnt;
 
 	conn = S2C(session);
 	txn = &session->txn;
@@ -135,9 +135,31 @@ __wt_txn_get_snapshot(WT_SESSION_IMPL *session)
 		WT_PAUSE();
 	WT_RET(ret);
 
+	/*
+	 * Read the commit generation before anything else: a transaction
+	 * clears its ID before bumping the generation, so any ID released
+	 * after this point is caught by the generation check next time.
+	 */
+	WT_ORDERED_READ(commit_gen, txn_global->commit_gen);
 	current_id = snap_min = txn_global->current;
 	prev_oldest_id = txn_global->oldest_id;
 
+	/*
+	 * If no transaction ID has been allocated or released since our last
+	 * scan, the running transactions are the same and so is the snapshot.
+	 * The IDs in it are still running, so the oldest ID can't have moved
+	 * past the snap_min we published then.
+	 */
+	if (txn->snapshot_current == current_id &&
+	    txn->snapshot_commit_gen == commit_gen) {
+		WT_ASSERT(session,
+		    WT_TXNID_LE(prev_oldest_id, txn->snapshot_pinned));
+		txn_state->snap_min = txn->snapshot_pinned;
+		__wt_readunlock(session, txn_global->scan_rwlock);
+		F_SET(txn, WT_TXN_HAS_SNAPSHOT);
+		return (0);
+	}
+
 	/*
 	 * Include the checkpoint transaction, if one is running: we should
 	 * ignore any uncommitted changes the checkpoint has written to the
@@ -155,25 +177,39 @@ __wt_txn_get_snapshot(WT_SESSION_IMPL *session)
 		goto done;
 	}
 
-	/* Walk the array of concurrent transactions. */
+	/*
+	 * Walk the array of concurrent transactions, skipping sessions that
+	 * can't have an ID published eight at a time.
+	 */
 	WT_ORDERED_READ(session_cnt, conn->session_cnt);
-	for (i = 0, s = txn_global->states; i < session_cnt; i++, s++) {
-		/*
-		 * Build our snapshot of any concurrent transaction IDs.
-		 *
-		 * Ignore:
-		 *  - Our own ID: we always read our own updates.
-		 *  - The ID if it is older than the oldest ID we saw. This
-		 *    can happen if we race with a thread that is allocating
-		 *    an ID -- the ID will not be used because the thread will
-		 *    keep spinning until it gets a valid one.
-		 */
-		if (s != txn_state &&
-		    (id = s->id) != WT_TXN_NONE &&
-		    WT_TXNID_LE(prev_oldest_id, id)) {
-			txn->snapshot[n++] = id;
-			if (WT_TXNID_LT(id, snap_min))
-				snap_min = id;
+	for (i = 0; i < session_cnt; i += 8) {
+		memcpy(&active, &txn_global->states_active[i], sizeof(active));
+		if (active == 0)
+			continue;
+		for (j = i; j < i + 8 && j < session_cnt; j++) {
+			if (txn_global->states_active[j] == 0)
+				continue;
+			s = &txn_global->states[j];
+
+			/*
+			 * Build our snapshot of any concurrent transaction
+			 * IDs.
+			 *
+			 * Ignore:
+			 *  - Our own ID: we always read our own updates.
+			 *  - The ID if it is older than the oldest ID we saw.
+			 *    This can happen if we race with a thread that
+			 *    is allocating an ID -- the ID will not be used
+			 *    because the thread will keep spinning until it
+			 *    gets a valid one.
+			 */
+			if (s != txn_state &&
+			    (id = s->id) != WT_TXN_NONE &&
+			    WT_TXNID_LE(prev_oldest_id, id)) {
+				txn->snapshot[n++] = id;
+				if (WT_TXNID_LT(id, snap_min))
+					snap_min = id;
+			}
 		}
 	}
 
@@ -187,6 +223,10 @@ __wt_txn_get_snapshot(WT_SESSION_IMPL *session)
 
 done:	__wt_readunlock(session, txn_global->scan_rwlock);
 	__txn_sort_snapshot(session, n, current_id);
+
+	txn->snapshot_current = current_id;
+	txn->snapshot_commit_gen = commit_gen;
+	txn->snapshot_pinned = txn_state->snap_min;
 	return (0);
 }
 
@@ -467,6 +507,16 @@ __wt_txn_release(WT_SESSION_IMPL *session)
 		txn->id = WT_TXN_NONE;
 	}
 
+	/*
+	 * Once the ID is cleared, snapshots built before now are out of date:
+	 * bump the commit generation.  Checkpoints have an ID too, the global
+	 * checkpoint ID cleared above was part of other sessions' snapshots.
+	 */
+	if (F_ISSET(txn, WT_TXN_HAS_ID)) {
+		WT_PUBLISH(txn_global->states_active[session->id], 0);
+		(void)__wt_atomic_addv64(&txn_global->commit_gen, 1);
+	}
+
 	/* Free the scratch buffer allocated for logging. */
 	__wt_logrec_free(session, &txn->logrec);
 
@@ -772,6 +822,11 @@ __wt_txn_global_init(WT_SESSION_IMPL *session, const char *cfg[])
 	    session, conn->session_size, &txn_global->states));
 	WT_CACHE_LINE_ALIGNMENT_VERIFY(session, txn_global->states);
 
+	/* Round up so the flags can be read a word at a time. */
+	WT_RET(__wt_calloc_def(session,
+	    WT_ALIGN(conn->session_size, sizeof(uint64_t)),
+	    &txn_global->states_active));
+
 	for (i = 0, s = txn_global->states; i < conn->session_size; i++, s++)
 		s->id = s->snap_min = WT_TXN_NONE;
 
@@ -798,4 +853,5 @@ __wt_txn_global_destroy(WT_SESSION_IMPL *session)
 	__wt_rwlock_destroy(session, &txn_global->scan_rwlock);
 	__wt_rwlock_destroy(session, &txn_global->nsnap_rwlock);
 	__wt_free(session, txn_global->states);
+	__wt_free(session, txn_global->states_active);
 }
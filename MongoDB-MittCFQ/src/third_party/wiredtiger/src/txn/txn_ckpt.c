@@ -722,7 +722,14 @@ __txn_checkpoint(WT_SESSION_IMPL *session, const char *cfg[])
 		WT_ERR(__wt_txn_checkpoint_log(
 		    session, full, WT_TXN_LOG_CKPT_START, NULL));
 
-	WT_ERR(__checkpoint_apply(session, cfg, __checkpoint_tree_helper));
+	/*
+	 * Write the trees, spreading the writes out if this is a periodic
+	 * checkpoint and pacing is configured.
+	 */
+	WT_ERR(__wt_checkpoint_pace_start(session));
+	ret = __checkpoint_apply(session, cfg, __checkpoint_tree_helper);
+	WT_TRET(__wt_checkpoint_pace_end(session));
+	WT_ERR(ret);
 
 	/*
 	 * Clear the dhandle so the visibility check doesn't get confused about
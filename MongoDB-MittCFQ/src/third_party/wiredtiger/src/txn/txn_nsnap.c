@@ -265,6 +265,9 @@ __wt_txn_named_snapshot_get(WT_SESSION_IMPL *session, WT_CONFIG_ITEM *nameval)
 				    nsnap->snapshot_count *
 				    sizeof(*nsnap->snapshot));
 			F_SET(txn, WT_TXN_HAS_SNAPSHOT);
+
+			/* The snapshot array no longer holds a scan. */
+			txn->snapshot_current = WT_TXN_NONE;
 			break;
 		}
 	__wt_readunlock(session, txn_global->nsnap_rwlock);
@@ -0,0 +1,224 @@
+/*-
+ * Public Domain 2014-2016 MongoDB, Inc.
+ * Public Domain 2008-2014 WiredTiger, Inc.
+ *
+ * This is free and unencumbered software released into the public domain.
+ *
+ * Anyone is free to copy, modify, publish, use, compile, sell, or
+ * distribute this software, either in source code form or as a compiled
+ * binary, for any purpose, commercial or non-commercial, and by any
+ * means.
+ *
+ * In jurisdictions that recognize copyright laws, the author or authors
+ * of this software dedicate any and all copyright interest in the
+ * software to the public domain. We make this dedication for the benefit
+ * of the public at large and to the detriment of our heirs and
+ * successors. We intend this dedication to be an overt act of
+ * relinquishment in perpetuity of all present and future rights to this
+ * software under copyright law.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+ * IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+ * OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ * ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "test_util.h"
+
+/*
+ * Test case description: measure the cost of starting a snapshot transaction
+ * as the number of open sessions grows.  Most sessions are idle, a few hold a
+ * transaction with an ID, as with a server holding a session per client
+ * connection.  Each session count is measured with only readers, so snapshots
+ * can be reused, and with a commit before each transaction, so each snapshot
+ * is built by scanning.  Also check that a reused snapshot never
+ * hides a commit.
+ */
+
+void (*custom_die)(void) = NULL;
+
+#define	N_OPS		200000
+#define	N_OPS_SHORT	20000
+#define	SESSION_MAX	5000	/* Matches the session_max configuration */
+#define	RUNNING_EVERY	100	/* One session in this many has an ID */
+#define	WRITER_URI	"table:writes"
+
+static const uint32_t session_counts[] = { 10, 100, 1000, 4000 };
+
+/*
+ * run_readers --
+ *	Start snapshot transactions and read a record, return the average
+ *	nanoseconds per transaction.  If given a writer cursor, commit an insert
+ *	before each transaction, so no snapshot can be reused.  The writes go
+ *	to a table of their own: the sessions holding transactions keep every
+ *	update in memory, and readers stalled behind pages that can't be
+ *	evicted would swamp the cost being measured.
+ */
+static uint64_t
+run_readers(TEST_OPTS *opts,
+    WT_SESSION *session, WT_CURSOR *wcursor, uint32_t nops)
+{
+	struct timespec start, stop;
+	WT_CURSOR *cursor;
+	uint64_t ns;
+	uint32_t i;
+	static int64_t wkey = 0;
+
+	testutil_check(
+	    session->open_cursor(session, opts->uri, NULL, NULL, &cursor));
+	for (ns = 0, i = 0; i < nops; ++i) {
+		if (wcursor != NULL) {
+			wcursor->set_key(wcursor, wkey);
+			wcursor->set_value(wcursor, wkey);
+			testutil_check(wcursor->insert(wcursor));
+			++wkey;
+		}
+
+		testutil_check(__wt_epoch(NULL, &start));
+		testutil_check(session->begin_transaction(
+		    session, "isolation=snapshot"));
+		cursor->set_key(cursor, (int64_t)(i % 1000) + 1);
+		testutil_check(cursor->search(cursor));
+		testutil_check(session->commit_transaction(session, NULL));
+		testutil_check(__wt_epoch(NULL, &stop));
+		ns += WT_TIMEDIFF_NS(stop, start);
+	}
+	testutil_check(cursor->close(cursor));
+	return (ns / nops);
+}
+
+/*
+ * check_visibility --
+ *	A snapshot started after a commit must see it, one started before must
+ *	not.
+ */
+static void
+check_visibility(TEST_OPTS *opts, WT_SESSION *reader, WT_SESSION *updater)
+{
+	WT_CURSOR *rcursor, *ucursor;
+	int64_t value;
+	int i;
+
+	testutil_check(
+	    reader->open_cursor(reader, opts->uri, NULL, NULL, &rcursor));
+	testutil_check(
+	    updater->open_cursor(updater, opts->uri, NULL, NULL, &ucursor));
+
+	for (i = 0; i < 100; ++i) {
+		/* Take the same snapshot twice, so the second is reused. */
+		testutil_check(
+		    reader->begin_transaction(reader, "isolation=snapshot"));
+		rcursor->set_key(rcursor, 1);
+		testutil_check(rcursor->search(rcursor));
+		testutil_check(reader->commit_transaction(reader, NULL));
+
+		testutil_check(
+		    updater->begin_transaction(updater, "isolation=snapshot"));
+		ucursor->set_key(ucursor, 1);
+		ucursor->set_value(ucursor, (int64_t)-i);
+		testutil_check(ucursor->update(ucursor));
+
+		testutil_check(
+		    reader->begin_transaction(reader, "isolation=snapshot"));
+		rcursor->set_key(rcursor, 1);
+		testutil_check(rcursor->search(rcursor));
+		testutil_check(rcursor->get_value(rcursor, &value));
+		testutil_assert(value != -i);
+		testutil_check(reader->commit_transaction(reader, NULL));
+
+		testutil_check(updater->commit_transaction(updater, NULL));
+
+		testutil_check(
+		    reader->begin_transaction(reader, "isolation=snapshot"));
+		rcursor->set_key(rcursor, 1);
+		testutil_check(rcursor->search(rcursor));
+		testutil_check(rcursor->get_value(rcursor, &value));
+		testutil_assert(value == -i);
+		testutil_check(reader->commit_transaction(reader, NULL));
+	}
+
+	testutil_check(rcursor->close(rcursor));
+	testutil_check(ucursor->close(ucursor));
+}
+
+int
+main(int argc, char *argv[])
+{
+	TEST_OPTS *opts, _opts;
+	WT_CURSOR *cursor, *wcursor;
+	WT_SESSION *session, **sessions, *wsession;
+	uint64_t idle_ns, write_ns;
+	uint32_t i, nops, nsessions, opened;
+	u_int c;
+
+	opts = &_opts;
+	memset(opts, 0, sizeof(*opts));
+	testutil_check(testutil_parse_opts(argc, argv, opts));
+	testutil_make_work_dir(opts->home);
+
+	nops = testutil_disable_long_tests() ? N_OPS_SHORT : N_OPS;
+
+	testutil_check(wiredtiger_open(opts->home, NULL,
+	    "create,cache_size=1GB,session_max=5000",
+	    &opts->conn));
+	testutil_check(
+	    opts->conn->open_session(opts->conn, NULL, NULL, &session));
+	testutil_check(session->create(session, opts->uri,
+	    "key_format=q,value_format=q"));
+	testutil_check(
+	    session->open_cursor(session, opts->uri, NULL, NULL, &cursor));
+	for (i = 1; i <= 1000; ++i) {
+		cursor->set_key(cursor, (int64_t)i);
+		cursor->set_value(cursor, (int64_t)i);
+		testutil_check(cursor->insert(cursor));
+	}
+	testutil_check(cursor->close(cursor));
+
+	testutil_check(
+	    opts->conn->open_session(opts->conn, NULL, NULL, &wsession));
+	testutil_check(wsession->create(wsession, WRITER_URI,
+	    "key_format=q,value_format=q"));
+	testutil_check(
+	    wsession->open_cursor(wsession, WRITER_URI, NULL, NULL, &wcursor));
+
+	sessions = dcalloc(SESSION_MAX, sizeof(*sessions));
+	opened = 0;
+
+	printf("%10s %20s %20s\n",
+	    "sessions", "ns/txn (readers)", "ns/txn (+ commits)");
+	for (c = 0; c < WT_ELEMENTS(session_counts); ++c) {
+		/*
+		 * Open sessions up to the count, giving every so many a running
+		 * transaction with an ID.
+		 */
+		for (nsessions = session_counts[c]; opened < nsessions;
+		    ++opened) {
+			testutil_check(opts->conn->open_session(
+			    opts->conn, NULL, NULL, &sessions[opened]));
+			if (opened % RUNNING_EVERY != 0)
+				continue;
+			testutil_check(sessions[opened]->begin_transaction(
+			    sessions[opened], "isolation=snapshot"));
+			testutil_check(
+			    sessions[opened]->open_cursor(sessions[opened],
+			    opts->uri, NULL, NULL, &cursor));
+			cursor->set_key(cursor, (int64_t)opened + 2000);
+			cursor->set_value(cursor, (int64_t)opened);
+			testutil_check(cursor->insert(cursor));
+		}
+
+		idle_ns = run_readers(opts, session, NULL, nops);
+		write_ns = run_readers(opts, session, wcursor, nops);
+
+		printf("%10" PRIu32 " %20" PRIu64 " %20" PRIu64 "\n",
+		    nsessions, idle_ns, write_ns);
+	}
+
+	check_visibility(opts, session, sessions[1]);
+
+	free(sessions);
+	testutil_cleanup(opts);
+	return (0);
+}
@@ -0,0 +1,96 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2016 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from wiredtiger import stat
+from helper import key_populate, simple_populate, value_populate
+from wtscenario import make_scenarios
+
+# test_block_cache01.py
+#    Read pages evicted from a small cache back through the block cache.
+class test_block_cache01(wttest.WiredTigerTestCase):
+    uri = 'table:test_block_cache01'
+    nentries = 100000
+
+    scenarios = make_scenarios([
+        ('fits', dict(block_cache='20MB', hits=True)),
+        ('small', dict(block_cache='256KB', hits=False)),
+    ])
+
+    def conn_config(self, dir):
+        return 'cache_size=1MB,statistics=(fast),' + \
+            'block_cache=(size=%s,hashsize=512)' % self.block_cache
+
+    def get_stat(self, statistic):
+        statcursor = self.session.open_cursor('statistics:', None, None)
+        value = statcursor[statistic][2]
+        statcursor.close()
+        return value
+
+    def check(self, cursor, value_prefix=''):
+        i = 0
+        for key, value in cursor:
+            i += 1
+            self.assertEqual(key, key_populate(cursor, i))
+            self.assertEqual(value, value_prefix + value_populate(cursor, i))
+        self.assertEqual(i, self.nentries)
+
+    # Scans of a tree larger than the cache return the same data whether its
+    # pages come from the file or the block cache, and the block cache stays
+    # within its size.
+    def test_block_cache(self):
+        simple_populate(self, self.uri,
+            'key_format=S,leaf_page_max=4KB', self.nentries)
+        self.session.checkpoint()
+
+        cursor = self.session.open_cursor(self.uri, None)
+        self.check(cursor)
+        self.check(cursor)
+
+        # Rewrite every value: the pages are written to new blocks, possibly
+        # at offsets the old ones were read from.
+        for i in range(1, self.nentries + 1):
+            cursor[key_populate(cursor, i)] = 'new' + value_populate(cursor, i)
+        self.session.checkpoint()
+        self.check(cursor, 'new')
+        self.check(cursor, 'new')
+        cursor.close()
+
+        # Verify reads around the block cache.
+        self.session.verify(self.uri)
+
+        self.assertGreater(self.get_stat(stat.conn.block_cache_insert), 0)
+        self.assertLessEqual(self.get_stat(stat.conn.block_cache_bytes),
+            self.get_stat(stat.conn.block_cache_bytes_max))
+        if self.hits:
+            self.assertGreater(self.get_stat(stat.conn.block_cache_hit), 0)
+        else:
+            self.assertGreater(self.get_stat(stat.conn.block_cache_evict), 0)
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,94 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2016 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import time
+import wiredtiger, wttest
+from wiredtiger import stat
+from helper import key_populate, simple_populate, value_populate
+
+# test_checkpoint03.py
+#    Periodic checkpoints with write pacing configured.
+class test_checkpoint03(wttest.WiredTigerTestCase):
+    uri = 'table:test_checkpoint03'
+    nentries = 50000
+    conn_config = 'cache_size=200MB,' + \
+        'checkpoint=(wait=2,pace_read_latency=1),statistics=(fast)'
+
+    def get_stat(self, statistic):
+        statcursor = self.session.open_cursor('statistics:', None, None)
+        value = statcursor[statistic][2]
+        statcursor.close()
+        return value
+
+    def populate(self):
+        simple_populate(self, self.uri, 'key_format=S', self.nentries)
+        cursor = self.session.open_cursor(self.uri, None)
+        for i in range(1, self.nentries + 1, 10):
+            cursor[key_populate(cursor, i)] = 'updated'
+        cursor.close()
+
+    # Paced checkpoints still happen once per interval and write everything.
+    def test_checkpoint_pace(self):
+        self.populate()
+
+        start = self.get_stat(stat.conn.txn_checkpoint)
+        time.sleep(5)
+        self.assertGreaterEqual(
+            self.get_stat(stat.conn.txn_checkpoint) - start, 2)
+        self.assertGreater(
+            self.get_stat(stat.conn.txn_checkpoint_pace_delay), 0)
+
+        self.reopen_conn()
+        cursor = self.session.open_cursor(self.uri, None)
+        for i in range(1, self.nentries + 1):
+            expected = 'updated' if i % 10 == 1 else value_populate(cursor, i)
+            self.assertEqual(cursor[key_populate(cursor, i)], expected)
+        cursor.close()
+
+    # Checkpoints stop pacing once the cache is past the eviction dirty
+    # target, rather than sleeping while eviction waits on them.
+    def test_checkpoint_pace_dirty(self):
+        self.conn.reconfigure('cache_size=10MB')
+        self.populate()
+
+        start = self.get_stat(stat.conn.txn_checkpoint)
+        time.sleep(5)
+        self.assertGreaterEqual(
+            self.get_stat(stat.conn.txn_checkpoint) - start, 2)
+        self.assertGreater(
+            self.get_stat(stat.conn.txn_checkpoint_pace_dirty), 0)
+
+    # Pacing can be turned on and off while open.
+    def test_checkpoint_pace_reconfig(self):
+        self.conn.reconfigure('checkpoint=(wait=1,pace_read_latency=0)')
+        self.conn.reconfigure('checkpoint=(wait=1,pace_read_latency=5000)')
+        simple_populate(self, self.uri, 'key_format=S', 1000)
+        self.session.checkpoint()
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,98 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2016 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from wiredtiger import stat
+from helper import key_populate, simple_populate
+
+# test_checkpoint04.py
+#    Checkpoint with threads reconciling the leaf pages.
+class test_checkpoint04(wttest.WiredTigerTestCase):
+    uri = 'table:test_checkpoint04'
+    nentries = 20000
+    conn_config = 'checkpoint=(threads=4),statistics=(fast)'
+
+    def get_stat(self, statistic):
+        statcursor = self.session.open_cursor('statistics:', None, None)
+        value = statcursor[statistic][2]
+        statcursor.close()
+        return value
+
+    def update(self, value):
+        cursor = self.session.open_cursor(self.uri, None)
+        for i in range(1, self.nentries + 1):
+            cursor[key_populate(cursor, i)] = value
+        cursor.close()
+
+    def check(self, value, config=None):
+        cursor = self.session.open_cursor(self.uri, None, config)
+        i = 0
+        for key, v in cursor:
+            i += 1
+            self.assertEqual(key, key_populate(cursor, i))
+            self.assertEqual(v, value)
+        self.assertEqual(i, self.nentries)
+        cursor.close()
+
+    # The checkpoint written by the threads holds the committed updates, and
+    # not the updates of a transaction running while it was taken.
+    def test_checkpoint_threads(self):
+        simple_populate(self, self.uri,
+            'key_format=S,leaf_page_max=4KB', self.nentries)
+        self.update('committed')
+
+        session2 = self.conn.open_session()
+        session2.begin_transaction('isolation=snapshot')
+        cursor = session2.open_cursor(self.uri, None)
+        for i in range(1, self.nentries + 1, 10):
+            cursor[key_populate(cursor, i)] = 'uncommitted'
+        self.session.checkpoint()
+        session2.rollback_transaction()
+        session2.close()
+
+        self.check('committed', 'checkpoint=WiredTigerCheckpoint')
+        self.assertGreater(
+            self.get_stat(stat.conn.txn_checkpoint_threads_pages), 0)
+
+        self.reopen_conn()
+        self.check('committed')
+
+    # The threads can be resized, turned off and back on while open.
+    def test_checkpoint_threads_reconfig(self):
+        simple_populate(self, self.uri,
+            'key_format=S,leaf_page_max=4KB', self.nentries)
+        for config, value in (('checkpoint=(threads=1)', 'one'),
+            ('checkpoint=(threads=0)', 'none'),
+            ('checkpoint=(threads=8)', 'eight')):
+            self.conn.reconfigure(config)
+            self.update(value)
+            self.session.checkpoint()
+            self.check(value, 'checkpoint=WiredTigerCheckpoint')
+
+if __name__ == '__main__':
+    wttest.run()
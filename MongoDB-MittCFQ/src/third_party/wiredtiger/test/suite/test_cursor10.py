@@ -0,0 +1,113 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2016 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from wiredtiger import stat
+from helper import key_populate, simple_populate, value_populate
+from wtscenario import make_scenarios
+
+# test_cursor10.py
+#    Scan a tree bigger than the cache with a read_once cursor.
+class test_cursor10(wttest.WiredTigerTestCase):
+    uri = 'table:test_cursor10'
+    hot_uri = 'table:test_cursor10_hot'
+    nentries = 50000
+    nhot = 500
+    conn_config = 'cache_size=2MB,statistics=(fast)'
+
+    scenarios = make_scenarios([
+        ('no-readahead', dict(readahead='readahead=(pages=0)')),
+        ('readahead', dict(readahead='readahead=(pages=8)')),
+    ])
+
+    # Read-once cursors must return the same records, in both directions.
+    def test_cursor_read_once(self):
+        simple_populate(self, self.uri,
+            'key_format=S,leaf_page_max=4KB', self.nentries)
+        self.conn.reconfigure(self.readahead)
+
+        cursor = self.session.open_cursor(self.uri, None, 'read_once=true')
+        i = 0
+        for key, value in cursor:
+            i += 1
+            self.assertEqual(key, key_populate(cursor, i))
+            self.assertEqual(value, value_populate(cursor, i))
+        self.assertEqual(i, self.nentries)
+
+        cursor.reset()
+        while cursor.prev() == 0:
+            self.assertEqual(cursor.get_key(), key_populate(cursor, i))
+            i -= 1
+        self.assertEqual(i, 0)
+        cursor.close()
+
+    def read_hot(self):
+        cursor = self.session.open_cursor(self.hot_uri, None)
+        for i in range(1, self.nhot + 1):
+            self.assertEqual(
+                cursor[key_populate(cursor, i)], value_populate(cursor, i))
+        cursor.close()
+
+    def hot_pages_read(self):
+        statcursor = self.session.open_cursor(
+            'statistics:' + self.hot_uri, None, None)
+        value = statcursor[stat.dsrc.cache_read][2]
+        statcursor.close()
+        return value
+
+    # A read-once scan of a tree bigger than the cache must not evict a hot
+    # working set: the scan's pages are at the oldest read generation, so
+    # eviction takes them first.
+    def test_cursor_read_once_keeps_working_set(self):
+        config = 'key_format=S,leaf_page_max=4KB'
+        simple_populate(self, self.hot_uri, config, self.nhot)
+        simple_populate(self, self.uri, config, self.nentries)
+        self.reopen_conn()
+        self.conn.reconfigure(self.readahead)
+
+        self.read_hot()
+        hot_reads = self.hot_pages_read()
+        self.assertGreater(hot_reads, 0)
+
+        cursor = self.session.open_cursor(self.uri, None, 'read_once=true')
+        self.assertEqual(sum(1 for _ in cursor), self.nentries)
+        cursor.close()
+
+        self.read_hot()
+        self.assertEqual(self.hot_pages_read(), hot_reads)
+
+    # Read-once cursors can still update.
+    def test_cursor_read_once_update(self):
+        simple_populate(self, self.uri, 'key_format=S', 100)
+        cursor = self.session.open_cursor(self.uri, None, 'read_once=true')
+        cursor[key_populate(cursor, 1)] = 'updated'
+        self.assertEqual(cursor[key_populate(cursor, 1)], 'updated')
+        cursor.close()
+
+if __name__ == '__main__':
+    wttest.run()
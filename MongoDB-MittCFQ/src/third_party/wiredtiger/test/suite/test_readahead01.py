@@ -0,0 +1,104 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2016 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import time
+import wiredtiger, wttest
+from wiredtiger import stat
+from helper import key_populate, simple_populate, value_populate
+
+# test_readahead01.py
+#    Scan a tree from a cold cache with leaf-page readahead configured.
+class test_readahead01(wttest.WiredTigerTestCase):
+    uri = 'table:test_readahead01'
+    nentries = 20000
+    conn_config = 'readahead=(pages=8,threads=2),statistics=(fast)'
+
+    def get_stat(self, statistic):
+        statcursor = self.session.open_cursor('statistics:', None, None)
+        value = statcursor[statistic][2]
+        statcursor.close()
+        return value
+
+    def populate(self):
+        simple_populate(self, self.uri,
+            'key_format=S,leaf_page_max=4KB', self.nentries)
+        # Reopen so the scan starts with nothing in the cache.
+        self.reopen_conn()
+
+    # The readahead threads can fall behind a scan of a file the OS has
+    # cached, finding every page already read. Pause the scan a few leaf
+    # pages in until they have read some pages ahead of it.
+    def wait_for_read_ahead(self):
+        for i in range(300):
+            if self.get_stat(stat.conn.cache_read_ahead) > 0:
+                break
+            time.sleep(0.1)
+        self.assertGreater(self.get_stat(stat.conn.cache_read_ahead), 0)
+        self.assertLessEqual(self.get_stat(stat.conn.cache_read_ahead),
+            self.get_stat(stat.conn.cache_read))
+
+    # Readahead must not change what a forward scan returns.
+    def test_readahead_next(self):
+        self.populate()
+        cursor = self.session.open_cursor(self.uri, None)
+        i = 0
+        for key, value in cursor:
+            i += 1
+            self.assertEqual(key, key_populate(cursor, i))
+            self.assertEqual(value, value_populate(cursor, i))
+            if i == 500:
+                self.wait_for_read_ahead()
+        self.assertEqual(i, self.nentries)
+        cursor.close()
+
+    # Readahead must not change what a backward scan returns.
+    def test_readahead_prev(self):
+        self.populate()
+        cursor = self.session.open_cursor(self.uri, None)
+        i = self.nentries
+        while cursor.prev() == 0:
+            self.assertEqual(cursor.get_key(), key_populate(cursor, i))
+            self.assertEqual(cursor.get_value(), value_populate(cursor, i))
+            i -= 1
+            if i == self.nentries - 500:
+                self.wait_for_read_ahead()
+        self.assertEqual(i, 0)
+        cursor.close()
+
+    # Readahead can be resized, turned off and back on while open.
+    def test_readahead_reconfig(self):
+        self.populate()
+        self.conn.reconfigure('readahead=(threads=4)')
+        self.conn.reconfigure('readahead=(pages=0)')
+        self.conn.reconfigure('readahead=(pages=32,threads=1)')
+        cursor = self.session.open_cursor(self.uri, None)
+        self.assertEqual(sum(1 for _ in cursor), self.nentries)
+        cursor.close()
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,111 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2016 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import bisect, wiredtiger, wttest
+from wtscenario import make_scenarios
+
+# test_search_prefix01.py
+#    Search and search-near on row-store leaf pages read with and without
+#    search prefixes, with and without prefix compression.
+class test_search_prefix01(wttest.WiredTigerTestCase):
+    uri = 'table:test_search_prefix01'
+
+    scenarios = make_scenarios([
+        ('prefix', dict(search_prefix='true')),
+        ('no-prefix', dict(search_prefix='false')),
+    ], [
+        ('compressed', dict(compression='true')),
+        ('not-compressed', dict(compression='false')),
+    ])
+
+    # Keys sharing a long prefix, some of them prefixes of others, some
+    # differing only past the first 8 bytes after the shared prefix.
+    def make_keys(self):
+        keys = set()
+        for i in range(0, 20000):
+            keys.add('shared/prefix/' + str(i * 7))
+            keys.add('shared/prefix/' + str(i * 7) + 'suffix' + str(i % 13))
+            keys.add('shared/prefix/%08d/%d' % (i % 100, i))
+        return sorted(keys)
+
+    # Keys not in the tree: between, before and after the loaded keys, and
+    # keys without the shared prefix.
+    def absent_keys(self, keys):
+        absent = ['', 'a', 'shared', 'shared/prefix', 'shared/prefix/',
+            'shared/prefiy', 'shared/prefix/\x7f', 'z']
+        for i in range(0, len(keys), 97):
+            absent.append(keys[i] + '\x01')
+            absent.append(keys[i][:-1])
+        return [k for k in absent if k not in self.loaded]
+
+    def test_search_prefix(self):
+        self.session.create(self.uri, 'key_format=S,value_format=S,' +
+            'leaf_page_max=4KB,leaf_search_prefix=' + self.search_prefix +
+            ',prefix_compression=' + self.compression)
+
+        # Load every other key, then reopen so the pages are read from disk.
+        keys = self.make_keys()
+        self.loaded = set(keys[::2])
+        cursor = self.session.open_cursor(self.uri, None)
+        for k in keys[::2]:
+            cursor[k] = 'value' + k
+        cursor.close()
+        self.reopen_conn()
+
+        loaded = sorted(self.loaded)
+        cursor = self.session.open_cursor(self.uri, None)
+        for k in keys + self.absent_keys(keys):
+            cursor.set_key(k)
+            if k in self.loaded:
+                self.assertEqual(cursor.search(), 0)
+                self.assertEqual(cursor.get_value(), 'value' + k)
+            else:
+                self.assertEqual(cursor.search(), wiredtiger.WT_NOTFOUND)
+
+            cursor.set_key(k)
+            exact = cursor.search_near()
+            found = cursor.get_key()
+            if exact == 0:
+                self.assertEqual(found, k)
+            elif exact > 0:
+                self.assertEqual(found, loaded[bisect.bisect_left(loaded, k)])
+            else:
+                self.assertEqual(
+                    found, loaded[bisect.bisect_left(loaded, k) - 1])
+
+        # Insert the remaining keys into the pages read with prefixes, and
+        # check they're all found.
+        for k in keys[1::2]:
+            cursor[k] = 'value' + k
+        for k in keys:
+            cursor.set_key(k)
+            self.assertEqual(cursor.search(), 0)
+        cursor.close()
+
+if __name__ == '__main__':
+    wttest.run()
@@ -0,0 +1,87 @@
+#!/usr/bin/env python
+#
+# Public Domain 2014-2016 MongoDB, Inc.
+# Public Domain 2008-2014 WiredTiger, Inc.
+#
+# This is free and unencumbered software released into the public domain.
+#
+# Anyone is free to copy, modify, publish, use, compile, sell, or
+# distribute this software, either in source code form or as a compiled
+# binary, for any purpose, commercial or non-commercial, and by any
+# means.
+#
+# In jurisdictions that recognize copyright laws, the author or authors
+# of this software dedicate any and all copyright interest in the
+# software to the public domain. We make this dedication for the benefit
+# of the public at large and to the detriment of our heirs and
+# successors. We intend this dedication to be an overt act of
+# relinquishment in perpetuity of all present and future rights to this
+# software under copyright law.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+# OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+# ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+# OTHER DEALINGS IN THE SOFTWARE.
+
+import wiredtiger, wttest
+from wiredtiger import stat
+from helper import simple_populate
+
+# test_stat06.py
+#    Block read latency histograms, for the connection and for each file.
+class test_stat06(wttest.WiredTigerTestCase):
+    uri = 'table:test_stat06'
+    conn_config = 'cache_size=1MB,statistics=(fast)'
+    nentries = 50000
+
+    conn_buckets = [
+        stat.conn.block_read_latency_lt64,
+        stat.conn.block_read_latency_lt256,
+        stat.conn.block_read_latency_lt1024,
+        stat.conn.block_read_latency_lt4096,
+        stat.conn.block_read_latency_lt16384,
+        stat.conn.block_read_latency_lt65536,
+        stat.conn.block_read_latency_lt262144,
+        stat.conn.block_read_latency_gt262144,
+    ]
+    dsrc_buckets = [
+        stat.dsrc.block_read_latency_lt64,
+        stat.dsrc.block_read_latency_lt256,
+        stat.dsrc.block_read_latency_lt1024,
+        stat.dsrc.block_read_latency_lt4096,
+        stat.dsrc.block_read_latency_lt16384,
+        stat.dsrc.block_read_latency_lt65536,
+        stat.dsrc.block_read_latency_lt262144,
+        stat.dsrc.block_read_latency_gt262144,
+    ]
+
+    def get_stats(self, uri, stats):
+        statcursor = self.session.open_cursor('statistics:' + uri, None, None)
+        values = [statcursor[s][2] for s in stats]
+        statcursor.close()
+        return values
+
+    def test_read_latency(self):
+        simple_populate(self, self.uri, 'key_format=S', self.nentries)
+        self.reopen_conn()
+
+        cursor = self.session.open_cursor(self.uri, None)
+        self.assertEqual(sum(1 for _ in cursor), self.nentries)
+        cursor.close()
+
+        # Every block read is counted once in the connection's histogram.
+        buckets = self.get_stats('', self.conn_buckets)
+        reads = self.get_stats('', [stat.conn.block_read])[0]
+        self.assertGreater(reads, 0)
+        self.assertEqual(sum(buckets), reads)
+
+        # The table's reads are counted in its own histogram.
+        buckets = self.get_stats(self.uri, self.dsrc_buckets)
+        self.assertGreater(sum(buckets), 0)
+        self.assertLessEqual(sum(buckets), reads)
+
+if __name__ == '__main__':
+    wttest.run()
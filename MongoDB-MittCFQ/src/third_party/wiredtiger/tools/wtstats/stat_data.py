@@ -3,6 +3,9 @@
 no_scale_per_second_list = [
     'async: current work queue length',
     'async: maximum work queue length',
+    'block-manager: block cache blocks',
+    'block-manager: block cache bytes',
+    'block-manager: block cache maximum bytes configured',
     'cache: bytes belonging to page images in the cache',
     'cache: bytes currently in the cache',
     'cache: bytes not belonging to page images in the cache',
@@ -57,6 +60,8 @@ no_scale_per_second_list = [
     'transaction: transaction checkpoint max time (msecs)',
     'transaction: transaction checkpoint min time (msecs)',
     'transaction: transaction checkpoint most recent time (msecs)',
+    'transaction: transaction checkpoint pacing application read latency (usecs)',
+    'transaction: transaction checkpoint pacing target rate (bytes per second)',
     'transaction: transaction checkpoint scrub dirty target',
     'transaction: transaction checkpoint scrub time (msecs)',
     'transaction: transaction checkpoint total time (msecs)',
@@ -99,6 +104,9 @@ no_scale_per_second_list = [
 ]
 no_clear_list = [
     'async: maximum work queue length',
+    'block-manager: block cache blocks',
+    'block-manager: block cache bytes',
+    'block-manager: block cache maximum bytes configured',
     'cache: bytes belonging to page images in the cache',
     'cache: bytes currently in the cache',
     'cache: bytes not belonging to page images in the cache',
@@ -151,6 +159,8 @@ no_clear_list = [
     'transaction: transaction checkpoint max time (msecs)',
     'transaction: transaction checkpoint min time (msecs)',
     'transaction: transaction checkpoint most recent time (msecs)',
+    'transaction: transaction checkpoint pacing application read latency (usecs)',
+    'transaction: transaction checkpoint pacing target rate (bytes per second)',
     'transaction: transaction checkpoint scrub dirty target',
     'transaction: transaction checkpoint scrub time (msecs)',
     'transaction: transaction checkpoint total time (msecs)',
@@ -26,6 +26,7 @@ package com.yahoo.ycsb.db;
 
 import com.mongodb.MongoClient;
 import com.mongodb.MongoClientURI;
+import com.mongodb.MongoException;
 import com.mongodb.ReadPreference;
 import com.mongodb.WriteConcern;
 import com.mongodb.client.FindIterable;
@@ -70,6 +71,9 @@ import java.util.Random;
 public class MongoDbClient extends DB {
 	private static Random random = new Random();
 
+	/** Error code returned by mongod when a deadline read is rejected (ErrorCodes::StorageBusy). */
+	private static final int STORAGE_BUSY_ERROR_CODE = 195;
+
 	/** Used to include a field in a response. */
 	private static final Integer INCLUDE = Integer.valueOf(1);
 
@@ -319,44 +323,18 @@ public class MongoDbClient extends DB {
 	@Override
 	public Status read(String table, String key, Set<String> fields, HashMap<String, ByteIterator> result) {
 		mz_count++;
-		MongoDatabase mz_db;
+		MongoDatabase[] mz_dbs = { database, database2, database3 };
 		int mz_index = random.nextInt(3);
 		// int mz_index = mz_count%3;
-		if (mz_index == 0) {
-			mz_db = database;
-		} else if (mz_index == 1) {
-			mz_db = database2;
-		} else {
-			mz_db = database3;
-		}
 		try {
-			MongoCollection<Document> collection = mz_db.getCollection(table);
-			Document query = new Document("_id", key);
-
-			FindIterable<Document> findIterable = collection.find(query);
-
-			if (fields != null) {
-				Document projection = new Document();
-				for (String field : fields) {
-					projection.put(field, INCLUDE);
-				}
-				findIterable.projection(projection);
-			}
-
-			Document queryResult = findIterable.first();
-			String entry_key = (String) queryResult.get("_id");
-			if (entry_key.equals("user0123456789")) {
-				if (mz_index == 0) {
-					mz_db = database2;
-				} else if (mz_index == 1) {
-					mz_db = database3;
-				} else if (mz_index == 2) {
-					mz_db = database;
-				}
-				collection = mz_db.getCollection(table);
-				query = new Document("_id", key);
+			// Try each replica in turn, starting from a random one. A replica whose disk
+			// cannot serve the read within its deadline answers with StorageBusy.
+			for (int attempt = 0; attempt < mz_dbs.length; attempt++) {
+				MongoDatabase mz_db = mz_dbs[(mz_index + attempt) % mz_dbs.length];
+				MongoCollection<Document> collection = mz_db.getCollection(table);
+				Document query = new Document("_id", key);
 
-				findIterable = collection.find(query);
+				FindIterable<Document> findIterable = collection.find(query);
 
 				if (fields != null) {
 					Document projection = new Document();
@@ -366,49 +344,22 @@ public class MongoDbClient extends DB {
 					findIterable.projection(projection);
 				}
 
-				queryResult = findIterable.first();
-				entry_key = (String) queryResult.get("_id");
-				if (entry_key.equals("user0123456789")) {
-					if (mz_index == 0) {
-						mz_db = database3;
-					} else if (mz_index == 1) {
-						mz_db = database;
-					} else if (mz_index == 2) {
-						mz_db = database2;
-					}
-					collection = mz_db.getCollection(table);
-					query = new Document("_id", key);
-
-					findIterable = collection.find(query);
-
-					if (fields != null) {
-						Document projection = new Document();
-						for (String field : fields) {
-							projection.put(field, INCLUDE);
-						}
-						findIterable.projection(projection);
-					}
-
+				Document queryResult;
+				try {
 					queryResult = findIterable.first();
-					entry_key = (String) queryResult.get("_id");
-					if (entry_key.equals("user0123456789")) {
-						return Status.ERROR;
+				} catch (MongoException e) {
+					if (e.getCode() == STORAGE_BUSY_ERROR_CODE) {
+						continue;
 					}
-					if (queryResult != null) {
-						fillMap(result, queryResult);
-					}
-					return queryResult != null ? Status.OK : Status.NOT_FOUND;
+					throw e;
 				}
+
 				if (queryResult != null) {
 					fillMap(result, queryResult);
 				}
 				return queryResult != null ? Status.OK : Status.NOT_FOUND;
 			}
-
-			if (queryResult != null) {
-				fillMap(result, queryResult);
-			}
-			return queryResult != null ? Status.OK : Status.NOT_FOUND;
+			return Status.ERROR;
 		} catch (Exception e) {
 			return Status.ERROR;
 		}
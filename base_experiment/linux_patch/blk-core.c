@@ -102,17 +102,18 @@ int cur_value(struct history *x){
         return x->latencies[x->index];
 }
 
-bool can_accept(struct history *x, int value){
+bool can_accept(struct history *x, struct sla_timestamp *ts, int value){
+                int threshold = ts->deadline_us > 0 ? ts->deadline_us : x->latency_threshold;
                 /*if(x->slow_count<x->slowcount_threshold){
 			//printk(KERN_DEBUG "Mingzhe: cur_value %i value %i, returning true\n", cur_value(x), value);
                         return true;
                 }else{*/
                         int curV = cur_value(x);
-                        if(curV > x->latency_threshold){
+                        if(curV > threshold){
 				//printk(KERN_DEBUG "Mingzhe: cur_value %i value %i, returning true\n", cur_value(x), value);
                                 return true;
                         }else{
-				if(value <= x->latency_threshold){
+				if(value <= threshold){
 					return true;
 				}
                         	return false;
@@ -1952,9 +1953,19 @@ generic_make_request_checks(struct bio *bio)
 						//printk(KERN_DEBUG "Mingzhe: diff %lu, offset %lu, total_latency %lu\n",diff,offset,total_latency);
 					}
 					accept_predict(bio->sla_history,total_latency);
-					if(!can_accept(bio->sla_history,total_latency)){
+					cfqd->mitt_predicted_us = total_latency;
+					if(!can_accept(bio->sla_history,bio->sla_ts,total_latency)){
+						cfqd->mitt_rejected++;
+						bio->sla_ts->rejected = 1;
+						bio->sla_ts = NULL;
 						goto end_io;	
 					}
+					cfqd->mitt_admitted++;
+					/*
+					 * The timestamp is on the reader's stack: stacked
+					 * drivers resubmitting the bio later must not see it.
+					 */
+					bio->sla_ts = NULL;
 				}
                         }
                 }
@@ -15,6 +15,7 @@
 #include <linux/ioprio.h>
 #include <linux/blktrace_api.h>
 #include <linux/blk-cgroup.h>
+#include <linux/history.h>
 #include "blk.h"
 
 
@@ -335,6 +336,10 @@ struct cfq_data {
 	int serial_number;
 	u64 rq_completed_sector;
 	struct request_data *driver_head;
+	/* MittCFQ admission counters, shown in iosched/mitt_* */
+	u64 mitt_admitted;
+	u64 mitt_rejected;
+	long mitt_predicted_us;
 	//
 	struct request_queue *queue;
 	/* Root service tree for cfq_groups */
@@ -4864,6 +4869,32 @@ USEC_STORE_FUNCTION(cfq_slice_async_us_store, &cfqd->cfq_slice[0], 1, UINT_MAX);
 USEC_STORE_FUNCTION(cfq_target_latency_us_store, &cfqd->cfq_target_latency, 1, UINT_MAX);
 #undef USEC_STORE_FUNCTION
 
+static ssize_t cfq_mitt_admitted_show(struct elevator_queue *e, char *page)
+{
+	struct cfq_data *cfqd = e->elevator_data;
+	return sprintf(page, "%llu\n", (unsigned long long)cfqd->mitt_admitted);
+}
+
+static ssize_t cfq_mitt_rejected_show(struct elevator_queue *e, char *page)
+{
+	struct cfq_data *cfqd = e->elevator_data;
+	return sprintf(page, "%llu\n", (unsigned long long)cfqd->mitt_rejected);
+}
+
+static ssize_t cfq_mitt_predicted_wait_us_show(struct elevator_queue *e, char *page)
+{
+	struct cfq_data *cfqd = e->elevator_data;
+	return sprintf(page, "%ld\n", cfqd->mitt_predicted_us);
+}
+
+static ssize_t cfq_mitt_prediction_error_us_show(struct elevator_queue *e, char *page)
+{
+	return sprintf(page, "%ld\n", mitt_prediction_error_us());
+}
+
+#define CFQ_RO_ATTR(name) \
+	__ATTR(name, S_IRUGO, cfq_##name##_show, NULL)
+
 #define CFQ_ATTR(name) \
 	__ATTR(name, S_IRUGO|S_IWUSR, cfq_##name##_show, cfq_##name##_store)
 
@@ -4885,6 +4916,10 @@ static struct elv_fs_entry cfq_attrs[] = {
 	CFQ_ATTR(low_latency),
 	CFQ_ATTR(target_latency),
 	CFQ_ATTR(target_latency_us),
+	CFQ_RO_ATTR(mitt_admitted),
+	CFQ_RO_ATTR(mitt_rejected),
+	CFQ_RO_ATTR(mitt_predicted_wait_us),
+	CFQ_RO_ATTR(mitt_prediction_error_us),
 	__ATTR_NULL
 };
 
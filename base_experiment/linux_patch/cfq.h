@@ -333,6 +333,10 @@ struct cfq_data {
 	int serial_number;
         u64 rq_completed_sector;
         struct request_data *driver_head;
+	/* MittCFQ admission counters, shown in iosched/mitt_* */
+	u64 mitt_admitted;
+	u64 mitt_rejected;
+	long mitt_predicted_us;
 	struct request_queue *queue;
 	/* Root service tree for cfq_groups */
 	struct cfq_rb_root grp_service_tree;
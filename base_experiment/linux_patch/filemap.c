@@ -1661,12 +1661,56 @@ static void shrink_readahead_size_eio(struct file *filp,
 	ra->ra_pages /= 4;
 }
 
+/*
+ * deadline_read_pages - read the missing pages of a deadline read
+ *
+ * Like readahead, the missing pages of [index, last_index) go to the
+ * filesystem in one batch, but through readpages_sla so their bios carry the
+ * read's deadline.  Nothing beyond the pages asked for is read: readahead
+ * would issue I/O the deadline doesn't bound.
+ */
+static void deadline_read_pages(struct file *filp,
+		struct address_space *mapping, pgoff_t index, pgoff_t last_index,
+		struct sla_timestamp *sla_ts, struct history *sla_history)
+{
+	LIST_HEAD(page_pool);
+	gfp_t gfp_mask = mapping_gfp_mask(mapping) |
+		__GFP_COLD | __GFP_NORETRY | __GFP_NOWARN;
+	unsigned nr_pages = 0;
+	pgoff_t offset;
+
+	for (offset = index; offset < last_index; offset++) {
+		struct page *page;
+
+		rcu_read_lock();
+		page = radix_tree_lookup(&mapping->page_tree, offset);
+		rcu_read_unlock();
+		if (page && !radix_tree_exceptional_entry(page))
+			continue;
+
+		page = __page_cache_alloc(gfp_mask);
+		if (!page)
+			break;
+		page->index = offset;
+		list_add(&page->lru, &page_pool);
+		nr_pages++;
+	}
+
+	if (nr_pages)
+		mapping->a_ops->readpages_sla(filp, mapping, &page_pool,
+				nr_pages, sla_ts, sla_history);
+	/* Clean up the pages the filesystem didn't add to the page cache. */
+	put_pages_list(&page_pool);
+}
+
 /**
  * do_generic_file_read - generic file read routine
  * @filp:	the file to read
  * @ppos:	current file position
  * @iter:	data destination
  * @written:	already copied
+ * @sla_ts:	the deadline of an mzpread64 read, or NULL
+ * @sla_history:	the latency history of @sla_ts
  *
  * This is a generic file read routine, and uses the
  * mapping->a_ops->readpage() function for the actual low-level stuff.
@@ -1675,7 +1719,8 @@ static void shrink_readahead_size_eio(struct file *filp,
  * of the logic when it comes to error handling etc.
  */
 static ssize_t do_generic_file_read(struct file *filp, loff_t *ppos,
-		struct iov_iter *iter, ssize_t written)
+		struct iov_iter *iter, ssize_t written,
+		struct sla_timestamp *sla_ts, struct history *sla_history)
 {
 	struct address_space *mapping = filp->f_mapping;
 	struct inode *inode = mapping->host;
@@ -1687,6 +1732,11 @@ static ssize_t do_generic_file_read(struct file *filp, loff_t *ppos,
 	unsigned int prev_offset;
 	int error = 0;
 
+	/* Only filesystems that can tag their bios get deadline reads. */
+	if (sla_ts && (!mapping->a_ops->readpage_sla ||
+	    !mapping->a_ops->readpages_sla))
+		sla_ts = NULL;
+
 	if (unlikely(*ppos >= inode->i_sb->s_maxbytes))
 		return -EINVAL;
 	iov_iter_truncate(iter, inode->i_sb->s_maxbytes);
@@ -1707,14 +1757,18 @@ static ssize_t do_generic_file_read(struct file *filp, loff_t *ppos,
 find_page:
 		page = find_get_page(mapping, index);
 		if (!page) {
-			page_cache_sync_readahead(mapping,
-					ra, filp,
-					index, last_index - index);
+			if (sla_ts)
+				deadline_read_pages(filp, mapping, index,
+						last_index, sla_ts, sla_history);
+			else
+				page_cache_sync_readahead(mapping,
+						ra, filp,
+						index, last_index - index);
 			page = find_get_page(mapping, index);
 			if (unlikely(page == NULL))
 				goto no_cached_page;
 		}
-		if (PageReadahead(page)) {
+		if (PageReadahead(page) && !sla_ts) {
 			page_cache_async_readahead(mapping,
 					ra, filp, page,
 					index, last_index - index);
@@ -1834,7 +1888,11 @@ readpage:
 		 */
 		ClearPageError(page);
 		/* Start the actual read. The read will unlock the page. */
-		error = mapping->a_ops->readpage(filp, page);
+		if (sla_ts)
+			error = mapping->a_ops->readpage_sla(filp, page,
+					sla_ts, sla_history);
+		else
+			error = mapping->a_ops->readpage(filp, page);
 
 		if (unlikely(error)) {
 			if (error == AOP_TRUNCATED_PAGE) {
@@ -1918,12 +1976,6 @@ ssize_t
 generic_file_read_iter(struct kiocb *iocb, struct iov_iter *iter)
 {
 	struct file *file = iocb->ki_filp;
-	if(iocb!=NULL&&iocb->sla_ts!=NULL){
-		//printk(KERN_DEBUG "Mingzhe: filemap get sla\n");
-		file->sla_ts = iocb->sla_ts;
-		file->sla_history = iocb->sla_history;
-		iocb->sla_ts=NULL;
-	}
 	ssize_t retval = 0;
 	size_t count = iov_iter_count(iter);
 
@@ -1964,7 +2016,8 @@ generic_file_read_iter(struct kiocb *iocb, struct iov_iter *iter)
 		}
 	}
 
-	retval = do_generic_file_read(file, &iocb->ki_pos, iter, retval);
+	retval = do_generic_file_read(file, &iocb->ki_pos, iter, retval,
+			iocb->sla_ts, iocb->sla_history);
 out:
 	return retval;
 }
@@ -373,6 +373,12 @@ typedef int (*read_actor_t)(read_descriptor_t *, struct page *,
 struct address_space_operations {
 	int (*writepage)(struct page *page, struct writeback_control *wbc);
 	int (*readpage)(struct file *, struct page *);
+	/* readpage and readpages for deadline reads: the bios carry the deadline */
+	int (*readpage_sla)(struct file *, struct page *,
+			struct sla_timestamp *, struct history *);
+	int (*readpages_sla)(struct file *, struct address_space *,
+			struct list_head *, unsigned,
+			struct sla_timestamp *, struct history *);
 
 	/* Write back some dirty pages from this mapping. */
 	int (*writepages)(struct address_space *, struct writeback_control *);
@@ -431,8 +437,6 @@ int pagecache_write_end(struct file *, struct address_space *mapping,
 				struct page *page, void *fsdata);
 
 struct address_space {
-	struct history *sla_history;
-	struct sla_timestamp *sla_ts;
 	struct inode		*host;		/* owner: inode, block_device */
 	struct radix_tree_root	page_tree;	/* radix tree of all pages */
 	spinlock_t		tree_lock;	/* and lock protecting it */
@@ -880,8 +884,6 @@ static inline int ra_has_index(struct file_ra_state *ra, pgoff_t index)
 }
 
 struct file {
-	struct history	*sla_history;
-	struct sla_timestamp *sla_ts;
 	union {
 		struct llist_node	fu_llist;
 		struct rcu_head 	fu_rcuhead;
@@ -5,6 +5,7 @@
 struct sla_timestamp *alloc_ts(void){
 	struct sla_timestamp *x = kmalloc(sizeof(struct sla_timestamp),GFP_KERNEL);
 	do_gettimeofday(&(x->start_tv));
+	x->deadline_us = 0;
 	return x;
 };
 
@@ -5,8 +5,17 @@
 
 #ifndef global_history_variable
 #define global_history_variable
+/*
+ * One mzpread64 call's deadline.  It lives on the caller's stack and reaches
+ * the bios through the kiocb and the readpage_sla/readpages_sla address space
+ * operations, so concurrent deadline reads of one file each keep their own.
+ */
 struct sla_timestamp {
 	struct timeval start_tv;
+	/* per-read deadline in microseconds; 0 means use history->latency_threshold */
+	long deadline_us;
+	/* set by the block layer when a bio of the read is rejected */
+	int rejected;
 };
 
 struct history {
@@ -20,5 +29,8 @@ struct history {
 	int predicted_latencies[10000];
 	int diff_latencies[10000];
 };
+
+/* mean |actual - predicted| over the recent mzpread64 history, in us */
+extern long mitt_prediction_error_us(void);
 #endif
 
@@ -3187,13 +3187,16 @@ static sector_t ext4_bmap(struct address_space *mapping, sector_t block)
 	return generic_block_bmap(mapping, block, ext4_get_block);
 }
 
-static int ext4_readpage(struct file *file, struct page *page)
+/* In readpage.c; ext4.h isn't part of the MittCFQ patch. */
+extern int ext4_mpage_readpages_sla(struct address_space *mapping,
+				    struct list_head *pages, struct page *page,
+				    unsigned nr_pages, struct sla_timestamp *sla_ts,
+				    struct history *sla_history);
+
+static int ext4_readpage_sla(struct file *file, struct page *page,
+			     struct sla_timestamp *sla_ts,
+			     struct history *sla_history)
 {
-	if(file!=NULL&&file->sla_ts!=NULL){
-		//printk(KERN_DEBUG "Mingzhe: inode.c get sla\n");
-		page->mapping->sla_ts=file->sla_ts;
-		page->mapping->sla_history=file->sla_history;
-	}
 	int ret = -EAGAIN;
 	struct inode *inode = page->mapping->host;
 
@@ -3203,27 +3206,37 @@ static int ext4_readpage(struct file *file, struct page *page)
 		ret = ext4_readpage_inline(inode, page);
 
 	if (ret == -EAGAIN)
-		return ext4_mpage_readpages(page->mapping, NULL, page, 1);
+		return ext4_mpage_readpages_sla(page->mapping, NULL, page, 1,
+						sla_ts, sla_history);
 
 	return ret;
 }
 
+static int ext4_readpage(struct file *file, struct page *page)
+{
+	return ext4_readpage_sla(file, page, NULL, NULL);
+}
+
 static int
-ext4_readpages(struct file *file, struct address_space *mapping,
-		struct list_head *pages, unsigned nr_pages)
+ext4_readpages_sla(struct file *file, struct address_space *mapping,
+		   struct list_head *pages, unsigned nr_pages,
+		   struct sla_timestamp *sla_ts, struct history *sla_history)
 {
-	if(file!=NULL&&file->sla_ts!=NULL){
-		//printk(KERN_DEBUG "Mingzhe: inode.c get sla\n");
-		mapping->sla_ts=file->sla_ts;
-		mapping->sla_history=file->sla_history;
-	}
 	struct inode *inode = mapping->host;
 
 	/* If the file has inline data, no need to do readpages. */
 	if (ext4_has_inline_data(inode))
 		return 0;
 
-	return ext4_mpage_readpages(mapping, pages, NULL, nr_pages);
+	return ext4_mpage_readpages_sla(mapping, pages, NULL, nr_pages,
+					sla_ts, sla_history);
+}
+
+static int
+ext4_readpages(struct file *file, struct address_space *mapping,
+		struct list_head *pages, unsigned nr_pages)
+{
+	return ext4_readpages_sla(file, mapping, pages, nr_pages, NULL, NULL);
 }
 
 static void ext4_invalidatepage(struct page *page, unsigned int offset,
@@ -3632,6 +3645,8 @@ static int ext4_journalled_set_page_dirty(struct page *page)
 static const struct address_space_operations ext4_aops = {
 	.readpage		= ext4_readpage,
 	.readpages		= ext4_readpages,
+	.readpage_sla		= ext4_readpage_sla,
+	.readpages_sla		= ext4_readpages_sla,
 	.writepage		= ext4_writepage,
 	.writepages		= ext4_writepages,
 	.write_begin		= ext4_write_begin,
@@ -3648,6 +3663,8 @@ static const struct address_space_operations ext4_aops = {
 static const struct address_space_operations ext4_journalled_aops = {
 	.readpage		= ext4_readpage,
 	.readpages		= ext4_readpages,
+	.readpage_sla		= ext4_readpage_sla,
+	.readpages_sla		= ext4_readpages_sla,
 	.writepage		= ext4_writepage,
 	.writepages		= ext4_writepages,
 	.write_begin		= ext4_write_begin,
@@ -3664,6 +3681,8 @@ static const struct address_space_operations ext4_journalled_aops = {
 static const struct address_space_operations ext4_da_aops = {
 	.readpage		= ext4_readpage,
 	.readpages		= ext4_readpages,
+	.readpage_sla		= ext4_readpage_sla,
+	.readpages_sla		= ext4_readpages_sla,
 	.writepage		= ext4_writepage,
 	.writepages		= ext4_writepages,
 	.write_begin		= ext4_da_write_begin,
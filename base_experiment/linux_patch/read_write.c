@@ -74,16 +74,20 @@ void accept(struct history *x, int value){
         }
 };
 
+long mitt_prediction_error_us(void){
+	int count = global_history.count;
+	if(count==0){
+		return 0;
+	}
+	return global_history.total_diff/count;
+}
+EXPORT_SYMBOL(mitt_prediction_error_us);
+
 static inline int unsigned_offsets(struct file *file)
 {
 	return file->f_mode & FMODE_UNSIGNED_OFFSET;
 }
 
-struct sla_timestamp *alloc_ts(void){
-        struct sla_timestamp *x = kmalloc(sizeof(struct sla_timestamp),GFP_KERNEL);
-        do_gettimeofday(&(x->start_tv));
-        return x;
-};
 
 void reset_history(struct history x){
         x.index=0;
@@ -493,11 +497,6 @@ static ssize_t new_sync_read(struct file *filp, char __user *buf, size_t len, lo
 	init_sync_kiocb(&kiocb, filp);
 	kiocb.ki_pos = *ppos;
 	iov_iter_init(&iter, READ, &iov, 1, len);
-	if(filp->sla_ts!=NULL){
-		kiocb.sla_history = filp->sla_history;
-		kiocb.sla_ts = filp->sla_ts;
-        	filp->sla_ts = NULL;
-	}
 
 	ret = filp->f_op->read_iter(&kiocb, &iter);
 	BUG_ON(ret == -EIOCBQUEUED);
@@ -695,31 +694,85 @@ SYSCALL_DEFINE4(pread64, unsigned int, fd, char __user *, buf,
 	return ret;
 }
 
-SYSCALL_DEFINE4(mzpread64, unsigned int, fd, char __user *, buf,
-                        size_t, count, loff_t, pos)
+/*
+ * vfs_read for mzpread64: the read's deadline goes down in the kiocb, on the
+ * stack, never in the struct file every thread reading the file shares.
+ * Files without read_iter are read without a deadline.
+ */
+static ssize_t mz_vfs_read(struct file *file, char __user *buf, size_t count,
+			   loff_t *pos, struct sla_timestamp *ts)
+{
+	struct iovec iov = { .iov_base = buf, .iov_len = count };
+	struct kiocb kiocb;
+	struct iov_iter iter;
+	ssize_t ret;
+
+	if (!(file->f_mode & FMODE_READ))
+		return -EBADF;
+	if (!(file->f_mode & FMODE_CAN_READ))
+		return -EINVAL;
+	if (unlikely(!access_ok(VERIFY_WRITE, buf, count)))
+		return -EFAULT;
+
+	ret = rw_verify_area(READ, file, pos, count);
+	if (ret)
+		return ret;
+	if (count > MAX_RW_COUNT)
+		count =  MAX_RW_COUNT;
+
+	if (file->f_op->read_iter) {
+		iov.iov_len = count;
+		init_sync_kiocb(&kiocb, file);
+		kiocb.ki_pos = *pos;
+		kiocb.sla_ts = ts;
+		kiocb.sla_history = &global_history;
+		iov_iter_init(&iter, READ, &iov, 1, count);
+		ret = file->f_op->read_iter(&kiocb, &iter);
+		BUG_ON(ret == -EIOCBQUEUED);
+		*pos = kiocb.ki_pos;
+	} else
+		ret = __vfs_read(file, buf, count, pos);
+	if (ret > 0) {
+		fsnotify_access(file);
+		add_rchar(current, ret);
+	}
+	inc_syscr(current);
+	return ret;
+}
+
+/*
+ * pread64 that is rejected up front, instead of queued, when the I/O scheduler
+ * predicts it cannot complete within deadline_us microseconds. A deadline_us of
+ * 0 uses the global latency threshold. A rejected read fails with EBUSY, or
+ * returns a short count if part of it was read.
+ */
+SYSCALL_DEFINE5(mzpread64, unsigned int, fd, char __user *, buf,
+                        size_t, count, loff_t, pos, long, deadline_us)
 {
 	struct timeval mz_start,mz_end;
 	do_gettimeofday(&mz_start);
 	long start = mz_start.tv_sec * 1000000 + mz_start.tv_usec;
                 
+        struct sla_timestamp ts;
         struct fd f;
         ssize_t ret = -EBADF;
 
         if (pos < 0)
                 return -EINVAL;
 
+	ts.start_tv = mz_start;
+	ts.deadline_us = deadline_us;
+	ts.rejected = 0;
+
         f = fdget(fd);
         if (f.file) {
-
-                struct file* t_file = f.file;
-		t_file->sla_history = &global_history;
-		t_file->sla_ts = alloc_ts();
-
                 ret = -ESPIPE;
                 if (f.file->f_mode & FMODE_PREAD)
-                        ret = vfs_read(f.file, buf, count, &pos);
+                        ret = mz_vfs_read(f.file, buf, count, &pos, &ts);
                 fdput(f);
         }
+	if (ts.rejected && ret <= 0)
+		ret = -EBUSY;
 	do_gettimeofday(&mz_end);
 	long end = mz_end.tv_sec * 1000000 + mz_end.tv_usec;
 	int diff = (int)(end-start);
@@ -95,9 +95,14 @@ static void mpage_end_io(struct bio *bio)
 	bio_put(bio);
 }
 
-int ext4_mpage_readpages(struct address_space *mapping,
-			 struct list_head *pages, struct page *page,
-			 unsigned nr_pages)
+/*
+ * ext4_mpage_readpages for deadline reads: every bio submitted carries the
+ * read's deadline, if there is one.
+ */
+int ext4_mpage_readpages_sla(struct address_space *mapping,
+			     struct list_head *pages, struct page *page,
+			     unsigned nr_pages, struct sla_timestamp *sla_ts,
+			     struct history *sla_history)
 {
 	struct bio *bio = NULL;
 	sector_t last_block_in_bio = 0;
@@ -234,11 +239,6 @@ int ext4_mpage_readpages(struct address_space *mapping,
 		 * BIO off first?
 		 */
 		if (bio && (last_block_in_bio != blocks[0] - 1)) {
-			if(mapping&&mapping->sla_ts!=NULL){
-				//printk(KERN_DEBUG "Mingzhe: read_page get sla\n");
-				bio->sla_ts=mapping->sla_ts;
-				bio->sla_history=mapping->sla_history;
-			}
 		submit_and_realloc:
 			submit_bio(bio);
 			bio = NULL;
@@ -264,6 +264,8 @@ int ext4_mpage_readpages(struct address_space *mapping,
 			bio->bi_end_io = mpage_end_io;
 			bio->bi_private = ctx;
 			bio_set_op_attrs(bio, REQ_OP_READ, 0);
+			bio->sla_ts = sla_ts;
+			bio->sla_history = sla_history;
 		}
 
 		length = first_hole << blkbits;
@@ -273,11 +275,6 @@ int ext4_mpage_readpages(struct address_space *mapping,
 		if (((map.m_flags & EXT4_MAP_BOUNDARY) &&
 		     (relative_block == map.m_len)) ||
 		    (first_hole != blocks_per_page)) {
-			if(mapping&&mapping->sla_ts!=NULL){
-				//printk(KERN_DEBUG "Mingzhe: read_page get sla\n");
-                                bio->sla_ts=mapping->sla_ts;
-                                bio->sla_history=mapping->sla_history;
-                        }
 			submit_bio(bio);
 			bio = NULL;
 		} else
@@ -285,11 +282,6 @@ int ext4_mpage_readpages(struct address_space *mapping,
 		goto next_page;
 	confused:
 		if (bio) {
-			if(mapping&&mapping->sla_ts!=NULL){
-				//printk(KERN_DEBUG "Mingzhe: read_page get sla\n");
-                                bio->sla_ts=mapping->sla_ts;
-                                bio->sla_history=mapping->sla_history;
-                        }
 			submit_bio(bio);
 			bio = NULL;
 		}
@@ -302,16 +294,15 @@ int ext4_mpage_readpages(struct address_space *mapping,
 			put_page(page);
 	}
 	BUG_ON(pages && !list_empty(pages));
-	if (bio){
-		if(mapping&&mapping->sla_ts!=NULL){
-			//printk(KERN_DEBUG "Mingzhe: read_page get sla\n");
-                	bio->sla_ts=mapping->sla_ts;
-                	bio->sla_history=mapping->sla_history;
-                }
+	if (bio)
 		submit_bio(bio);
-	}
-	if(mapping&&mapping->sla_ts!=NULL){
-		mapping->sla_ts=NULL;
-	}
 	return 0;
 }
+
+int ext4_mpage_readpages(struct address_space *mapping,
+			 struct list_head *pages, struct page *page,
+			 unsigned nr_pages)
+{
+	return ext4_mpage_readpages_sla(mapping, pages, page, nr_pages,
+					NULL, NULL);
+}
@@ -572,7 +572,7 @@ asmlinkage long sys_writev(unsigned long fd,
 asmlinkage long sys_pread64(unsigned int fd, char __user *buf,
 			    size_t count, loff_t pos);
 asmlinkage long sys_mzpread64(unsigned int fd, char __user *buf,
-                            size_t count, loff_t pos);
+                            size_t count, loff_t pos, long deadline_us);
 
 asmlinkage long sys_pwrite64(unsigned int fd, const char __user *buf,
 			     size_t count, loff_t pos);
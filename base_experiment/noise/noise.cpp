@@ -0,0 +1,446 @@
+// Trace-driven I/O noise injector.
+//
+// Replays a noise profile against a block device, loop device or regular
+// file.  The profile gives one intensity value per period (10ms by
+// default): the number of I/Os kept outstanding on the target during that
+// period.  The trace loops forever and is aligned to the wall clock, so
+// several nodes started with their own profiles replay in lockstep.
+//
+// I/O is issued through Linux native AIO (io_submit/io_getevents called
+// directly, no libaio needed) from a few worker threads, each owning its
+// own AIO context and a share of the outstanding I/Os.
+//
+// Profile format (see node1.profile):
+//
+//   # comment
+//   period_us 10000        length of one trace period
+//   io_size 1048576        bytes per I/O, also the offset alignment
+//   read_pct 100           percentage of I/Os that are reads
+//   target /dev/sdb        device or file (overridable with -t)
+//   span 966367641600      bytes of the target to spread I/O over
+//                          (0 or absent: the whole target)
+//   intensity              everything after this keyword is the trace,
+//   0 0 3 1 ...            whitespace separated, one value per period
+//
+// Compile: g++ noise.cpp -std=c++11 -O2 -lpthread -o noise
+
+#include <linux/aio_abi.h>
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Profile {
+    long periodUs = 10000;
+    long ioSize = 1024 * 1024;
+    int readPct = 100;
+    std::string target;
+    long long span = 0;
+    std::vector<int> intensity;
+};
+
+struct Options {
+    std::string profilePath;
+    std::string target;
+    int threads = 4;
+    int reportPeriods = 100;
+    long durationSec = 0;
+    long long createSize = 0;
+    bool direct = true;
+    bool allowDeviceWrites = false;
+};
+
+std::atomic<bool> stopping(false);
+std::atomic<long long> doneOps(0);
+std::atomic<long long> doneBytes(0);
+std::atomic<long long> failedOps(0);
+
+int io_setup(unsigned nr, aio_context_t* ctx) {
+    return syscall(SYS_io_setup, nr, ctx);
+}
+
+int io_destroy(aio_context_t ctx) {
+    return syscall(SYS_io_destroy, ctx);
+}
+
+int io_submit(aio_context_t ctx, long nr, struct iocb** iocbs) {
+    return syscall(SYS_io_submit, ctx, nr, iocbs);
+}
+
+int io_getevents(aio_context_t ctx, long minNr, long nr, struct io_event* events,
+                 struct timespec* timeout) {
+    return syscall(SYS_io_getevents, ctx, minNr, nr, events, timeout);
+}
+
+long long nowUs() {
+    struct timeval tv;
+    gettimeofday(&tv, NULL);
+    return (long long)tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+void usage(const char* argv0) {
+    fprintf(stderr,
+            "usage: %s [options] <profile>\n"
+            "  -t <path>     target device or file (overrides the profile)\n"
+            "  -j <n>        worker threads (default 4)\n"
+            "  -r <periods>  report every n periods (default 100)\n"
+            "  -d <seconds>  stop after this long (default: run forever)\n"
+            "  -c <bytes>    create and fill the target file with this size if missing\n"
+            "  -b            buffered I/O instead of O_DIRECT\n"
+            "  -W            allow writes to block devices\n",
+            argv0);
+    exit(1);
+}
+
+bool loadProfile(const std::string& path, Profile* profile) {
+    std::ifstream in(path.c_str());
+    if (!in) {
+        fprintf(stderr, "cannot open profile %s\n", path.c_str());
+        return false;
+    }
+    bool inTrace = false;
+    std::string line;
+    while (std::getline(in, line)) {
+        std::string::size_type hash = line.find('#');
+        if (hash != std::string::npos)
+            line.erase(hash);
+        std::istringstream words(line);
+        std::string key;
+        while (words >> key) {
+            if (inTrace) {
+                profile->intensity.push_back(atoi(key.c_str()));
+                continue;
+            }
+            if (key == "intensity") {
+                inTrace = true;
+            } else if (key == "period_us") {
+                words >> profile->periodUs;
+            } else if (key == "io_size") {
+                words >> profile->ioSize;
+            } else if (key == "read_pct") {
+                words >> profile->readPct;
+            } else if (key == "target") {
+                words >> profile->target;
+            } else if (key == "span") {
+                words >> profile->span;
+            } else {
+                fprintf(stderr, "%s: unknown key '%s'\n", path.c_str(), key.c_str());
+                return false;
+            }
+        }
+    }
+    if (profile->intensity.empty() || profile->periodUs <= 0 || profile->ioSize <= 0 ||
+        profile->readPct < 0 || profile->readPct > 100) {
+        fprintf(stderr, "%s: invalid or empty profile\n", path.c_str());
+        return false;
+    }
+    return true;
+}
+
+// Creates the target and writes all of it: reads of a sparse file's holes,
+// or of fallocate()d but unwritten extents, never reach the device.
+bool createTarget(const std::string& path, long long size) {
+    int fd = open(path.c_str(), O_CREAT | O_EXCL | O_WRONLY, 0644);
+    if (fd < 0) {
+        perror("create target");
+        return false;
+    }
+
+    fprintf(stderr, "filling %s with %lld MB for the noise to read\n", path.c_str(),
+            size >> 20);
+    std::vector<char> chunk(1 << 20, 'n');
+    for (long long offset = 0; offset < size; offset += chunk.size()) {
+        size_t len = std::min(static_cast<long long>(chunk.size()), size - offset);
+        if (pwrite(fd, chunk.data(), len, offset) != static_cast<ssize_t>(len)) {
+            perror("fill target");
+            close(fd);
+            return false;
+        }
+    }
+    if (fsync(fd) != 0) {
+        perror("fill target");
+        close(fd);
+        return false;
+    }
+    close(fd);
+    return true;
+}
+
+// Opens the target once for all workers; AIO on one fd is thread safe.
+int openTarget(const std::string& path, const Options& options, const Profile& profile,
+               long long* size) {
+    struct stat st;
+    bool exists = stat(path.c_str(), &st) == 0;
+    if (!exists && options.createSize > 0) {
+        if (!createTarget(path, options.createSize)) {
+            return -1;
+        }
+        exists = stat(path.c_str(), &st) == 0;
+    }
+    if (!exists) {
+        fprintf(stderr, "target %s does not exist\n", path.c_str());
+        return -1;
+    }
+
+    bool isDevice = S_ISBLK(st.st_mode);
+    bool writes = profile.readPct < 100;
+    if (writes && isDevice && !options.allowDeviceWrites) {
+        fprintf(stderr, "profile writes to block device %s; pass -W to allow\n", path.c_str());
+        return -1;
+    }
+
+    int flags = writes ? O_RDWR : O_RDONLY;
+    int fd = open(path.c_str(), flags | (options.direct ? O_DIRECT : 0));
+    if (fd < 0 && options.direct && errno == EINVAL) {
+        // tmpfs and friends refuse O_DIRECT; the noise still reaches the
+        // page cache, which is better than nothing on a laptop.
+        fprintf(stderr, "O_DIRECT not supported on %s, using buffered I/O\n", path.c_str());
+        fd = open(path.c_str(), flags);
+    }
+    if (fd < 0) {
+        perror("open target");
+        return -1;
+    }
+
+    if (isDevice) {
+        unsigned long long bytes = 0;
+        if (ioctl(fd, BLKGETSIZE64, &bytes) != 0) {
+            perror("BLKGETSIZE64");
+            close(fd);
+            return -1;
+        }
+        *size = bytes;
+    } else {
+        *size = st.st_size;
+    }
+    return fd;
+}
+
+struct Worker {
+    int index;
+    int fd;
+    const Profile* profile;
+    int threads;
+    long long blocks;
+};
+
+// Number of the trace's outstanding I/Os this worker is responsible for.
+int shareOf(int intensity, int index, int threads) {
+    return intensity / threads + (index < intensity % threads ? 1 : 0);
+}
+
+void workerLoop(Worker worker) {
+    const Profile& profile = *worker.profile;
+    int maxShare = 0;
+    for (int value : profile.intensity)
+        maxShare = std::max(maxShare, shareOf(value, worker.index, worker.threads));
+    if (maxShare == 0)
+        return;
+
+    aio_context_t ctx = 0;
+    if (io_setup(maxShare, &ctx) != 0) {
+        perror("io_setup");
+        exit(1);
+    }
+
+    std::vector<struct iocb> iocbs(maxShare);
+    std::vector<void*> buffers(maxShare);
+    std::vector<int> freeSlots;
+    for (int i = 0; i < maxShare; i++) {
+        if (posix_memalign(&buffers[i], 4096, profile.ioSize) != 0) {
+            fprintf(stderr, "cannot allocate I/O buffer\n");
+            exit(1);
+        }
+        memset(buffers[i], 0x5a, profile.ioSize);
+        freeSlots.push_back(i);
+    }
+    std::vector<struct io_event> events(maxShare);
+
+    std::mt19937_64 rng(nowUs() ^ ((unsigned long long)worker.index << 32));
+    std::uniform_int_distribution<long long> pickBlock(0, worker.blocks - 1);
+    std::uniform_int_distribution<int> pickPct(0, 99);
+    int inflight = 0;
+
+    while (!stopping.load()) {
+        long long now = nowUs();
+        long long period = now / profile.periodUs;
+        int target = shareOf(profile.intensity[period % profile.intensity.size()],
+                             worker.index, worker.threads);
+
+        while (inflight < target) {
+            int slot = freeSlots.back();
+            struct iocb* cb = &iocbs[slot];
+            memset(cb, 0, sizeof(*cb));
+            cb->aio_data = slot;
+            cb->aio_fildes = worker.fd;
+            cb->aio_lio_opcode =
+                pickPct(rng) < profile.readPct ? IOCB_CMD_PREAD : IOCB_CMD_PWRITE;
+            cb->aio_buf = (unsigned long long)(uintptr_t)buffers[slot];
+            cb->aio_nbytes = profile.ioSize;
+            cb->aio_offset = pickBlock(rng) * profile.ioSize;
+            if (io_submit(ctx, 1, &cb) != 1) {
+                perror("io_submit");
+                failedOps++;
+                break;
+            }
+            freeSlots.pop_back();
+            inflight++;
+        }
+
+        // Wait for completions, but no longer than the end of this period so
+        // the next period's intensity takes effect on time.
+        long long waitUs = (period + 1) * profile.periodUs - now;
+        if (inflight == 0) {
+            usleep(waitUs);
+            continue;
+        }
+        struct timespec timeout;
+        timeout.tv_sec = waitUs / 1000000;
+        timeout.tv_nsec = (waitUs % 1000000) * 1000;
+        int n = io_getevents(ctx, 1, inflight, events.data(), &timeout);
+        if (n < 0 && errno != EINTR) {
+            perror("io_getevents");
+            exit(1);
+        }
+        for (int i = 0; i < n; i++) {
+            long long res = (long long)events[i].res;
+            if (res == profile.ioSize) {
+                doneOps++;
+                doneBytes += res;
+            } else {
+                failedOps++;
+            }
+            freeSlots.push_back((int)events[i].data);
+            inflight--;
+        }
+    }
+
+    // Drain what is still in flight before the buffers go away.
+    while (inflight > 0) {
+        int n = io_getevents(ctx, 1, inflight, events.data(), NULL);
+        if (n <= 0)
+            break;
+        inflight -= n;
+    }
+    io_destroy(ctx);
+    for (void* buffer : buffers)
+        free(buffer);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    int opt;
+    while ((opt = getopt(argc, argv, "t:j:r:d:c:bW")) != -1) {
+        switch (opt) {
+            case 't':
+                options.target = optarg;
+                break;
+            case 'j':
+                options.threads = atoi(optarg);
+                break;
+            case 'r':
+                options.reportPeriods = atoi(optarg);
+                break;
+            case 'd':
+                options.durationSec = atol(optarg);
+                break;
+            case 'c':
+                options.createSize = atoll(optarg);
+                break;
+            case 'b':
+                options.direct = false;
+                break;
+            case 'W':
+                options.allowDeviceWrites = true;
+                break;
+            default:
+                usage(argv[0]);
+        }
+    }
+    if (optind != argc - 1 || options.threads <= 0 || options.reportPeriods <= 0)
+        usage(argv[0]);
+    options.profilePath = argv[optind];
+
+    Profile profile;
+    if (!loadProfile(options.profilePath, &profile))
+        return 1;
+    if (!options.target.empty())
+        profile.target = options.target;
+    if (profile.target.empty()) {
+        fprintf(stderr, "no target given in the profile or with -t\n");
+        return 1;
+    }
+
+    long long size = 0;
+    int fd = openTarget(profile.target, options, profile, &size);
+    if (fd < 0)
+        return 1;
+    long long span = profile.span > 0 && profile.span < size ? profile.span : size;
+    long long blocks = span / profile.ioSize;
+    if (blocks <= 0) {
+        fprintf(stderr, "target %s is smaller than one I/O\n", profile.target.c_str());
+        return 1;
+    }
+
+    std::vector<std::thread> workers;
+    for (int i = 0; i < options.threads; i++) {
+        Worker worker = {i, fd, &profile, options.threads, blocks};
+        workers.push_back(std::thread(workerLoop, worker));
+    }
+
+    // Report achieved throughput against the intensity the trace asked for,
+    // averaged over each reporting interval.
+    printf("%10s %10s %10s %10s %8s\n", "time_s", "intensity", "iops", "MB/s", "errors");
+    long long start = nowUs();
+    long long intervalUs = profile.periodUs * options.reportPeriods;
+    long long next = (start / intervalUs + 1) * intervalUs;
+    while (options.durationSec == 0 || next - start <= options.durationSec * 1000000) {
+        long long now = nowUs();
+        if (now < next)
+            usleep(next - now);
+
+        long long first = next / profile.periodUs - options.reportPeriods;
+        long long wanted = 0;
+        for (int i = 0; i < options.reportPeriods; i++)
+            wanted += profile.intensity[(first + i) % profile.intensity.size()];
+
+        double seconds = intervalUs / 1e6;
+        printf("%10.2f %10.2f %10.0f %10.1f %8lld\n",
+               (next - start) / 1e6,
+               (double)wanted / options.reportPeriods,
+               doneOps.exchange(0) / seconds,
+               doneBytes.exchange(0) / seconds / (1024 * 1024),
+               failedOps.exchange(0));
+        fflush(stdout);
+        next += intervalUs;
+    }
+
+    stopping = true;
+    for (std::thread& worker : workers)
+        worker.join();
+    close(fd);
+    return 0;
+}